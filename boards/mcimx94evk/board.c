@@ -51,6 +51,38 @@
 #define BOARD_UART                  0U
 #endif
 
+/* Debug UART TX buffer size (power of 2) */
+#ifndef BOARD_DEBUG_UART_TX_BUF_SIZE
+#define BOARD_DEBUG_UART_TX_BUF_SIZE    1024U
+#endif
+
+/* Debug UART IRQ handler */
+#if (BOARD_UART == 1U)
+#define BOARD_UART_IRQHandler       LPUART1_IRQHandler
+#elif (BOARD_UART == 2U)
+#define BOARD_UART_IRQHandler       LPUART2_IRQHandler
+#elif (BOARD_UART == 3U)
+#define BOARD_UART_IRQHandler       LPUART3_IRQHandler
+#elif (BOARD_UART == 4U)
+#define BOARD_UART_IRQHandler       LPUART4_IRQHandler
+#elif (BOARD_UART == 5U)
+#define BOARD_UART_IRQHandler       LPUART5_IRQHandler
+#elif (BOARD_UART == 6U)
+#define BOARD_UART_IRQHandler       LPUART6_IRQHandler
+#elif (BOARD_UART == 7U)
+#define BOARD_UART_IRQHandler       LPUART7_IRQHandler
+#elif (BOARD_UART == 8U)
+#define BOARD_UART_IRQHandler       LPUART8_IRQHandler
+#elif (BOARD_UART == 9U)
+#define BOARD_UART_IRQHandler       LPUART9_IRQHandler
+#elif (BOARD_UART == 10U)
+#define BOARD_UART_IRQHandler       LPUART10_IRQHandler
+#elif (BOARD_UART == 11U)
+#define BOARD_UART_IRQHandler       LPUART11_IRQHandler
+#elif (BOARD_UART == 12U)
+#define BOARD_UART_IRQHandler       LPUART12_IRQHandler
+#endif
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -101,6 +133,13 @@ static board_uart_config_t const s_uartConfig =
     .inst = BOARD_UART
 };
 
+/* Debug UART TX buffer */
+static uint8_t s_uartTxBuf[BOARD_DEBUG_UART_TX_BUF_SIZE];
+
+/* Debug UART TX buffer indexes (free running) */
+static volatile uint32_t s_uartTxHead = 0U;
+static volatile uint32_t s_uartTxTail = 0U;
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -324,7 +363,7 @@ void BOARD_InitDebugConsole(void)
         lpuart_config.rxFifoWatermark = ((uint8_t)
             FSL_FEATURE_LPUART_FIFO_SIZEn(s_uartConfig.base)) - 1U;
         lpuart_config.txFifoWatermark = ((uint8_t)
-            FSL_FEATURE_LPUART_FIFO_SIZEn(s_uartConfig.base)) - 1U;
+            FSL_FEATURE_LPUART_FIFO_SIZEn(s_uartConfig.base)) / 2U;
         lpuart_config.enableTx = true;
         lpuart_config.enableRx = true;
         if (LPUART_Init(s_uartConfig.base, &lpuart_config,
@@ -332,9 +371,120 @@ void BOARD_InitDebugConsole(void)
         {
             DEV_SM_ErrorLog(DEV_SM_ERR_INITCONSOLE);
         }
+
+        /* Enable TX IRQ handler */
+        NVIC_EnableIRQ(s_uartConfig.irq);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Move buffered debug console data into the TX FIFO                        */
+/*--------------------------------------------------------------------------*/
+static void BOARD_DebugConsoleFill(void)
+{
+    uint32_t fifoSize = (uint32_t) FSL_FEATURE_LPUART_FIFO_SIZEn(
+        s_uartConfig.base);
+    uint32_t priMask = DisableGlobalIRQ();
+
+    /* Fill at most one FIFO */
+    while ((s_uartTxTail != s_uartTxHead) && (((uint32_t)
+        LPUART_GetTxFifoCount(s_uartConfig.base)) < fifoSize))
+    {
+        LPUART_WriteByte(s_uartConfig.base, s_uartTxBuf[s_uartTxTail
+            & (BOARD_DEBUG_UART_TX_BUF_SIZE - 1U)]);
+        s_uartTxTail++;
+    }
+
+    /* TX IRQ handler sends the rest */
+    if (s_uartTxTail != s_uartTxHead)
+    {
+        LPUART_EnableInterrupts(s_uartConfig.base,
+            (uint32_t) kLPUART_TxDataRegEmptyInterruptEnable);
+    }
+    else
+    {
+        LPUART_DisableInterrupts(s_uartConfig.base,
+            (uint32_t) kLPUART_TxDataRegEmptyInterruptEnable);
+    }
+
+    EnableGlobalIRQ(priMask);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Add a byte to the debug console buffer, returns false if full            */
+/*--------------------------------------------------------------------------*/
+static bool BOARD_DebugConsolePut(uint8_t data)
+{
+    bool queued = false;
+    uint32_t priMask = DisableGlobalIRQ();
+
+    if ((s_uartTxHead - s_uartTxTail) < BOARD_DEBUG_UART_TX_BUF_SIZE)
+    {
+        s_uartTxBuf[s_uartTxHead & (BOARD_DEBUG_UART_TX_BUF_SIZE - 1U)]
+            = data;
+        s_uartTxHead++;
+        queued = true;
     }
+
+    EnableGlobalIRQ(priMask);
+
+    return queued;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Queue data for the debug console                                         */
+/*--------------------------------------------------------------------------*/
+void BOARD_DebugConsoleWrite(const uint8_t *data, uint32_t len)
+{
+    if (s_uartConfig.base != NULL)
+    {
+        for (uint32_t idx = 0U; idx < len; idx++)
+        {
+            /* Poll the UART with IRQs enabled while the buffer is full */
+            while (!BOARD_DebugConsolePut(data[idx]))
+            {
+                BOARD_DebugConsoleFill();
+            }
+        }
+
+        /* Start transmit */
+        BOARD_DebugConsoleFill();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Synchronously drain the debug console                                    */
+/*--------------------------------------------------------------------------*/
+void BOARD_DebugConsoleFlush(void)
+{
+    if (s_uartConfig.base != NULL)
+    {
+        /* Send buffered data by polling */
+        while (s_uartTxTail != s_uartTxHead)
+        {
+            BOARD_DebugConsoleFill();
+        }
+
+        /* Wait for the last character to leave the shifter */
+        while ((LPUART_GetStatusFlags(s_uartConfig.base)
+            & ((uint32_t) kLPUART_TransmissionCompleteFlag)) == 0U)
+        {
+            ; /* Intentional empty while */
+        }
+    }
+}
+
+#ifdef BOARD_UART_IRQHandler
+/*--------------------------------------------------------------------------*/
+/* Debug UART IRQ handler                                                   */
+/*--------------------------------------------------------------------------*/
+void BOARD_UART_IRQHandler(void)
+{
+    /* Refill TX FIFO, stops TX IRQ once the buffer is empty */
+    BOARD_DebugConsoleFill();
+}
+#endif
+
 /*--------------------------------------------------------------------------*/
 /* Initialize IRQ handlers                                                  */
 /*--------------------------------------------------------------------------*/
@@ -351,6 +501,10 @@ void BOARD_InitHandlers(void)
     /* Configure SWI handler */
     NVIC_EnableIRQ(BOARD_SWI_IRQn);
 
+    /* Configure SCMI scheduler below the MU handlers */
+    NVIC_SetPriority(BOARD_SCHED_IRQn, IRQ_PRIO_NOPREEMPT_LOW);
+    NVIC_EnableIRQ(BOARD_SCHED_IRQn);
+
     /* Enable BBNSM handler */
     NVIC_EnableIRQ(BBNSM_IRQn);
 
@@ -363,6 +517,9 @@ void BOARD_InitHandlers(void)
     NVIC_EnableIRQ(ELE_Group2_IRQn);
     NVIC_EnableIRQ(ELE_Group3_IRQn);
 
+    /* Enable ELE MU handler */
+    NVIC_EnableIRQ(ELE_MU_IRQn);
+
     /* Enable FCCU handler */
     NVIC_SetPriority(FCCU_INT0_IRQn, IRQ_PRIO_NOPREEMPT_CRITICAL);
     NVIC_EnableIRQ(FCCU_INT0_IRQn);
@@ -401,8 +558,10 @@ void BOARD_InitTimers(void)
         DEV_SM_ErrorLog(DEV_SM_ERR_INITTIMERS);
     }
 
-    SYSTICK_Init(1U, BOARD_SYSTICK_CLKSRC, U32(rate), U32(reloadVal));
-    NVIC_EnableIRQ(SysTick_IRQn);
+    SYSTICK_Init(0U, BOARD_SYSTICK_CLKSRC, U32(rate), U32(reloadVal));
+
+    /* Start the tick timer */
+    DEV_SM_TickStart();
 
     /* Configure and enable the WDOG */
     WDOG32_GetDefaultConfig(&s_wdogConfig);
@@ -541,6 +700,9 @@ void BOARD_SystemSleepPrepare(uint32_t sleepMode, uint32_t sleepFlags)
     /* Configure SM LPUART for wakeup */
     if (s_uartConfig.base != NULL)
     {
+        /* Drain console output */
+        BOARD_DebugConsoleFlush();
+
         /* Enable edge-detect IRQ */
         (void) LPUART_ClearStatusFlags(s_uartConfig.base,
             (uint32_t)kLPUART_RxActiveEdgeFlag);
@@ -568,7 +730,7 @@ void BOARD_SystemSleepEnter(uint32_t sleepMode, uint32_t sleepFlags)
         | DEV_SM_SSF_FRO_ACTIVE_MASK);
 
     /* Disable SysTick */
-    uint32_t sysTickMask = SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    uint32_t sysTickMask = SysTick_CTRL_ENABLE_Msk;
     SysTick->CTRL &= (~sysTickMask);
 
     /* Clear pending SysTick exception */
@@ -599,7 +761,7 @@ void BOARD_SystemSleepExit(uint32_t sleepMode, uint32_t sleepFlags)
     }
 
     /* Enable SysTick */
-    uint32_t sysTickMask = SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    uint32_t sysTickMask = SysTick_CTRL_ENABLE_Msk;
     SysTick->VAL   = 0U;
     SysTick->CTRL |= (sysTickMask);
 }
@@ -619,7 +781,6 @@ void BOARD_SystemSleepUnprepare(uint32_t sleepMode, uint32_t sleepFlags)
         LPUART_DisableInterrupts(s_uartConfig.base,
             (uint32_t)kLPUART_RxActiveEdgeInterruptEnable);
 
-        NVIC_DisableIRQ(s_uartConfig.irq);
         NVIC_ClearPendingIRQ(s_uartConfig.irq);
     }
 }
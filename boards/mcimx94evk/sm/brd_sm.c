@@ -132,6 +132,9 @@ int32_t BRD_SM_Init(int argc, const char * const argv[], uint32_t *mSel)
     uint32_t ms;
     uint32_t flags;
 
+    /* Snapshot fuses, used from clock init on */
+    DEV_SM_FuseInit();
+
     /* Init board hardware */
     BOARD_InitHardware();
 
@@ -177,11 +180,13 @@ _Noreturn void BRD_SM_Exit(int32_t status, uint32_t pc)
 {
 #if defined(MONITOR) || defined(RUN_TEST)
     printf("exit %d, 0x%08X\n", status, pc);
+    BOARD_DebugConsoleFlush();
 
     /* Disable watchdog */
     BOARD_WdogModeSet(BOARD_WDOG_MODE_OFF);
 #else
     SM_SYSTEMERROR(status, pc);
+    BOARD_DebugConsoleFlush();
     // coverity[misra_c_2012_rule_2_2_violation]
     SystemExit();
 #endif
@@ -197,10 +202,13 @@ _Noreturn void BRD_SM_Exit(int32_t status, uint32_t pc)
 /*--------------------------------------------------------------------------*/
 /* Board timer tick                                                         */
 /*--------------------------------------------------------------------------*/
-void BRD_SM_TimerTick(uint32_t msec)
+uint32_t BRD_SM_TimerTick(uint32_t msec)
 {
     /* Kick the dog */
     BOARD_WdogRefresh();
+
+    /* Return next deadline */
+    return BOARD_WDOG_REFRESH_MSEC;
 }
 
 /*--------------------------------------------------------------------------*/
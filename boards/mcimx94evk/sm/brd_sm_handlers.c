@@ -77,8 +77,7 @@ irq_prio_info_t g_brdIrqPrioInfo[BOARD_NUM_IRQ_PRIO_IDX] =
     {
         .irqId = GPIO1_INT0_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     }
 };
 
@@ -334,7 +333,7 @@ void GPIO1_INT0_IRQHandler(void)
     /* Handle controls interrupts */
     BRD_SM_ControlHandler(status, val);
 
-    /* Adjust dynamic IRQ priority */
+    /* Count IRQ occurrence */
     (void) DEV_SM_IrqPrioUpdate();
 }
 
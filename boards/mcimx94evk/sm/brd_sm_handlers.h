@@ -62,10 +62,10 @@
 /*! Initial PCAL6416A interrupt mask */
 #define PCAL6416A_INITIAL_MASK  0xFFF7U
 
-/*! Number of board IRQs participating dynamic prioritization */
+/*! Number of board IRQs in the IRQ priority table */
 #define BOARD_NUM_IRQ_PRIO_IDX                 1U
 
-/*! Dynamic IRQ priority table index for GPIO1 */
+/*! IRQ priority table index for GPIO1 */
 #define BOARD_IRQ_PRIO_IDX_GPIO1_0             0U
 
 /* Types */
@@ -84,7 +84,7 @@ extern PF53_Type g_pf5302Dev;
 /*! Handle to access PCA2131 */
 extern PCA2131_Type g_pca2131Dev;
 
-/*! Array of dynamic priority info for board IRQs */
+/*! Array of IRQ priority info for board IRQs */
 extern irq_prio_info_t g_brdIrqPrioInfo[BOARD_NUM_IRQ_PRIO_IDX];
 
 /*! Fault flags from the PMICs */
@@ -30,7 +30,10 @@
  */
 /** @{ */
 #define BOARD_TICK_PERIOD_MSEC  10U                       /*!< Tick period */
+#define BOARD_WDOG_REFRESH_MSEC 500U                      /*!< Wdog refresh period */
+#define BOARD_PWR_MAX_INRUSH    1U                        /*!< MIX slices ramping at once */
 #define BOARD_SWI_IRQn          SWI_0_IRQn                /*!< SWI IRQ  */
+#define BOARD_SCHED_IRQn        SWI_1_IRQn                /*!< SCMI scheduler IRQ */
 #define BOARD_HAS_WDOG                                    /*!< Has a watchdog */
 #define BOARD_PMIC_RESUME_TICKS ((20U * 32768U) / 10000U) /*!< 2ms in 32K ticks */
 /** @} */
@@ -94,6 +97,21 @@ const board_uart_config_t *BOARD_GetDebugUart(void);
 /*! Init the debug UART */
 void BOARD_InitDebugConsole(void);
 
+/*!
+ * Queue data for the debug UART.
+ *
+ * Data is copied to a TX buffer and sent by the UART IRQ handler. IRQs
+ * are masked only while the buffer indexes are updated. If the buffer is
+ * full, the UART is polled with IRQs enabled until there is space.
+ *
+ * @param[in]     data        Pointer to data to send
+ * @param[in]     len         Number of bytes to send
+ */
+void BOARD_DebugConsoleWrite(const uint8_t *data, uint32_t len);
+
+/*! Synchronously send all buffered debug UART data */
+void BOARD_DebugConsoleFlush(void);
+
 /*! Init interrupt handlers */
 void BOARD_InitHandlers(void);
 
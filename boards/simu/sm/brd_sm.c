@@ -61,6 +61,9 @@ int32_t BRD_SM_Init(int argc, const char * const argv[], uint32_t *mSel)
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Snapshot fuses */
+    DEV_SM_FuseInit();
+
     /* Get the boot mode select */
     if (argc > 1)
     {
@@ -105,13 +108,16 @@ _Noreturn void BRD_SM_Exit(int32_t status, uint32_t pc)
 /*--------------------------------------------------------------------------*/
 /* Board timer tick                                                         */
 /*--------------------------------------------------------------------------*/
-void BRD_SM_TimerTick(uint32_t msec)
+uint32_t BRD_SM_TimerTick(uint32_t msec)
 {
     /* Tick BBM */
     BRD_SM_BbmHandler();
 
     /* Tick sensor */
     BRD_SM_SensorHandler();
+
+    /* Poll again next period */
+    return msec;
 }
 
 /*--------------------------------------------------------------------------*/
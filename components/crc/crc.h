@@ -50,6 +50,28 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/* Defines */
+
+/*!
+ * @name CRC engines
+ * @{
+ */
+#define CRC_ENGINE_BIT     0U  /*!< Bitwise, no tables */
+#define CRC_ENGINE_NIBBLE  1U  /*!< 16-entry table, 4 bits per lookup */
+#define CRC_ENGINE_BYTE    2U  /*!< 256-entry table, 8 bits per lookup */
+#define CRC_ENGINE_SLICE4  3U  /*!< Slice-by-4 tables, 32 bits per step */
+/** @} */
+
+/*! CRC32 engine (nibble, byte, or slice-by-4) */
+#ifndef CRC_CRC32_ENGINE
+#define CRC_CRC32_ENGINE  CRC_ENGINE_SLICE4
+#endif
+
+/*! J1850 engine (bit or byte) */
+#ifndef CRC_J1850_ENGINE
+#define CRC_J1850_ENGINE  CRC_ENGINE_BYTE
+#endif
+
 /* Functions */
 
 /*!
@@ -82,18 +104,47 @@ uint32_t CRC_Xor(const uint32_t *addr, uint32_t size);
  */
 uint8_t CRC_J1850(const uint8_t *addr, uint32_t size);
 
+/*!
+ * Copy data and calculate CRC based on the J1850 algorithm.
+ *
+ * @param[out] dst   Pointer to destination
+ * @param[in]  src   Pointer to data to copy and CRC
+ * @param[in]  size  Size of data in bytes
+ *
+ * Same result as CRC_J1850() but also copies the data in the same pass.
+ *
+ * @return Returns the CRC.
+ */
+uint8_t CRC_J1850Copy(uint8_t *dst, const uint8_t *src, uint32_t size);
+
 /*!
  * Calculate CRC based on the CRC32 algorithm.
  *
  * @param[in]  addr  Pointer to data to CRC
  * @param[in]  size  Size of data in bytes
  *
- * CRC based on the IEEE polynomial used for Ethernet.
+ * CRC based on the IEEE polynomial used for Ethernet. The engine is
+ * selected at build time with ::CRC_CRC32_ENGINE. The slice-by-4 engine
+ * processes a word per step when the data is word aligned.
  *
  * @return Returns the CRC.
  */
 uint32_t CRC_Crc32(const uint8_t *addr, uint32_t size);
 
+/*!
+ * Copy data and calculate CRC based on the CRC32 algorithm.
+ *
+ * @param[out] dst   Pointer to destination
+ * @param[in]  src   Pointer to data to copy and CRC
+ * @param[in]  size  Size of data in bytes
+ *
+ * Same result as CRC_Crc32() but also copies the data in the same pass.
+ * The word fast path requires both \a dst and \a src to be word aligned.
+ *
+ * @return Returns the CRC.
+ */
+uint32_t CRC_Crc32Copy(uint8_t *dst, const uint8_t *src, uint32_t size);
+
 /** @} */
 
 #endif /* CRC_H */
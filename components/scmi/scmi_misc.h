@@ -230,6 +230,14 @@
 #define SCMI_MISC_SHUTDOWN_FLAG_REASON(x)   (((x) & 0xFFU) >> 0U)
 /** @} */
 
+/*!
+ * @name SCMI syslog flags
+ */
+/** @{ */
+/*! Return the SM binary log */
+#define SCMI_MISC_SYSLOG_FLAG_BINLOG(x)  (((x) & 0x1U) << 31U)
+/** @} */
+
 /*!
  * @name SCMI misc num log flags
  */
@@ -608,7 +616,8 @@ int32_t SCMI_MiscCfgInfo(uint32_t channel, uint32_t *mSel,
  *
  * @param[in]     channel      A2P channel for comms
  * @param[in]     flags        Device specific flags that might impact the data
- *                             returned or clearing of the data
+ *                             returned or clearing of the data.<BR>
+ *                             Bit[31] Return the SM binary log
  * @param[in]     logIndex     Index to the first log word. Will be the first
  *                             element in the return array
  * @param[out]    numLogFlags  Descriptor for the log data returned by this
@@ -620,9 +629,11 @@ int32_t SCMI_MiscCfgInfo(uint32_t channel, uint32_t *mSel,
  * @param[out]    syslog       Log data array
  *
  * This function returns the system log. The format of this log is device
- * specific.
+ * specific. If ::SCMI_MISC_SYSLOG_FLAG_BINLOG() is set, the SM binary log
+ * is returned instead.
  *
  * Access macros:
+ * - ::SCMI_MISC_SYSLOG_FLAG_BINLOG() - Return the SM binary log
  * - ::SCMI_MISC_NUM_LOG_FLAGS_REMAING_LOGS() - Number of remaining log words
  * - ::SCMI_MISC_NUM_LOG_FLAGS_NUM_LOGS() - Number of log words that are
  *   returned by this call
@@ -202,6 +202,88 @@ int32_t SCMI_PinctrlAttributes(uint32_t channel, uint32_t identifier,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* List pin or group associations                                           */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PinctrlListAssociations(uint32_t channel, uint32_t identifier,
+    uint32_t flags, uint32_t index, uint32_t *numFlags, uint16_t *array)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t flags;
+        uint16_t array[SCMI_PINCTRL_MAX_ARRAY];
+    } msg_rpinctrld4_t;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t identifier;
+            uint32_t flags;
+            uint32_t index;
+        } msg_tpinctrld4_t;
+        msg_tpinctrld4_t *msgTx = (msg_tpinctrld4_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->identifier = identifier;
+        msgTx->flags = flags;
+        msgTx->index = index;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_PINCTRL_LIST_ASSOCIATIONS, sizeof(msg_tpinctrld4_t),
+            &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t) + sizeof(uint32_t),
+            header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rpinctrld4_t *msgRx = (const msg_rpinctrld4_t*) msg;
+
+        /* Extract numFlags */
+        if (numFlags != NULL)
+        {
+            *numFlags = msgRx->flags;
+        }
+
+        /* Extract array */
+        if (array != NULL)
+        {
+            SCMI_MemCpy((uint8_t*) array, (uint8_t*) &msgRx->array,
+                SCMI_PINCTRL_NUM_ARRAY, sizeof(uint16_t), &status);
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get pin configuration                                                    */
 /*--------------------------------------------------------------------------*/
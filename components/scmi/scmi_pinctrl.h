@@ -54,6 +54,8 @@
 /** @{ */
 /*! Get pin attributes */
 #define SCMI_MSG_PINCTRL_ATTRIBUTES          0x3U
+/*! List pin or group associations */
+#define SCMI_MSG_PINCTRL_LIST_ASSOCIATIONS   0x4U
 /*! Get pin configuration */
 #define SCMI_MSG_PINCTRL_SETTINGS_GET        0x5U
 /*! Set pin configuration */
@@ -76,6 +78,8 @@
 #define SCMI_PINCTRL_MAX_CONFIGS    SCMI_ARRAY(12U, scmi_pin_config_t)
 /*! Max number of configs sent in one call */
 #define SCMI_PINCTRL_MAX_CONFIGS_T  SCMI_ARRAY(8U, scmi_pin_config_t)
+/*! Max number of associations returned in one call */
+#define SCMI_PINCTRL_MAX_ARRAY      SCMI_ARRAY(12U, uint16_t)
 /** @} */
 
 /*!
@@ -85,7 +89,9 @@
 /*! Actual number of configs returned */
 #define SCMI_PINCTRL_NUM_CONFIGS    SCMI_PINCTRL_NUM_CONFIG_FLAGS_NUM_CONFIGS(msgRx->numConfigs)
 /*! Actual number of configs sent */
-#define SCMI_PINCTRL_NUM_CONFIGS_T  (attributes >> 2)
+#define SCMI_PINCTRL_NUM_CONFIGS_T  ((attributes >> 2) & 0xFFU)
+/*! Actual number of associations returned */
+#define SCMI_PINCTRL_NUM_ARRAY      SCMI_PINCTRL_NUM_FLAGS_NUM(msgRx->flags)
 /** @} */
 
 /*!
@@ -164,6 +170,16 @@
 #define SCMI_PINCTRL_FLAGS_SELECTOR(x)  (((x) & 0x3U) << 0U)
 /** @} */
 
+/*!
+ * @name SCMI pin control list flags
+ */
+/** @{ */
+/*! Number of remaining identifiers */
+#define SCMI_PINCTRL_NUM_FLAGS_REMAINING(x)  (((x) & 0xFFFF0000U) >> 16U)
+/*! Number of identifiers returned by this call */
+#define SCMI_PINCTRL_NUM_FLAGS_NUM(x)        (((x) & 0xFFFU) >> 0U)
+/** @} */
+
 /*!
  * @name SCMI pin attributes
  */
@@ -385,6 +401,49 @@ int32_t SCMI_PinctrlProtocolMessageAttributes(uint32_t channel,
 int32_t SCMI_PinctrlAttributes(uint32_t channel, uint32_t identifier,
     uint32_t flags, uint32_t *attributes, uint8_t *name);
 
+/*!
+ * List pin or group associations.
+ *
+ * @param[in]     channel     A2P channel for comms
+ * @param[in]     identifier  Identifier for the group or function
+ * @param[in]     flags       Selector:<BR>
+ *                            Bits[31:2] Reserved, must be zero.<BR>
+ *                            Bits[1:0] Selector: Whether the identifier field
+ *                            selects a group or a function.<BR>
+ *                            1 - Group<BR>
+ *                            2 - Function<BR>
+ *                            All other values are reserved for future use
+ * @param[in]     index       Index of the first pin (group) or group
+ *                            (function) to be returned
+ * @param[out]    numFlags    Number of associations:<BR>
+ *                            Bits[31:16] Number of remaining identifiers.<BR>
+ *                            Bits[15:12] Reserved, must be zero.<BR>
+ *                            Bits[11:0] Number of identifiers that are
+ *                            returned by this call
+ * @param[out]    array       Array of pin identifiers (group) or group
+ *                            identifiers (function)
+ *
+ * This function can be used by an agent to get the pins that make up a group
+ * or the groups that support a function. The max number of identifiers is
+ * ::SCMI_PINCTRL_MAX_ARRAY. See section 4.11.2.6 PINCTRL_LIST_ASSOCIATIONS in
+ * the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_PINCTRL_FLAGS_SELECTOR() - Selector
+ * - ::SCMI_PINCTRL_NUM_FLAGS_REMAINING() - Number of remaining identifiers
+ * - ::SCMI_PINCTRL_NUM_FLAGS_NUM() - Number of identifiers returned
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the identifiers were successfully returned.
+ * - ::SCMI_ERR_NOT_FOUND: if the \a identifier field does not point to a
+ *   valid group or function.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if the selector or \a index is invalid.
+ */
+int32_t SCMI_PinctrlListAssociations(uint32_t channel, uint32_t identifier,
+    uint32_t flags, uint32_t index, uint32_t *numFlags, uint16_t *array);
+
 /*!
  * Get pin configuration.
  *
@@ -49,6 +49,7 @@ sub generate_dox;
 sub generate_mb;
 sub generate_xport;
 sub generate_scmi;
+sub generate_pin_grp;
 sub generate_lmm;
 sub generate_dev;
 sub generate_user;
@@ -58,12 +59,14 @@ sub generate_trdc;
 sub generate_test;
 sub generate_make;
 sub get_perms;
+sub get_grp_perms;
 sub get_bctrl;
 sub get_tests;
 sub get_trdc_config;
 sub get_trdc;
 sub convert_trdc;
 sub compress_data;
+sub compress_run;
 sub sapa;
 sub param;
 sub header;
@@ -71,11 +74,12 @@ sub footer;
 sub banner;
 sub copyright;
 sub startstop;
+sub startstop_prog;
 sub error_line;
 sub get_define;
 
 # Config version
-my $configVer = 2;
+my $configVer = 3;
 
 my @protocols = ('base', 'pd', 'sys', 'perf', 'clk', 'sensor',
     'rst', 'volt', 'lmm', 'gpr', 'rtc', 'button', 'cpu', 'perlpi',
@@ -727,6 +731,7 @@ sub generate_mb
             my $x;
             my $xportType = '<invalid>';
             my %xportChannel;
+            my %muMap;
             
             # Open file
             open my $out, '>', $outDir . '/' . $fileName
@@ -827,6 +832,16 @@ sub generate_mb
 	                        . uc $parm . ', \\' . "\n";
 	                }
 	                $defLst[$i] = $mu;
+
+	                # Record hardware MU to instance map
+	                if (&param($mb, 'mu') ne '!')
+	                {
+	                    if (exists $muMap{$mu})
+	                    {
+	                        error_line('duplicate mu', $mb);
+	                    }
+	                    $muMap{$mu} = $i;
+	                }
 	            }
             }
             if ($x != -1)
@@ -857,6 +872,26 @@ sub generate_mb
             }
             print $out "\n";
 
+            # Output MU to instance map
+            if ($mbt eq 'MU')
+            {
+                $i = 0;
+                print $out "\n" . '/*! Config data for MU to MB instance map'
+                    . ' (instance + 1) */' . "\n";
+                print $out '#define SM_MB_' . $mbt . '_MAP_DATA';
+                foreach my $mu (sort {$a <=> $b} keys %muMap)
+                {
+                    if ($i != 0)
+                    {
+                        print $out ',';
+                    }
+                    print $out ' \\' . "\n" . '    [' . $mu . 'U] = '
+                        . ($muMap{$mu} + 1) . 'U';
+                    $i++;
+                }
+                print $out "\n";
+            }
+
             # Output footer
             print $out &footer('MB_' . $mbt);
 
@@ -1062,6 +1097,10 @@ sub generate_scmi
     my $numChn = @chnList;
     my @agntList = grep(/^SCMI_AGENT\d*\b/, @list);
     my $numAgnt = @agntList;
+    my @grpList = grep(/^PINGRP\b/, @list);
+    my $numGrp = @grpList;
+    my @funcList = grep(/^PINFUNC\b/, @list);
+    my $numFunc = @funcList;
     my $i;
     my %xportInst;
 
@@ -1080,6 +1119,12 @@ sub generate_scmi
     # Log agent info
     &log_array('SCMI agent info', \@agntList);
 
+    # Log pin group info
+    &log_array('SCMI pin group info', \@grpList);
+
+    # Log pin function info
+    &log_array('SCMI pin function info', \@funcList);
+
     # Output header
     print $out &header('SCMI', 'SCMI RPC');
 
@@ -1224,6 +1269,10 @@ sub generate_scmi
             # Get perms
             my @perms = &get_perms($cfgRef, $dup);
 
+            # Append pin group perms
+            push @perms, &get_grp_perms(\@perms, \@grpList);
+            @perms = sort @perms;
+
             # Output agent info
 			print $out '/*! Config for SCMI agent ' . $agnt
 				. ' */' . "\n";
@@ -1242,6 +1291,18 @@ sub generate_scmi
             {
                 print $out '        .seenvId = ' . $seenvid . 'U, \\' . "\n";
             }
+            if ((my $parm = &param($dat, 'prio')) ne '!')
+            {
+                print $out '        .schedPrio = ' . $parm . 'U, \\' . "\n";
+            }
+            if ((my $parm = &param($dat, 'weight')) ne '!')
+            {
+                print $out '        .schedWeight = ' . $parm . 'U, \\' . "\n";
+            }
+            if ((my $parm = &param($dat, 'budget')) ne '!')
+            {
+                print $out '        .schedBudget = ' . $parm . 'U, \\' . "\n";
+            }
 
             # Loop over perms
             $i = 0;
@@ -1360,6 +1421,12 @@ sub generate_scmi
         . "\n";
     print $out '#define SM_SCMI_MAX_NOTIFY  ' . $notify . 'U' . "\n";
 
+    # Output pin groups and functions
+    if ($numGrp > 0)
+    {
+        &generate_pin_grp($out, \@grpList, \@funcList);
+    }
+
     # Output footer
     print $out &footer('SCMI');
 
@@ -1369,6 +1436,210 @@ sub generate_scmi
 
 ###############################################################################
 
+sub generate_pin_grp
+{
+    my ($out, $grpRef, $funcRef) = @_;
+    my @grpList = @$grpRef;
+    my $numGrp = @grpList;
+    my @funcList = @$funcRef;
+    my $numFunc = @funcList;
+    my $i;
+
+    # Output pin groups
+    print $out "\n" . &banner('SCMI Pin Group Config');
+    my %grpIdx;
+    my @grpPins;
+    $i = 0;
+    foreach my $dat (@grpList)
+    {
+        my $name = &param($dat, 'name');
+        my @pins = grep(/^DEV_SM_PIN_\w+$/, split(/ /, $dat));
+        my $numPins = @pins;
+
+        if ($name eq '!')
+        {
+            error_line('missing pin group name', $dat);
+        }
+        $name =~ s/\"//g;
+        if (length($name) > 15)
+        {
+            error_line('pin group name too long', $dat);
+        }
+        if (exists $grpIdx{$name})
+        {
+            error_line('duplicate pin group', $dat);
+        }
+        if ($numPins == 0)
+        {
+            error_line('empty pin group', $dat);
+        }
+        $grpIdx{$name} = $i;
+
+        print $out '/*! Config for SCMI pin group ' . $i . ' */' . "\n";
+        print $out '#define SM_SCMI_PIN_GRP' . $i . '_CONFIG \\' . "\n";
+        print $out '    { \\' . "\n";
+        print $out '        .name = "' . $name . '", \\' . "\n";
+        print $out '        .firstPin = ' . scalar(@grpPins) . 'U, \\' . "\n";
+        print $out '        .numPins = ' . $numPins . 'U, \\' . "\n";
+        print $out '    }' . "\n\n";
+
+        push @grpPins, @pins;
+        $i++;
+    }
+
+	print $out '/*! Config for number of SCMI pin groups */' . "\n";
+    print $out '#define SM_SCMI_NUM_PIN_GRP  ' . $numGrp . 'U' . "\n\n";
+
+	print $out '/*! Config for number of pins in all SCMI pin groups */'
+        . "\n";
+    print $out '#define SM_SCMI_NUM_PIN_GRP_PINS  ' . scalar(@grpPins)
+        . 'U' . "\n\n";
+
+	print $out '/*! Config data array for SCMI pin groups */' . "\n";
+    print $out '#define SM_SCMI_PIN_GRP_CONFIG_DATA';
+    foreach my $i (0..($numGrp - 1))
+    {
+        if ($i != 0)
+        {
+            print $out ',';
+        }
+        print $out ' \\' . "\n" . '    SM_SCMI_PIN_GRP' . $i . '_CONFIG';
+    }
+    print $out "\n\n";
+
+	print $out '/*! Config data array for pins in SCMI pin groups */' . "\n";
+    print $out '#define SM_SCMI_PIN_GRP_PINS_DATA';
+    foreach my $i (0..$#grpPins)
+    {
+        if ($i != 0)
+        {
+            print $out ',';
+        }
+        print $out ' \\' . "\n" . '    ' . $grpPins[$i];
+    }
+    print $out "\n\n";
+
+    # Build pin to group index
+    my %pinGrps;
+    my @pinOrder;
+    $i = 0;
+    foreach my $dat (@grpList)
+    {
+        my @pins = grep(/^DEV_SM_PIN_\w+$/, split(/ /, $dat));
+
+        foreach my $pin (@pins)
+        {
+            if (!exists $pinGrps{$pin})
+            {
+                $pinGrps{$pin} = [];
+                push @pinOrder, $pin;
+            }
+            if (!grep { $_ == $i } @{$pinGrps{$pin}})
+            {
+                push @{$pinGrps{$pin}}, $i;
+            }
+        }
+        $i++;
+    }
+
+    my @grpRefs;
+    foreach my $pin (@pinOrder)
+    {
+        push @grpRefs, @{$pinGrps{$pin}};
+    }
+
+	print $out '/*! Config for number of SCMI pin group references */' . "\n";
+    print $out '#define SM_SCMI_NUM_PIN_GRP_REFS  ' . scalar(@grpRefs)
+        . 'U' . "\n\n";
+
+	print $out '/*! Config data array for groups containing each pin */'
+        . "\n";
+    print $out '#define SM_SCMI_PIN_GRP_REFS_DATA';
+    foreach my $i (0..$#grpRefs)
+    {
+        if ($i != 0)
+        {
+            print $out ',';
+        }
+        print $out ' \\' . "\n" . '    ' . $grpRefs[$i] . 'U';
+    }
+    print $out "\n\n";
+
+	print $out '/*! Config data array for pin to group index */' . "\n";
+    print $out '#define SM_SCMI_PIN_GRP_IDX_DATA';
+    my $first = 0;
+    foreach my $i (0..$#pinOrder)
+    {
+        my $pin = $pinOrder[$i];
+        my $num = scalar(@{$pinGrps{$pin}});
+
+        if ($i != 0)
+        {
+            print $out ',';
+        }
+        print $out ' \\' . "\n" . '    [' . $pin . '] = {.firstGrp = '
+            . $first . 'U, .numGrp = ' . $num . 'U}';
+        $first += $num;
+    }
+    print $out "\n\n";
+
+    # Output pin functions
+    print $out &banner('SCMI Pin Function Config');
+    $i = 0;
+    foreach my $dat (@funcList)
+    {
+        my $name = &param($dat, 'name');
+        my $grp = &param($dat, 'grp');
+        my $mux = &param($dat, 'mux');
+
+        if ($name eq '!')
+        {
+            error_line('missing pin function name', $dat);
+        }
+        $name =~ s/\"//g;
+        if (length($name) > 15)
+        {
+            error_line('pin function name too long', $dat);
+        }
+        $grp =~ s/\"//g;
+        if (!exists $grpIdx{$grp})
+        {
+            error_line('invalid pin function group', $dat);
+        }
+        if ($mux eq '!')
+        {
+            error_line('missing pin function mux', $dat);
+        }
+
+        print $out '/*! Config for SCMI pin function ' . $i . ' */' . "\n";
+        print $out '#define SM_SCMI_PIN_FUNC' . $i . '_CONFIG \\' . "\n";
+        print $out '    { \\' . "\n";
+        print $out '        .name = "' . $name . '", \\' . "\n";
+        print $out '        .grp = ' . $grpIdx{$grp} . 'U, \\' . "\n";
+        print $out '        .mux = ' . $mux . 'U, \\' . "\n";
+        print $out '    }' . "\n\n";
+
+        $i++;
+    }
+
+	print $out '/*! Config for number of SCMI pin functions */' . "\n";
+    print $out '#define SM_SCMI_NUM_PIN_FUNC  ' . $numFunc . 'U' . "\n\n";
+
+	print $out '/*! Config data array for SCMI pin functions */' . "\n";
+    print $out '#define SM_SCMI_PIN_FUNC_CONFIG_DATA';
+    foreach my $i (0..($numFunc - 1))
+    {
+        if ($i != 0)
+        {
+            print $out ',';
+        }
+        print $out ' \\' . "\n" . '    SM_SCMI_PIN_FUNC' . $i . '_CONFIG';
+    }
+    print $out "\n";
+}
+
+###############################################################################
+
 sub generate_lmm
 {
     my ($outDir, $cfgRef) = @_;
@@ -1600,6 +1871,10 @@ sub generate_lmm
 	        {
 	            print $out '        .rtime = ' . $parm . 'U, \\' . "\n";
 	        }
+	        if ((my $parm = &param($lm, 'deadline')) ne '!')
+	        {
+	            print $out '        .deadline = ' . $parm . 'U, \\' . "\n";
+	        }
 
             # Output safety type
    	        if ((my $parm = &param($lm, 'safe')) ne '!')
@@ -1631,6 +1906,13 @@ sub generate_lmm
 	                . ', \\' . "\n";
 	        }
 
+            # Output warm reset policy
+   	        if ((my $parm = &param($lm, 'warm')) ne '!')
+	        {
+	            print $out '        .warm = LMM_WARM_' . uc $parm
+	                . ', \\' . "\n";
+	        }
+
 			# Output start/stop
 			my $sidx = first { $start[$_] =~ /lm=$lm_val/ } 0..$#start;
 			if (defined $sidx)
@@ -1738,6 +2020,7 @@ sub generate_lmm
     print $out '#define SM_LM_START_DATA';
 	print $out &startstop($numStart, \@start);
     print $out "\n";
+	print $out &startstop_prog('START', 'start', \@start);
 
     # Output stop
     my $numStop = @stop;
@@ -1747,6 +2030,7 @@ sub generate_lmm
     print $out '#define SM_LM_STOP_DATA';
 	print $out &startstop($numStop, \@stop);
     print $out "\n";
+	print $out &startstop_prog('STOP', 'stop', \@stop);
 
     # Output fault
     print $out &banner('LM Fault Lists');
@@ -2498,6 +2782,57 @@ sub get_perms
 
 ###############################################################################
 
+sub get_grp_perms
+{
+    my ($permsRef, $grpRef) = @_;
+    my %pinPerms;
+    my @perms;
+
+    # Extract pin permissions
+    foreach my $line (@$permsRef)
+    {
+        if ($line =~ /^\.pinPerms\[(\w+)\] = SM_SCMI_PERM_(\w+)/)
+        {
+            my $perm = lc $2;
+            my ($rank) = grep { $permTypes[$_] eq $perm } 0..$#permTypes;
+
+            $pinPerms{$1} = $rank;
+        }
+    }
+
+    # Group perm is the lowest perm of all pins in the group
+    my $grp = 0;
+    foreach my $dat (@$grpRef)
+    {
+        my @pins = grep(/^DEV_SM_PIN_\w+$/, split(/ /, $dat));
+        my $rank = $#permTypes;
+
+        foreach my $pin (@pins)
+        {
+            if (!exists $pinPerms{$pin})
+            {
+                $rank = 0;
+                last;
+            }
+            if ($pinPerms{$pin} < $rank)
+            {
+                $rank = $pinPerms{$pin};
+            }
+        }
+
+        if ($rank != 0)
+        {
+            push @perms, '.pinGrpPerms[' . $grp . '] = SM_SCMI_PERM_'
+                . uc $permTypes[$rank];
+        }
+        $grp++;
+    }
+
+    return @perms;
+}
+
+###############################################################################
+
 sub get_bctrl
 {
     my ($cfgRef) = @_;
@@ -3721,26 +4056,107 @@ sub compress_data
 {
     my (@avpRef) = @_;
     my $rtn = '';
+    my @dat;
 
-	# Loop over each line
+	# Parse address/value pairs
     foreach my $line (@avpRef)
     {
 		if ($line =~ /([A-Z]+): (\w+) = (\w+)/i)
 		{
-			my $data = hex($3);
+			push @dat, [hex($2), $3];
+		}
+	}
+
+	# Loop over runs of contiguous words (max 255 words per command)
+	my $i = 0;
+	while ($i < @dat)
+	{
+		my $j = $i + 1;
+		while (($j < @dat) && (($j - $i) < 255)
+			&& ($dat[$j][0] == ($dat[$j - 1][0] + 4)))
+		{
+			$j++;
+		}
 
-			if ($data == 0)
+		$rtn .= &compress_run(@dat[$i .. ($j - 1)]);
+		$i = $j;
+	}
+
+	return $rtn;
+}
+
+###############################################################################
+
+sub compress_run
+{
+    my (@run) = @_;
+    my $rtn = '';
+    my @lit;
+
+	# Split into literal bursts and fill/zero runs of identical values
+	my $k = 0;
+	while ($k <= @run)
+	{
+		my $m = 0;
+		if ($k < @run)
+		{
+			my $val = hex($run[$k][1]);
+			$m = 1;
+			while ((($k + $m) < @run) && (hex($run[$k + $m][1]) == $val))
+			{
+				$m++;
+			}
+			if ((($val == 0) && ($m < 2)) || (($val != 0) && ($m < 3)))
+			{
+				push @lit, @run[$k .. ($k + $m - 1)];
+				$k += $m;
+				next;
+			}
+		}
+
+		# Flush literal burst
+		if (@lit == 1)
+		{
+			if (hex($lit[0][1]) == 0)
 			{
-				$rtn .= '        SM_CFG_Z1(';
-				$rtn .= $2 . 'U), \\';
+				$rtn .= sprintf("        SM_CFG_Z1(0x%08XU), \\\n",
+					$lit[0][0]);
 			}
 			else
 			{
-				$rtn .= '        SM_CFG_W1(';
-				$rtn .= $2 . 'U), ' . $3 . 'U, \\';
+				$rtn .= sprintf("        SM_CFG_W1(0x%08XU), %sU, \\\n",
+					$lit[0][0], $lit[0][1]);
+			}
+		}
+		elsif (@lit > 1)
+		{
+			$rtn .= sprintf("        SM_CFG_WN(0x%08XU, %uU), \\\n",
+				$lit[0][0], scalar @lit);
+			for (my $n = 0; $n < @lit; $n += 4)
+			{
+				my $e = ($n + 3) < $#lit ? ($n + 3) : $#lit;
+				$rtn .= '            '
+					. join(', ', map { $_->[1] . 'U' } @lit[$n .. $e])
+					. ', \\' . "\n";
 			}
-			$rtn .= "\n";
 		}
+		@lit = ();
+
+		# Output fill/zero run
+		if ($m > 0)
+		{
+			if (hex($run[$k][1]) == 0)
+			{
+				$rtn .= sprintf("        SM_CFG_ZN(0x%08XU, %uU), \\\n",
+					$run[$k][0], $m);
+			}
+			else
+			{
+				$rtn .= sprintf("        SM_CFG_FN(0x%08XU, %uU), %sU, \\\n",
+					$run[$k][0], $m, $run[$k][1]);
+			}
+		}
+		$k += ($m > 0) ? $m : 1;
 	}
 
 	return $rtn;
@@ -3965,6 +4381,68 @@ sub startstop
 
 ###############################################################################
 
+sub startstop_prog
+{
+    my ($uc, $lc, $ssRef) = @_;
+    my %steps;
+    my %cpus;
+    my $rtn = '';
+
+	# Group list indexes by LM and mSel, keeping list order
+	for my $i (0 .. $#$ssRef)
+	{
+		my $s = $ssRef->[$i];
+		my $key = sprintf("%03d%03d", &param($s, 'lm'), &param($s, 'msel'));
+
+		push @{$steps{$key}}, $i;
+
+		# Collect CPUs
+		if (&param($s, 'ss') eq 'LMM_SS_CPU')
+		{
+			push @{$cpus{$key}}, '(1UL << ' . &param($s, 'rsrc') . ')';
+		}
+	}
+
+	# Output steps
+    $rtn .= '/*! LM ' . $lc . ' program steps */' . "\n";
+    $rtn .= '#define SM_LM_' . $uc . '_STEP_DATA';
+	foreach my $key (sort keys %steps)
+	{
+		$rtn .= ' \\' . "\n" . '   ';
+		foreach my $i (@{$steps{$key}})
+		{
+			$rtn .= ' ' . $i . 'U,';
+		}
+	}
+	$rtn .= "\n\n";
+
+	# Output programs
+    $rtn .= '/*! LM ' . $lc . ' programs, per LM and mSel */' . "\n";
+    $rtn .= '#define SM_LM_' . $uc . '_PROG_DATA';
+	my $first = 0;
+	foreach my $key (sort keys %steps)
+	{
+		my $num = @{$steps{$key}};
+		my $lm = int(substr($key, 0, 3));
+		my $msel = int(substr($key, 3, 3));
+
+		$rtn .= ' \\' . "\n" . '    [' . $lm . '][' . $msel . '] = {'
+			. '.first = ' . $first . 'U, .num = ' . $num . 'U';
+		if (exists $cpus{$key})
+		{
+			$rtn .= ', \\' . "\n" . '     .cpuMask = '
+				. join(' | ', @{$cpus{$key}});
+		}
+		$rtn .= '},';
+		$first += $num;
+	}
+	$rtn .= "\n\n";
+
+    return $rtn;
+}
+
+###############################################################################
+
 sub error_line
 {
     my ($msg, $line) = @_;
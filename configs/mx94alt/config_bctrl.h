@@ -61,12 +61,9 @@
 #define SM_BCTRL_A_CONFIG \
     { \
         SM_CFG_W1(0x00000008U), 0x00001804U, \
-        SM_CFG_W1(0x0000000CU), 0x0000E7FBU, \
-        SM_CFG_W1(0x00000010U), 0x0000E7FBU, \
-        SM_CFG_W1(0x00000014U), 0x0000E7FBU, \
-        SM_CFG_W1(0x00000018U), 0x0000E7FBU, \
-        SM_CFG_W1(0x00000020U), 0x0000E7FBU, \
-        SM_CFG_W1(0x00000024U), 0x0000E7FBU, \
+        SM_CFG_FN(0x0000000CU, 4U), 0x0000E7FBU, \
+        SM_CFG_WN(0x00000020U, 2U), \
+            0x0000E7FBU, 0x0000E7FBU, \
         SM_CFG_END \
     }
 
@@ -77,20 +74,8 @@
 /*! Config for BCTRL W */
 #define SM_BCTRL_W_CONFIG \
     { \
-        SM_CFG_W1(0x00000030U), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x00000034U), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x00000038U), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x0000003CU), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x00000040U), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x00000044U), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x00000048U), 0xFFDFFFFFU, \
-        SM_CFG_W1(0x00000050U), 0x00001E1FU, \
-        SM_CFG_W1(0x00000054U), 0x00001E1FU, \
-        SM_CFG_W1(0x00000058U), 0x00001E1FU, \
-        SM_CFG_W1(0x0000005CU), 0x00001E1FU, \
-        SM_CFG_W1(0x00000060U), 0x00001E1FU, \
-        SM_CFG_W1(0x00000064U), 0x00001E1FU, \
-        SM_CFG_W1(0x00000068U), 0x00001E1FU, \
+        SM_CFG_FN(0x00000030U, 7U), 0xFFDFFFFFU, \
+        SM_CFG_FN(0x00000050U, 7U), 0x00001E1FU, \
         SM_CFG_END \
     }
 
@@ -141,6 +141,24 @@
      .numArg = 1, .arg[0] = 3U, }, \
     {.lmId = 1U, .mSel = 2U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_A55C0},
 
+/*! LM start program steps */
+#define SM_LM_START_STEP_DATA \
+    0U, 4U, 5U, 9U, \
+    1U, 6U, 10U, \
+    2U, 7U, 11U, 12U, 13U, 14U, \
+    3U, 8U,
+
+/*! LM start programs, per LM and mSel */
+#define SM_LM_START_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 4U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S) | (1UL << DEV_SM_CPU_M7P0) | (1UL << DEV_SM_CPU_M7P1)}, \
+    [1][1] = {.first = 4U, .num = 3U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)}, \
+    [1][2] = {.first = 7U, .num = 6U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S) | (1UL << DEV_SM_CPU_M7P1) | (1UL << DEV_SM_CPU_M7P0) | (1UL << DEV_SM_CPU_A55C0)}, \
+    [1][3] = {.first = 13U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)},
+
 /*! Config for number of stop */
 #define SM_LM_NUM_STOP  32U
 
@@ -179,6 +197,24 @@
     {.lmId = 1U, .mSel = 1U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_M33S}, \
     {.lmId = 1U, .mSel = 2U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_M33S},
 
+/*! LM stop program steps */
+#define SM_LM_STOP_STEP_DATA \
+    0U, 3U, 6U, 9U, 12U, 16U, \
+    1U, 4U, 7U, 10U, 13U, 17U, 20U, 22U, 24U, 26U, 28U, 30U, \
+    2U, 5U, 8U, 11U, 14U, 18U, 21U, 23U, 25U, 27U, 29U, 31U, \
+    15U, 19U,
+
+/*! LM stop programs, per LM and mSel */
+#define SM_LM_STOP_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 6U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1) | (1UL << DEV_SM_CPU_M7P0) | (1UL << DEV_SM_CPU_M33S)}, \
+    [1][1] = {.first = 6U, .num = 12U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P) | (1UL << DEV_SM_CPU_M7P0) | (1UL << DEV_SM_CPU_M7P1) | (1UL << DEV_SM_CPU_M33S)}, \
+    [1][2] = {.first = 18U, .num = 12U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P) | (1UL << DEV_SM_CPU_M7P0) | (1UL << DEV_SM_CPU_M7P1) | (1UL << DEV_SM_CPU_M33S)}, \
+    [1][3] = {.first = 30U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)},
+
 /*--------------------------------------------------------------------------*/
 /* LM Fault Lists                                                           */
 /*--------------------------------------------------------------------------*/
@@ -30,7 +30,7 @@
 ##
 ## ###################################################################
 
-GEN_CONFIG_VER ?= 2U
+GEN_CONFIG_VER ?= 3U
 BOARD ?= mcimx94evk
 USES_FUSA ?= 1
 
@@ -61,9 +61,7 @@
 #define SM_BCTRL_A_CONFIG \
     { \
         SM_CFG_W1(0x00000008U), 0x00001804U, \
-        SM_CFG_W1(0x0000000CU), 0x0000E16AU, \
-        SM_CFG_W1(0x00000010U), 0x0000E16AU, \
-        SM_CFG_W1(0x00000014U), 0x0000E16AU, \
+        SM_CFG_FN(0x0000000CU, 3U), 0x0000E16AU, \
         SM_CFG_W1(0x00000018U), 0x0000E56AU, \
         SM_CFG_W1(0x00000024U), 0x00000291U, \
         SM_CFG_END \
@@ -76,19 +74,12 @@
 /*! Config for BCTRL W */
 #define SM_BCTRL_W_CONFIG \
     { \
-        SM_CFG_W1(0x00000030U), 0xF80FDFFFU, \
-        SM_CFG_W1(0x00000034U), 0xF80FDFFFU, \
-        SM_CFG_W1(0x00000038U), 0xF80FDFFFU, \
-        SM_CFG_W1(0x0000003CU), 0xF80FDFFFU, \
-        SM_CFG_W1(0x00000040U), 0x02900000U, \
-        SM_CFG_W1(0x00000044U), 0x04402000U, \
-        SM_CFG_W1(0x00000048U), 0x01400000U, \
-        SM_CFG_W1(0x00000050U), 0x00000003U, \
-        SM_CFG_W1(0x00000054U), 0x00000003U, \
-        SM_CFG_W1(0x00000058U), 0x00000003U, \
-        SM_CFG_W1(0x0000005CU), 0x00000003U, \
-        SM_CFG_W1(0x00000060U), 0x00001E18U, \
-        SM_CFG_W1(0x00000064U), 0x00000004U, \
+        SM_CFG_FN(0x00000030U, 4U), 0xF80FDFFFU, \
+        SM_CFG_WN(0x00000040U, 3U), \
+            0x02900000U, 0x04402000U, 0x01400000U, \
+        SM_CFG_FN(0x00000050U, 4U), 0x00000003U, \
+        SM_CFG_WN(0x00000060U, 2U), \
+            0x00001E18U, 0x00000004U, \
         SM_CFG_END \
     }
 
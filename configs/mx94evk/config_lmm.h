@@ -204,6 +204,48 @@
     {.lmId = 4U, .mSel = 1U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_A55C0}, \
     {.lmId = 4U, .mSel = 2U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_A55C0},
 
+/*! LM start program steps */
+#define SM_LM_START_STEP_DATA \
+    0U, 3U, \
+    1U, 4U, \
+    2U, 5U, \
+    6U, 9U, \
+    7U, 10U, \
+    8U, \
+    11U, 14U, \
+    12U, 15U, \
+    13U, 16U, \
+    17U, 20U, 23U, \
+    18U, 21U, 24U, \
+    19U, 22U, 25U,
+
+/*! LM start programs, per LM and mSel */
+#define SM_LM_START_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)}, \
+    [1][1] = {.first = 2U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)}, \
+    [1][2] = {.first = 4U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)}, \
+    [2][0] = {.first = 6U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P0)}, \
+    [2][1] = {.first = 8U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P0)}, \
+    [2][2] = {.first = 10U, .num = 1U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P0)}, \
+    [3][0] = {.first = 11U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1)}, \
+    [3][1] = {.first = 13U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1)}, \
+    [3][2] = {.first = 15U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1)}, \
+    [4][0] = {.first = 17U, .num = 3U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)}, \
+    [4][1] = {.first = 20U, .num = 3U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)}, \
+    [4][2] = {.first = 23U, .num = 3U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)},
+
 /*! Config for number of stop */
 #define SM_LM_NUM_STOP  36U
 
@@ -246,6 +288,48 @@
     {.lmId = 4U, .mSel = 1U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_A55P}, \
     {.lmId = 4U, .mSel = 2U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_A55P},
 
+/*! LM stop program steps */
+#define SM_LM_STOP_STEP_DATA \
+    0U, 3U, \
+    1U, 4U, \
+    2U, 5U, \
+    6U, 9U, \
+    7U, 10U, \
+    8U, 11U, \
+    12U, 15U, \
+    13U, 16U, \
+    14U, 17U, \
+    18U, 21U, 24U, 27U, 30U, 33U, \
+    19U, 22U, 25U, 28U, 31U, 34U, \
+    20U, 23U, 26U, 29U, 32U, 35U,
+
+/*! LM stop programs, per LM and mSel */
+#define SM_LM_STOP_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)}, \
+    [1][1] = {.first = 2U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)}, \
+    [1][2] = {.first = 4U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M33S)}, \
+    [2][0] = {.first = 6U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P0)}, \
+    [2][1] = {.first = 8U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P0)}, \
+    [2][2] = {.first = 10U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P0)}, \
+    [3][0] = {.first = 12U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1)}, \
+    [3][1] = {.first = 14U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1)}, \
+    [3][2] = {.first = 16U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P1)}, \
+    [4][0] = {.first = 18U, .num = 6U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P)}, \
+    [4][1] = {.first = 24U, .num = 6U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P)}, \
+    [4][2] = {.first = 30U, .num = 6U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P)},
+
 /*--------------------------------------------------------------------------*/
 /* LM Fault Lists                                                           */
 /*--------------------------------------------------------------------------*/
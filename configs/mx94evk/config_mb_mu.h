@@ -155,6 +155,15 @@
     SM_MB_MU1_CONFIG, \
     SM_MB_MU3_CONFIG
 
+/*! Config data for MU to MB instance map (instance + 1) */
+#define SM_MB_MU_MAP_DATA \
+    [1U] = 5U, \
+    [3U] = 6U, \
+    [9U] = 3U, \
+    [13U] = 4U, \
+    [15U] = 1U, \
+    [17U] = 2U
+
 #endif /* CONFIG_MB_MU_H */
 
 /** @} */
@@ -65,267 +65,140 @@
         SM_CFG_W1(0x00000840U), 0xB0000013U, \
         SM_CFG_W1(0x00000860U), 0xB0000013U, \
         SM_CFG_W1(0x00000880U), 0xB0000053U, \
-        SM_CFG_W1(0x000008a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008c0U), 0xB0000014U, \
-        SM_CFG_W1(0x000008e0U), 0xB000001EU, \
+        SM_CFG_W1(0x000008A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008C0U), 0xB0000014U, \
+        SM_CFG_W1(0x000008E0U), 0xB000001EU, \
         SM_CFG_W1(0x00000900U), 0xB000001DU, \
         SM_CFG_W1(0x00000920U), 0xB000001DU, \
-        SM_CFG_W1(0x00000a00U), 0x90000002U, \
-        SM_CFG_W1(0x00000a04U), 0x90000002U, \
-        SM_CFG_W1(0x00000a08U), 0x90000002U, \
-        SM_CFG_W1(0x00000a20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000aa0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ac0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ae0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ba0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000bc0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000be0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ca0U), 0xB00000A1U, \
-        SM_CFG_W1(0x00000cc0U), 0xB00000A1U, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x0001002cU), 0x6600U, \
-        SM_CFG_W1(0x00010030U), 0x4444U, \
-        SM_CFG_Z1(0x00010050U), \
-        SM_CFG_Z1(0x00010054U), \
-        SM_CFG_W1(0x00010064U), 0x00000003U, \
-        SM_CFG_W1(0x00010068U), 0x00000003U, \
+        SM_CFG_FN(0x00000A00U, 3U), 0x90000002U, \
+        SM_CFG_W1(0x00000A20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000CA0U), 0xB00000A1U, \
+        SM_CFG_W1(0x00000CC0U), 0xB00000A1U, \
+        SM_CFG_WN(0x00010024U, 4U), \
+            0x6666U, 0x7777U, 0x6600U, 0x4444U, \
+        SM_CFG_ZN(0x00010050U, 2U), \
+        SM_CFG_WN(0x00010064U, 2U), \
+            0x00000003U, 0x00000003U, \
         SM_CFG_W1(0x00010180U), 0x000000C0U, \
-        SM_CFG_Z1(0x00010250U), \
-        SM_CFG_Z1(0x00010254U), \
+        SM_CFG_ZN(0x00010250U, 2U), \
         SM_CFG_W1(0x00010264U), 0x00000900U, \
         SM_CFG_W1(0x00010380U), 0x000000C0U, \
-        SM_CFG_W1(0x00010450U), 0x30003330U, \
-        SM_CFG_W1(0x00010454U), 0x03333033U, \
-        SM_CFG_W1(0x00010458U), 0x00030000U, \
-        SM_CFG_W1(0x0001045cU), 0x33330030U, \
-        SM_CFG_W1(0x00010460U), 0x33333333U, \
-        SM_CFG_W1(0x00010464U), 0x30000003U, \
-        SM_CFG_W1(0x00010468U), 0x33330030U, \
-        SM_CFG_W1(0x0001046cU), 0x33333333U, \
-        SM_CFG_W1(0x00010470U), 0x33333333U, \
-        SM_CFG_W1(0x00010474U), 0x03003000U, \
-        SM_CFG_W1(0x00010478U), 0x03333333U, \
+        SM_CFG_WN(0x00010450U, 11U), \
+            0x30003330U, 0x03333033U, 0x00030000U, 0x33330030U, \
+            0x33333333U, 0x30000003U, 0x33330030U, 0x33333333U, \
+            0x33333333U, 0x03003000U, 0x03333333U, \
         SM_CFG_W1(0x00010580U), 0x000003C0U, \
-        SM_CFG_W1(0x000105a8U), 0x00000003U, \
-        SM_CFG_W1(0x00010640U), 0x99999999U, \
-        SM_CFG_W1(0x00010644U), 0x99999999U, \
-        SM_CFG_W1(0x00010648U), 0x99999999U, \
-        SM_CFG_W1(0x0001064cU), 0x99999999U, \
-        SM_CFG_W1(0x00010650U), 0x09000309U, \
-        SM_CFG_W1(0x00010654U), 0x0000C900U, \
-        SM_CFG_W1(0x00010658U), 0x99909000U, \
-        SM_CFG_W1(0x0001065cU), 0x00009009U, \
-        SM_CFG_W1(0x00010668U), 0x00009900U, \
-        SM_CFG_W1(0x0001066cU), 0x90909000U, \
-        SM_CFG_W1(0x00010670U), 0x00009000U, \
-        SM_CFG_W1(0x00010674U), 0x00000900U, \
+        SM_CFG_W1(0x000105A8U), 0x00000003U, \
+        SM_CFG_FN(0x00010640U, 4U), 0x99999999U, \
+        SM_CFG_WN(0x00010650U, 4U), \
+            0x09000309U, 0x0000C900U, 0x99909000U, 0x00009009U, \
+        SM_CFG_WN(0x00010668U, 4U), \
+            0x00009900U, 0x90909000U, 0x00009000U, 0x00000900U, \
         SM_CFG_W1(0x00010780U), 0x099330C0U, \
-        SM_CFG_Z1(0x00010850U), \
-        SM_CFG_W1(0x00010854U), 0x9000C000U, \
-        SM_CFG_W1(0x00010858U), 0x00000099U, \
-        SM_CFG_W1(0x0001085cU), 0x00000900U, \
-        SM_CFG_W1(0x00010870U), 0x00000090U, \
-        SM_CFG_W1(0x00010874U), 0x00000009U, \
+        SM_CFG_WN(0x00010850U, 4U), \
+            0x00000000U, 0x9000C000U, 0x00000099U, 0x00000900U, \
+        SM_CFG_WN(0x00010870U, 2U), \
+            0x00000090U, 0x00000009U, \
         SM_CFG_W1(0x00010980U), 0x900000C0U, \
-        SM_CFG_Z1(0x00010a50U), \
-        SM_CFG_Z1(0x00010a54U), \
-        SM_CFG_W1(0x00010b80U), 0x000000C0U, \
-        SM_CFG_Z1(0x00010c50U), \
-        SM_CFG_Z1(0x00010c54U), \
-        SM_CFG_W1(0x00010d80U), 0x000000C0U, \
-        SM_CFG_Z1(0x00010e50U), \
-        SM_CFG_Z1(0x00010e54U), \
-        SM_CFG_W1(0x00010f80U), 0x000000C0U, \
-        SM_CFG_Z1(0x00011050U), \
-        SM_CFG_Z1(0x00011054U), \
+        SM_CFG_ZN(0x00010A50U, 2U), \
+        SM_CFG_W1(0x00010B80U), 0x000000C0U, \
+        SM_CFG_ZN(0x00010C50U, 2U), \
+        SM_CFG_W1(0x00010D80U), 0x000000C0U, \
+        SM_CFG_ZN(0x00010E50U, 2U), \
+        SM_CFG_W1(0x00010F80U), 0x000000C0U, \
+        SM_CFG_ZN(0x00011050U, 2U), \
         SM_CFG_W1(0x00011064U), 0x09999000U, \
         SM_CFG_W1(0x00011180U), 0x000000C0U, \
-        SM_CFG_W1(0x00011240U), 0x99999999U, \
-        SM_CFG_W1(0x00011244U), 0x99999999U, \
-        SM_CFG_W1(0x00011248U), 0x99999999U, \
-        SM_CFG_W1(0x0001124cU), 0x99999999U, \
+        SM_CFG_FN(0x00011240U, 4U), 0x99999999U, \
         SM_CFG_W1(0x00011250U), 0x99009999U, \
-        SM_CFG_W1(0x00011254U), 0x99999999U, \
-        SM_CFG_W1(0x00011258U), 0x99999999U, \
-        SM_CFG_W1(0x0001125cU), 0x99999999U, \
-        SM_CFG_W1(0x00011260U), 0x99999999U, \
+        SM_CFG_FN(0x00011254U, 4U), 0x99999999U, \
         SM_CFG_W1(0x00011264U), 0x99999909U, \
-        SM_CFG_W1(0x00011268U), 0x99999999U, \
-        SM_CFG_W1(0x0001126cU), 0x99999999U, \
-        SM_CFG_W1(0x00011270U), 0x99999999U, \
-        SM_CFG_W1(0x00011274U), 0x99009999U, \
-        SM_CFG_W1(0x00011278U), 0x99999999U, \
-        SM_CFG_W1(0x00011380U), 0x99999990U, \
-        SM_CFG_W1(0x00011384U), 0x00000999U, \
-        SM_CFG_W1(0x000113a8U), 0x00000009U, \
-        SM_CFG_Z1(0x00011450U), \
-        SM_CFG_Z1(0x00011454U), \
+        SM_CFG_FN(0x00011268U, 3U), 0x99999999U, \
+        SM_CFG_WN(0x00011274U, 2U), \
+            0x99009999U, 0x99999999U, \
+        SM_CFG_WN(0x00011380U, 2U), \
+            0x99999990U, 0x00000999U, \
+        SM_CFG_W1(0x000113A8U), 0x00000009U, \
+        SM_CFG_ZN(0x00011450U, 2U), \
         SM_CFG_W1(0x00011580U), 0x000000C0U, \
-        SM_CFG_Z1(0x00011650U), \
-        SM_CFG_Z1(0x00011654U), \
+        SM_CFG_ZN(0x00011650U, 2U), \
         SM_CFG_W1(0x00011780U), 0x000000C0U, \
-        SM_CFG_Z1(0x00011850U), \
-        SM_CFG_Z1(0x00011854U), \
+        SM_CFG_ZN(0x00011850U, 2U), \
         SM_CFG_W1(0x00011980U), 0x000000C0U, \
-        SM_CFG_Z1(0x00011a50U), \
-        SM_CFG_W1(0x00011a54U), 0x0000C000U, \
-        SM_CFG_W1(0x00011a78U), 0x90090900U, \
-        SM_CFG_W1(0x00011b80U), 0x000000C0U, \
-        SM_CFG_W1(0x00011b84U), 0x00000990U, \
-        SM_CFG_Z1(0x00011c50U), \
-        SM_CFG_W1(0x00011c54U), 0x0000C000U, \
-        SM_CFG_W1(0x00011c58U), 0x00000900U, \
-        SM_CFG_W1(0x00011c74U), 0x90000090U, \
-        SM_CFG_W1(0x00011c78U), 0x00000009U, \
-        SM_CFG_W1(0x00011d80U), 0x000000C0U, \
-        SM_CFG_W1(0x00011d84U), 0x00000009U, \
-        SM_CFG_Z1(0x00011e50U), \
-        SM_CFG_Z1(0x00011e54U), \
-        SM_CFG_W1(0x00011f80U), 0x000000C0U, \
-        SM_CFG_W1(0x00012024U), 0x6666U, \
-        SM_CFG_W1(0x00012028U), 0x7777U, \
-        SM_CFG_W1(0x0001202cU), 0x7700U, \
-        SM_CFG_W1(0x00012180U), 0x99999999U, \
-        SM_CFG_W1(0x00012184U), 0x99999999U, \
-        SM_CFG_W1(0x00012188U), 0x99999999U, \
-        SM_CFG_W1(0x0001218cU), 0x99999999U, \
-        SM_CFG_Z1(0x00012240U), \
-        SM_CFG_Z1(0x00012244U), \
-        SM_CFG_Z1(0x00012248U), \
-        SM_CFG_Z1(0x0001224cU), \
-        SM_CFG_Z1(0x00012380U), \
-        SM_CFG_Z1(0x00012384U), \
-        SM_CFG_Z1(0x00012388U), \
-        SM_CFG_Z1(0x0001238cU), \
-        SM_CFG_W1(0x00012440U), 0x33333333U, \
-        SM_CFG_W1(0x00012444U), 0x33333333U, \
-        SM_CFG_W1(0x00012448U), 0x33333333U, \
-        SM_CFG_W1(0x0001244cU), 0x33333333U, \
-        SM_CFG_W1(0x00012580U), 0x33333333U, \
-        SM_CFG_W1(0x00012584U), 0x33333333U, \
-        SM_CFG_W1(0x00012588U), 0x33333333U, \
-        SM_CFG_W1(0x0001258cU), 0x33333333U, \
-        SM_CFG_Z1(0x00012640U), \
-        SM_CFG_Z1(0x00012644U), \
-        SM_CFG_Z1(0x00012648U), \
-        SM_CFG_Z1(0x0001264cU), \
-        SM_CFG_Z1(0x00012780U), \
-        SM_CFG_Z1(0x00012784U), \
-        SM_CFG_Z1(0x00012788U), \
-        SM_CFG_Z1(0x0001278cU), \
-        SM_CFG_Z1(0x00012840U), \
-        SM_CFG_Z1(0x00012844U), \
-        SM_CFG_Z1(0x00012848U), \
-        SM_CFG_Z1(0x0001284cU), \
-        SM_CFG_Z1(0x00012980U), \
-        SM_CFG_Z1(0x00012984U), \
-        SM_CFG_Z1(0x00012988U), \
-        SM_CFG_Z1(0x0001298cU), \
-        SM_CFG_Z1(0x00012a40U), \
-        SM_CFG_Z1(0x00012a44U), \
-        SM_CFG_Z1(0x00012a48U), \
-        SM_CFG_Z1(0x00012a4cU), \
-        SM_CFG_Z1(0x00012b80U), \
-        SM_CFG_Z1(0x00012b84U), \
-        SM_CFG_Z1(0x00012b88U), \
-        SM_CFG_Z1(0x00012b8cU), \
-        SM_CFG_Z1(0x00012c40U), \
-        SM_CFG_Z1(0x00012c44U), \
-        SM_CFG_Z1(0x00012c48U), \
-        SM_CFG_Z1(0x00012c4cU), \
-        SM_CFG_Z1(0x00012d80U), \
-        SM_CFG_Z1(0x00012d84U), \
-        SM_CFG_Z1(0x00012d88U), \
-        SM_CFG_Z1(0x00012d8cU), \
-        SM_CFG_Z1(0x00012e40U), \
-        SM_CFG_Z1(0x00012e44U), \
-        SM_CFG_Z1(0x00012e48U), \
-        SM_CFG_Z1(0x00012e4cU), \
-        SM_CFG_Z1(0x00012f80U), \
-        SM_CFG_Z1(0x00012f84U), \
-        SM_CFG_Z1(0x00012f88U), \
-        SM_CFG_Z1(0x00012f8cU), \
-        SM_CFG_Z1(0x00013040U), \
-        SM_CFG_Z1(0x00013044U), \
-        SM_CFG_Z1(0x00013048U), \
-        SM_CFG_Z1(0x0001304cU), \
-        SM_CFG_Z1(0x00013180U), \
-        SM_CFG_Z1(0x00013184U), \
-        SM_CFG_Z1(0x00013188U), \
-        SM_CFG_Z1(0x0001318cU), \
-        SM_CFG_W1(0x00013240U), 0x99999999U, \
-        SM_CFG_W1(0x00013244U), 0x99999999U, \
-        SM_CFG_W1(0x00013248U), 0x99999999U, \
-        SM_CFG_W1(0x0001324cU), 0x99999999U, \
-        SM_CFG_W1(0x00013380U), 0x99999999U, \
-        SM_CFG_W1(0x00013384U), 0x99999999U, \
-        SM_CFG_W1(0x00013388U), 0x99999999U, \
-        SM_CFG_W1(0x0001338cU), 0x99999999U, \
-        SM_CFG_Z1(0x00013440U), \
-        SM_CFG_Z1(0x00013444U), \
-        SM_CFG_Z1(0x00013448U), \
-        SM_CFG_Z1(0x0001344cU), \
-        SM_CFG_Z1(0x00013580U), \
-        SM_CFG_Z1(0x00013584U), \
-        SM_CFG_Z1(0x00013588U), \
-        SM_CFG_Z1(0x0001358cU), \
-        SM_CFG_Z1(0x00013640U), \
-        SM_CFG_Z1(0x00013644U), \
-        SM_CFG_Z1(0x00013648U), \
-        SM_CFG_Z1(0x0001364cU), \
-        SM_CFG_Z1(0x00013780U), \
-        SM_CFG_Z1(0x00013784U), \
-        SM_CFG_Z1(0x00013788U), \
-        SM_CFG_Z1(0x0001378cU), \
-        SM_CFG_Z1(0x00013840U), \
-        SM_CFG_Z1(0x00013844U), \
-        SM_CFG_Z1(0x00013848U), \
-        SM_CFG_Z1(0x0001384cU), \
-        SM_CFG_Z1(0x00013980U), \
-        SM_CFG_Z1(0x00013984U), \
-        SM_CFG_Z1(0x00013988U), \
-        SM_CFG_Z1(0x0001398cU), \
-        SM_CFG_Z1(0x00013a40U), \
-        SM_CFG_Z1(0x00013a44U), \
-        SM_CFG_Z1(0x00013a48U), \
-        SM_CFG_Z1(0x00013a4cU), \
-        SM_CFG_Z1(0x00013b80U), \
-        SM_CFG_Z1(0x00013b84U), \
-        SM_CFG_Z1(0x00013b88U), \
-        SM_CFG_Z1(0x00013b8cU), \
-        SM_CFG_Z1(0x00013c40U), \
-        SM_CFG_Z1(0x00013c44U), \
-        SM_CFG_Z1(0x00013c48U), \
-        SM_CFG_Z1(0x00013c4cU), \
-        SM_CFG_Z1(0x00013d80U), \
-        SM_CFG_Z1(0x00013d84U), \
-        SM_CFG_Z1(0x00013d88U), \
-        SM_CFG_Z1(0x00013d8cU), \
+        SM_CFG_WN(0x00011A50U, 2U), \
+            0x00000000U, 0x0000C000U, \
+        SM_CFG_W1(0x00011A78U), 0x90090900U, \
+        SM_CFG_WN(0x00011B80U, 2U), \
+            0x000000C0U, 0x00000990U, \
+        SM_CFG_WN(0x00011C50U, 3U), \
+            0x00000000U, 0x0000C000U, 0x00000900U, \
+        SM_CFG_WN(0x00011C74U, 2U), \
+            0x90000090U, 0x00000009U, \
+        SM_CFG_WN(0x00011D80U, 2U), \
+            0x000000C0U, 0x00000009U, \
+        SM_CFG_ZN(0x00011E50U, 2U), \
+        SM_CFG_W1(0x00011F80U), 0x000000C0U, \
+        SM_CFG_WN(0x00012024U, 3U), \
+            0x6666U, 0x7777U, 0x7700U, \
+        SM_CFG_FN(0x00012180U, 4U), 0x99999999U, \
+        SM_CFG_ZN(0x00012240U, 4U), \
+        SM_CFG_ZN(0x00012380U, 4U), \
+        SM_CFG_FN(0x00012440U, 4U), 0x33333333U, \
+        SM_CFG_FN(0x00012580U, 4U), 0x33333333U, \
+        SM_CFG_ZN(0x00012640U, 4U), \
+        SM_CFG_ZN(0x00012780U, 4U), \
+        SM_CFG_ZN(0x00012840U, 4U), \
+        SM_CFG_ZN(0x00012980U, 4U), \
+        SM_CFG_ZN(0x00012A40U, 4U), \
+        SM_CFG_ZN(0x00012B80U, 4U), \
+        SM_CFG_ZN(0x00012C40U, 4U), \
+        SM_CFG_ZN(0x00012D80U, 4U), \
+        SM_CFG_ZN(0x00012E40U, 4U), \
+        SM_CFG_ZN(0x00012F80U, 4U), \
+        SM_CFG_ZN(0x00013040U, 4U), \
+        SM_CFG_ZN(0x00013180U, 4U), \
+        SM_CFG_FN(0x00013240U, 4U), 0x99999999U, \
+        SM_CFG_FN(0x00013380U, 4U), 0x99999999U, \
+        SM_CFG_ZN(0x00013440U, 4U), \
+        SM_CFG_ZN(0x00013580U, 4U), \
+        SM_CFG_ZN(0x00013640U, 4U), \
+        SM_CFG_ZN(0x00013780U, 4U), \
+        SM_CFG_ZN(0x00013840U, 4U), \
+        SM_CFG_ZN(0x00013980U, 4U), \
+        SM_CFG_ZN(0x00013A40U, 4U), \
+        SM_CFG_ZN(0x00013B80U, 4U), \
+        SM_CFG_ZN(0x00013C40U, 4U), \
+        SM_CFG_ZN(0x00013D80U, 4U), \
         SM_CFG_W1(0x00014024U), 0x6666U, \
-        SM_CFG_Z1(0x00014240U), \
-        SM_CFG_W1(0x00014244U), 0x0003C001U, \
-        SM_CFG_Z1(0x0001424cU), \
+        SM_CFG_WN(0x00014240U, 2U), \
+            0x00000000U, 0x0003C001U, \
+        SM_CFG_Z1(0x0001424CU), \
         SM_CFG_Z1(0x00014254U), \
-        SM_CFG_Z1(0x0001425cU), \
-        SM_CFG_W1(0x00014940U), 0x00000001U, \
-        SM_CFG_W1(0x00014944U), 0x0003C011U, \
-        SM_CFG_Z1(0x0001494cU), \
+        SM_CFG_Z1(0x0001425CU), \
+        SM_CFG_WN(0x00014940U, 2U), \
+            0x00000001U, 0x0003C011U, \
+        SM_CFG_Z1(0x0001494CU), \
         SM_CFG_Z1(0x00014954U), \
-        SM_CFG_Z1(0x0001495cU), \
+        SM_CFG_Z1(0x0001495CU), \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_Z1(0x00012020U), \
         SM_CFG_W1(0x00014020U), 0x7700U, \
@@ -343,9 +216,8 @@
         SM_CFG_W1(0x00000800U), 0xB0000053U, \
         SM_CFG_W1(0x00000820U), 0xB0000053U, \
         SM_CFG_W1(0x00000840U), 0xB0000053U, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x0001002cU), 0x6600U, \
+        SM_CFG_WN(0x00010024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
         SM_CFG_W1(0x00010040U), 0x00003000U, \
         SM_CFG_W1(0x00010180U), 0x00003000U, \
         SM_CFG_W1(0x00010240U), 0x00000900U, \
@@ -354,40 +226,36 @@
         SM_CFG_W1(0x00010448U), 0x00300000U, \
         SM_CFG_W1(0x00010580U), 0x03330000U, \
         SM_CFG_W1(0x00010588U), 0x00300000U, \
-        SM_CFG_W1(0x00010640U), 0x00000090U, \
-        SM_CFG_W1(0x00010644U), 0x00090000U, \
-        SM_CFG_W1(0x00010648U), 0x00099990U, \
-        SM_CFG_W1(0x00010780U), 0x00000090U, \
-        SM_CFG_W1(0x00010784U), 0x00090000U, \
-        SM_CFG_W1(0x00010788U), 0x00099990U, \
+        SM_CFG_WN(0x00010640U, 3U), \
+            0x00000090U, 0x00090000U, 0x00099990U, \
+        SM_CFG_WN(0x00010780U, 3U), \
+            0x00000090U, 0x00090000U, 0x00099990U, \
         SM_CFG_Z1(0x00010840U), \
         SM_CFG_Z1(0x00010980U), \
-        SM_CFG_Z1(0x00010a40U), \
-        SM_CFG_Z1(0x00010b80U), \
-        SM_CFG_Z1(0x00010c40U), \
-        SM_CFG_Z1(0x00010d80U), \
-        SM_CFG_Z1(0x00010e40U), \
-        SM_CFG_Z1(0x00010f80U), \
+        SM_CFG_Z1(0x00010A40U), \
+        SM_CFG_Z1(0x00010B80U), \
+        SM_CFG_Z1(0x00010C40U), \
+        SM_CFG_Z1(0x00010D80U), \
+        SM_CFG_Z1(0x00010E40U), \
+        SM_CFG_Z1(0x00010F80U), \
         SM_CFG_W1(0x00011040U), 0x00000009U, \
         SM_CFG_W1(0x00011180U), 0x00000009U, \
-        SM_CFG_W1(0x00011240U), 0x09999999U, \
-        SM_CFG_W1(0x00011244U), 0x00090000U, \
-        SM_CFG_W1(0x00011248U), 0x00999990U, \
-        SM_CFG_W1(0x00011380U), 0x09999999U, \
-        SM_CFG_W1(0x00011384U), 0x00090000U, \
-        SM_CFG_W1(0x00011388U), 0x00999990U, \
+        SM_CFG_WN(0x00011240U, 3U), \
+            0x09999999U, 0x00090000U, 0x00999990U, \
+        SM_CFG_WN(0x00011380U, 3U), \
+            0x09999999U, 0x00090000U, 0x00999990U, \
         SM_CFG_Z1(0x00011440U), \
         SM_CFG_Z1(0x00011580U), \
         SM_CFG_Z1(0x00011640U), \
         SM_CFG_Z1(0x00011780U), \
         SM_CFG_Z1(0x00011840U), \
         SM_CFG_Z1(0x00011980U), \
-        SM_CFG_Z1(0x00011a40U), \
-        SM_CFG_Z1(0x00011b80U), \
-        SM_CFG_Z1(0x00011c40U), \
-        SM_CFG_Z1(0x00011d80U), \
-        SM_CFG_Z1(0x00011e40U), \
-        SM_CFG_Z1(0x00011f80U), \
+        SM_CFG_Z1(0x00011A40U), \
+        SM_CFG_Z1(0x00011B80U), \
+        SM_CFG_Z1(0x00011C40U), \
+        SM_CFG_Z1(0x00011D80U), \
+        SM_CFG_Z1(0x00011E40U), \
+        SM_CFG_Z1(0x00011F80U), \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_C1(0x00000000U), 0x0000C001U, \
         SM_CFG_END \
@@ -405,50 +273,43 @@
         SM_CFG_W1(0x00000840U), 0xA8800053U, \
         SM_CFG_W1(0x00000860U), 0xA8C00053U, \
         SM_CFG_W1(0x00000880U), 0xA9000053U, \
-        SM_CFG_W1(0x000008a0U), 0xA9400053U, \
-        SM_CFG_W1(0x000008c0U), 0xA9800053U, \
-        SM_CFG_W1(0x000008e0U), 0xA9C00053U, \
+        SM_CFG_W1(0x000008A0U), 0xA9400053U, \
+        SM_CFG_W1(0x000008C0U), 0xA9800053U, \
+        SM_CFG_W1(0x000008E0U), 0xA9C00053U, \
         SM_CFG_W1(0x00000900U), 0xAA000053U, \
         SM_CFG_W1(0x00000920U), 0xAA400053U, \
         SM_CFG_W1(0x00000940U), 0xAA800053U, \
         SM_CFG_W1(0x00000960U), 0xAAC00053U, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x0001002cU), 0x6600U, \
-        SM_CFG_W1(0x000101a8U), 0x00003000U, \
-        SM_CFG_W1(0x000103a8U), 0x00000900U, \
-        SM_CFG_W1(0x000105a8U), 0x00330000U, \
-        SM_CFG_W1(0x00010640U), 0x99999999U, \
-        SM_CFG_W1(0x00010644U), 0x99999999U, \
-        SM_CFG_W1(0x00010648U), 0x99999999U, \
-        SM_CFG_W1(0x0001064cU), 0x99999999U, \
-        SM_CFG_W1(0x00010650U), 0x99999990U, \
-        SM_CFG_W1(0x00010654U), 0x00099999U, \
+        SM_CFG_WN(0x00010024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
+        SM_CFG_W1(0x000101A8U), 0x00003000U, \
+        SM_CFG_W1(0x000103A8U), 0x00000900U, \
+        SM_CFG_W1(0x000105A8U), 0x00330000U, \
+        SM_CFG_FN(0x00010640U, 4U), 0x99999999U, \
+        SM_CFG_WN(0x00010650U, 2U), \
+            0x99999990U, 0x00099999U, \
         SM_CFG_W1(0x00010780U), 0x99999999U, \
-        SM_CFG_W1(0x000107a8U), 0x00000090U, \
-        SM_CFG_W1(0x000107acU), 0x00000900U, \
-        SM_CFG_W1(0x000107d0U), 0x00000009U, \
-        SM_CFG_Z1(0x000109a8U), \
-        SM_CFG_Z1(0x00010ba8U), \
-        SM_CFG_Z1(0x00010da8U), \
-        SM_CFG_Z1(0x00010fa8U), \
-        SM_CFG_W1(0x000111a8U), 0x00000009U, \
-        SM_CFG_W1(0x00011240U), 0x99999999U, \
-        SM_CFG_W1(0x00011244U), 0x99999999U, \
-        SM_CFG_W1(0x00011248U), 0x99999999U, \
-        SM_CFG_W1(0x0001124cU), 0x99999999U, \
-        SM_CFG_W1(0x00011250U), 0x99999990U, \
-        SM_CFG_W1(0x00011254U), 0x00099999U, \
+        SM_CFG_WN(0x000107A8U, 2U), \
+            0x00000090U, 0x00000900U, \
+        SM_CFG_W1(0x000107D0U), 0x00000009U, \
+        SM_CFG_Z1(0x000109A8U), \
+        SM_CFG_Z1(0x00010BA8U), \
+        SM_CFG_Z1(0x00010DA8U), \
+        SM_CFG_Z1(0x00010FA8U), \
+        SM_CFG_W1(0x000111A8U), 0x00000009U, \
+        SM_CFG_FN(0x00011240U, 4U), 0x99999999U, \
+        SM_CFG_WN(0x00011250U, 2U), \
+            0x99999990U, 0x00099999U, \
         SM_CFG_W1(0x00011380U), 0x99999999U, \
-        SM_CFG_W1(0x000113a8U), 0x00999999U, \
-        SM_CFG_W1(0x000113acU), 0x00000900U, \
-        SM_CFG_W1(0x000113d0U), 0x00000009U, \
-        SM_CFG_Z1(0x000115a8U), \
-        SM_CFG_Z1(0x000117a8U), \
-        SM_CFG_Z1(0x000119a8U), \
-        SM_CFG_Z1(0x00011ba8U), \
-        SM_CFG_Z1(0x00011da8U), \
-        SM_CFG_Z1(0x00011fa8U), \
+        SM_CFG_WN(0x000113A8U, 2U), \
+            0x00999999U, 0x00000900U, \
+        SM_CFG_W1(0x000113D0U), 0x00000009U, \
+        SM_CFG_Z1(0x000115A8U), \
+        SM_CFG_Z1(0x000117A8U), \
+        SM_CFG_Z1(0x000119A8U), \
+        SM_CFG_Z1(0x00011BA8U), \
+        SM_CFG_Z1(0x00011DA8U), \
+        SM_CFG_Z1(0x00011FA8U), \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_C1(0x00000000U), 0x0000C001U, \
         SM_CFG_END \
@@ -466,70 +327,61 @@
         SM_CFG_W1(0x00000840U), 0xB0000053U, \
         SM_CFG_W1(0x00000860U), 0xB0000053U, \
         SM_CFG_W1(0x00000880U), 0xB0000053U, \
-        SM_CFG_W1(0x000008a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008e0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008E0U), 0xB0000053U, \
         SM_CFG_W1(0x00000900U), 0xB0000053U, \
         SM_CFG_W1(0x00000920U), 0xB0000053U, \
         SM_CFG_W1(0x00000940U), 0xB0000053U, \
         SM_CFG_W1(0x00000960U), 0xB0000053U, \
         SM_CFG_W1(0x00000980U), 0xB0000053U, \
-        SM_CFG_W1(0x000009a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009e0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a20U), 0xB0000053U, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x0001002cU), 0x6600U, \
-        SM_CFG_W1(0x000101a8U), 0x00003000U, \
-        SM_CFG_W1(0x000103a8U), 0x00000900U, \
-        SM_CFG_W1(0x000105a8U), 0x03330000U, \
-        SM_CFG_W1(0x00010640U), 0x99999999U, \
-        SM_CFG_W1(0x00010644U), 0x99999999U, \
-        SM_CFG_W1(0x00010780U), 0x99999999U, \
-        SM_CFG_W1(0x00010784U), 0x99999999U, \
-        SM_CFG_W1(0x000107a8U), 0x90000090U, \
-        SM_CFG_W1(0x000107d0U), 0x99999999U, \
-        SM_CFG_W1(0x000107d4U), 0x99999999U, \
-        SM_CFG_W1(0x000107d8U), 0x99999999U, \
-        SM_CFG_Z1(0x000109a8U), \
-        SM_CFG_Z1(0x00010ba8U), \
-        SM_CFG_Z1(0x00010da8U), \
-        SM_CFG_Z1(0x00010fa8U), \
-        SM_CFG_W1(0x000111a8U), 0x00000009U, \
-        SM_CFG_W1(0x00011240U), 0x99999999U, \
-        SM_CFG_W1(0x00011244U), 0x99999999U, \
-        SM_CFG_W1(0x00011380U), 0x99999999U, \
-        SM_CFG_W1(0x00011384U), 0x99999999U, \
-        SM_CFG_W1(0x000113a8U), 0x99999999U, \
-        SM_CFG_W1(0x000113d0U), 0x99999999U, \
-        SM_CFG_W1(0x000113d4U), 0x99999999U, \
-        SM_CFG_W1(0x000113d8U), 0x99999999U, \
-        SM_CFG_Z1(0x000115a8U), \
-        SM_CFG_Z1(0x000117a8U), \
-        SM_CFG_Z1(0x000119a8U), \
-        SM_CFG_Z1(0x00011ba8U), \
-        SM_CFG_Z1(0x00011da8U), \
-        SM_CFG_Z1(0x00011fa8U), \
-        SM_CFG_W1(0x00012024U), 0x6666U, \
-        SM_CFG_W1(0x00012028U), 0x7777U, \
+        SM_CFG_W1(0x000009A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009E0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A20U), 0xB0000053U, \
+        SM_CFG_WN(0x00010024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
+        SM_CFG_W1(0x000101A8U), 0x00003000U, \
+        SM_CFG_W1(0x000103A8U), 0x00000900U, \
+        SM_CFG_W1(0x000105A8U), 0x03330000U, \
+        SM_CFG_WN(0x00010640U, 2U), \
+            0x99999999U, 0x99999999U, \
+        SM_CFG_WN(0x00010780U, 2U), \
+            0x99999999U, 0x99999999U, \
+        SM_CFG_W1(0x000107A8U), 0x90000090U, \
+        SM_CFG_FN(0x000107D0U, 3U), 0x99999999U, \
+        SM_CFG_Z1(0x000109A8U), \
+        SM_CFG_Z1(0x00010BA8U), \
+        SM_CFG_Z1(0x00010DA8U), \
+        SM_CFG_Z1(0x00010FA8U), \
+        SM_CFG_W1(0x000111A8U), 0x00000009U, \
+        SM_CFG_WN(0x00011240U, 2U), \
+            0x99999999U, 0x99999999U, \
+        SM_CFG_WN(0x00011380U, 2U), \
+            0x99999999U, 0x99999999U, \
+        SM_CFG_W1(0x000113A8U), 0x99999999U, \
+        SM_CFG_FN(0x000113D0U, 3U), 0x99999999U, \
+        SM_CFG_Z1(0x000115A8U), \
+        SM_CFG_Z1(0x000117A8U), \
+        SM_CFG_Z1(0x000119A8U), \
+        SM_CFG_Z1(0x00011BA8U), \
+        SM_CFG_Z1(0x00011DA8U), \
+        SM_CFG_Z1(0x00011FA8U), \
+        SM_CFG_WN(0x00012024U, 2U), \
+            0x6666U, 0x7777U, \
         SM_CFG_W1(0x00012640U), 0x00099999U, \
         SM_CFG_W1(0x00012780U), 0x00099999U, \
-        SM_CFG_W1(0x000127a8U), 0x00099999U, \
-        SM_CFG_W1(0x000127d0U), 0x00099999U, \
+        SM_CFG_W1(0x000127A8U), 0x00099999U, \
+        SM_CFG_W1(0x000127D0U), 0x00099999U, \
         SM_CFG_W1(0x00013240U), 0x00099999U, \
         SM_CFG_W1(0x00013380U), 0x00099999U, \
-        SM_CFG_W1(0x000133a8U), 0x00099999U, \
-        SM_CFG_W1(0x000133d0U), 0x00099999U, \
-        SM_CFG_W1(0x00014024U), 0x6666U, \
-        SM_CFG_W1(0x00014028U), 0x7777U, \
-        SM_CFG_W1(0x00014640U), 0x99999999U, \
-        SM_CFG_W1(0x00014644U), 0x99999999U, \
-        SM_CFG_W1(0x00014648U), 0x99999999U, \
-        SM_CFG_W1(0x00015240U), 0x99999999U, \
-        SM_CFG_W1(0x00015244U), 0x99999999U, \
-        SM_CFG_W1(0x00015248U), 0x99999999U, \
+        SM_CFG_W1(0x000133A8U), 0x00099999U, \
+        SM_CFG_W1(0x000133D0U), 0x00099999U, \
+        SM_CFG_WN(0x00014024U, 2U), \
+            0x6666U, 0x7777U, \
+        SM_CFG_FN(0x00014640U, 3U), 0x99999999U, \
+        SM_CFG_FN(0x00015240U, 3U), 0x99999999U, \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_Z1(0x00012020U), \
         SM_CFG_Z1(0x00014020U), \
@@ -549,50 +401,50 @@
         SM_CFG_W1(0x00000840U), 0xB0000053U, \
         SM_CFG_W1(0x00000860U), 0xB0000053U, \
         SM_CFG_W1(0x00000880U), 0xB0000053U, \
-        SM_CFG_W1(0x000008a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008e0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008E0U), 0xB0000053U, \
         SM_CFG_W1(0x00000900U), 0xB0000053U, \
         SM_CFG_W1(0x00000920U), 0xB0000053U, \
         SM_CFG_W1(0x00000940U), 0xB0000053U, \
         SM_CFG_W1(0x00000960U), 0xB0000053U, \
         SM_CFG_W1(0x00000980U), 0xB0000053U, \
-        SM_CFG_W1(0x000009a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009e0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000aa0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ac0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ae0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ba0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000bc0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000be0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c80U), 0xB00000A8U, \
-        SM_CFG_W1(0x00000ca0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000cc0U), 0xB000001EU, \
-        SM_CFG_W1(0x00000ce0U), 0xB00000A9U, \
-        SM_CFG_W1(0x00000d00U), 0xB00000A9U, \
-        SM_CFG_W1(0x00000d20U), 0xB00000ACU, \
-        SM_CFG_W1(0x00000d40U), 0xB00000ACU, \
-        SM_CFG_W1(0x00000d60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000d80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000da0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000dc0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000de0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000e00U), 0xB0000053U, \
+        SM_CFG_W1(0x000009A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009E0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C80U), 0xB00000A8U, \
+        SM_CFG_W1(0x00000CA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000CC0U), 0xB000001EU, \
+        SM_CFG_W1(0x00000CE0U), 0xB00000A9U, \
+        SM_CFG_W1(0x00000D00U), 0xB00000A9U, \
+        SM_CFG_W1(0x00000D20U), 0xB00000ACU, \
+        SM_CFG_W1(0x00000D40U), 0xB00000ACU, \
+        SM_CFG_W1(0x00000D60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000D80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000DA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000DC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000DE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000E00U), 0xB0000053U, \
         SM_CFG_C1(0x00000000U), 0x0000C001U, \
         SM_CFG_END \
     }
@@ -604,329 +456,225 @@
 /*! Config for TRDC N */
 #define SM_TRDC_N_CONFIG \
     { \
-        SM_CFG_W1(0x00000800U), 0x90008003U, \
-        SM_CFG_W1(0x00000804U), 0x90008003U, \
-        SM_CFG_W1(0x00000808U), 0x90008003U, \
-        SM_CFG_W1(0x0000080cU), 0x90008003U, \
-        SM_CFG_W1(0x00000810U), 0x90008003U, \
-        SM_CFG_W1(0x00000814U), 0x90008003U, \
-        SM_CFG_W1(0x00000820U), 0x90008003U, \
-        SM_CFG_W1(0x00000824U), 0x90008003U, \
-        SM_CFG_W1(0x00000828U), 0x90008003U, \
-        SM_CFG_W1(0x0000082cU), 0x90008003U, \
-        SM_CFG_W1(0x00000830U), 0x90008003U, \
-        SM_CFG_W1(0x00000834U), 0x90008003U, \
-        SM_CFG_W1(0x00000840U), 0x90008003U, \
-        SM_CFG_W1(0x00000844U), 0x90008003U, \
-        SM_CFG_W1(0x00000848U), 0x90008003U, \
-        SM_CFG_W1(0x0000084cU), 0x90008003U, \
-        SM_CFG_W1(0x00000850U), 0x90008003U, \
-        SM_CFG_W1(0x00000854U), 0x90008003U, \
-        SM_CFG_W1(0x00000860U), 0x90008003U, \
-        SM_CFG_W1(0x00000864U), 0x90008003U, \
-        SM_CFG_W1(0x00000868U), 0x90008003U, \
-        SM_CFG_W1(0x0000086cU), 0x90008003U, \
-        SM_CFG_W1(0x00000870U), 0x90008003U, \
-        SM_CFG_W1(0x00000874U), 0x90008003U, \
+        SM_CFG_FN(0x00000800U, 6U), 0x90008003U, \
+        SM_CFG_FN(0x00000820U, 6U), 0x90008003U, \
+        SM_CFG_FN(0x00000840U, 6U), 0x90008003U, \
+        SM_CFG_FN(0x00000860U, 6U), 0x90008003U, \
         SM_CFG_W1(0x00000880U), 0xB0000053U, \
-        SM_CFG_W1(0x000008a0U), 0xB0000053U, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x0001002cU), 0x6600U, \
+        SM_CFG_W1(0x000008A0U), 0xB0000053U, \
+        SM_CFG_WN(0x00010024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
         SM_CFG_W1(0x00010040U), 0x00300000U, \
         SM_CFG_W1(0x00010180U), 0x00300000U, \
-        SM_CFG_W1(0x000101a8U), 0x00003000U, \
-        SM_CFG_W1(0x000101d0U), 0x00003000U, \
+        SM_CFG_W1(0x000101A8U), 0x00003000U, \
+        SM_CFG_W1(0x000101D0U), 0x00003000U, \
         SM_CFG_W1(0x00010240U), 0x00009000U, \
         SM_CFG_W1(0x00010380U), 0x00009000U, \
-        SM_CFG_W1(0x000103a8U), 0x00000900U, \
-        SM_CFG_W1(0x000103d0U), 0x00000900U, \
-        SM_CFG_W1(0x00010440U), 0x33000333U, \
-        SM_CFG_W1(0x00010444U), 0x00003303U, \
+        SM_CFG_W1(0x000103A8U), 0x00000900U, \
+        SM_CFG_W1(0x000103D0U), 0x00000900U, \
+        SM_CFG_WN(0x00010440U, 2U), \
+            0x33000333U, 0x00003303U, \
         SM_CFG_W1(0x00010450U), 0x00000030U, \
-        SM_CFG_W1(0x00010580U), 0x33000333U, \
-        SM_CFG_W1(0x00010584U), 0x00003303U, \
+        SM_CFG_WN(0x00010580U, 2U), \
+            0x33000333U, 0x00003303U, \
         SM_CFG_W1(0x00010590U), 0x00000030U, \
-        SM_CFG_W1(0x000105a8U), 0x00030030U, \
-        SM_CFG_W1(0x000105d0U), 0x00030030U, \
+        SM_CFG_W1(0x000105A8U), 0x00030030U, \
+        SM_CFG_W1(0x000105D0U), 0x00030030U, \
         SM_CFG_Z1(0x00010640U), \
         SM_CFG_W1(0x00010650U), 0x00009900U, \
         SM_CFG_Z1(0x00010780U), \
         SM_CFG_W1(0x00010790U), 0x00009900U, \
         SM_CFG_Z1(0x00010840U), \
         SM_CFG_Z1(0x00010980U), \
-        SM_CFG_Z1(0x00010a40U), \
-        SM_CFG_Z1(0x00010b80U), \
-        SM_CFG_Z1(0x00010c40U), \
-        SM_CFG_Z1(0x00010d80U), \
-        SM_CFG_Z1(0x00010e40U), \
-        SM_CFG_Z1(0x00010f80U), \
+        SM_CFG_Z1(0x00010A40U), \
+        SM_CFG_Z1(0x00010B80U), \
+        SM_CFG_Z1(0x00010C40U), \
+        SM_CFG_Z1(0x00010D80U), \
+        SM_CFG_Z1(0x00010E40U), \
+        SM_CFG_Z1(0x00010F80U), \
         SM_CFG_W1(0x00011040U), 0x00090000U, \
         SM_CFG_W1(0x00011180U), 0x00090000U, \
-        SM_CFG_W1(0x000111a8U), 0x00000009U, \
-        SM_CFG_W1(0x000111d0U), 0x00000009U, \
-        SM_CFG_W1(0x00011240U), 0x99999999U, \
-        SM_CFG_W1(0x00011244U), 0x00009909U, \
+        SM_CFG_W1(0x000111A8U), 0x00000009U, \
+        SM_CFG_W1(0x000111D0U), 0x00000009U, \
+        SM_CFG_WN(0x00011240U, 2U), \
+            0x99999999U, 0x00009909U, \
         SM_CFG_W1(0x00011250U), 0x00009990U, \
-        SM_CFG_W1(0x00011380U), 0x99999999U, \
-        SM_CFG_W1(0x00011384U), 0x00009909U, \
+        SM_CFG_WN(0x00011380U, 2U), \
+            0x99999999U, 0x00009909U, \
         SM_CFG_W1(0x00011390U), 0x00009990U, \
-        SM_CFG_W1(0x000113a8U), 0x00099999U, \
-        SM_CFG_W1(0x000113d0U), 0x00099999U, \
+        SM_CFG_W1(0x000113A8U), 0x00099999U, \
+        SM_CFG_W1(0x000113D0U), 0x00099999U, \
         SM_CFG_Z1(0x00011440U), \
         SM_CFG_Z1(0x00011580U), \
         SM_CFG_Z1(0x00011640U), \
         SM_CFG_Z1(0x00011780U), \
         SM_CFG_Z1(0x00011840U), \
         SM_CFG_Z1(0x00011980U), \
-        SM_CFG_Z1(0x00011a40U), \
-        SM_CFG_Z1(0x00011b80U), \
-        SM_CFG_Z1(0x00011c40U), \
-        SM_CFG_Z1(0x00011d80U), \
-        SM_CFG_Z1(0x00011e40U), \
-        SM_CFG_Z1(0x00011f80U), \
-        SM_CFG_W1(0x00012024U), 0x6666U, \
-        SM_CFG_W1(0x00012028U), 0x7777U, \
-        SM_CFG_W1(0x0001202cU), 0x6600U, \
-        SM_CFG_W1(0x00012440U), 0x33333333U, \
-        SM_CFG_W1(0x00012444U), 0x33333333U, \
-        SM_CFG_W1(0x00012448U), 0x00000333U, \
-        SM_CFG_W1(0x00012580U), 0x33333333U, \
-        SM_CFG_W1(0x00012584U), 0x33333333U, \
-        SM_CFG_W1(0x00012588U), 0x00000333U, \
-        SM_CFG_W1(0x00012640U), 0x99999999U, \
-        SM_CFG_W1(0x00012644U), 0x99999999U, \
-        SM_CFG_W1(0x00012648U), 0x00000999U, \
-        SM_CFG_W1(0x00012780U), 0x99999999U, \
-        SM_CFG_W1(0x00012784U), 0x99999999U, \
-        SM_CFG_W1(0x00012788U), 0x00000999U, \
-        SM_CFG_W1(0x00013240U), 0x99999999U, \
-        SM_CFG_W1(0x00013244U), 0x99999999U, \
-        SM_CFG_W1(0x00013248U), 0x00000999U, \
-        SM_CFG_W1(0x00013380U), 0x99999999U, \
-        SM_CFG_W1(0x00013384U), 0x99999999U, \
-        SM_CFG_W1(0x00013388U), 0x00000999U, \
-        SM_CFG_W1(0x00014024U), 0x6666U, \
-        SM_CFG_W1(0x00014028U), 0x7777U, \
-        SM_CFG_W1(0x0001402cU), 0x7700U, \
-        SM_CFG_W1(0x00014040U), 0x99999999U, \
-        SM_CFG_W1(0x00014044U), 0x99999999U, \
-        SM_CFG_W1(0x00014048U), 0x00999999U, \
-        SM_CFG_W1(0x00014180U), 0x99999999U, \
-        SM_CFG_W1(0x00014184U), 0x99999999U, \
-        SM_CFG_W1(0x00014188U), 0x00999999U, \
-        SM_CFG_Z1(0x00014440U), \
-        SM_CFG_Z1(0x00014444U), \
-        SM_CFG_Z1(0x00014448U), \
-        SM_CFG_Z1(0x00014580U), \
-        SM_CFG_Z1(0x00014584U), \
-        SM_CFG_Z1(0x00014588U), \
-        SM_CFG_W1(0x00014640U), 0x33333333U, \
-        SM_CFG_W1(0x00014644U), 0x33333333U, \
-        SM_CFG_W1(0x00014648U), 0x00AAAAAAU, \
-        SM_CFG_W1(0x00014780U), 0x33333333U, \
-        SM_CFG_W1(0x00014784U), 0x33333333U, \
-        SM_CFG_W1(0x00014788U), 0x00AAAAAAU, \
-        SM_CFG_W1(0x000147a8U), 0x99999999U, \
-        SM_CFG_W1(0x000147acU), 0x99999999U, \
-        SM_CFG_W1(0x000147b0U), 0x00000999U, \
-        SM_CFG_W1(0x000147d0U), 0x99999999U, \
-        SM_CFG_W1(0x000147d4U), 0x99999999U, \
-        SM_CFG_W1(0x000147d8U), 0x00000999U, \
-        SM_CFG_Z1(0x00014840U), \
-        SM_CFG_Z1(0x00014844U), \
-        SM_CFG_Z1(0x00014848U), \
-        SM_CFG_Z1(0x00014980U), \
-        SM_CFG_Z1(0x00014984U), \
-        SM_CFG_Z1(0x00014988U), \
-        SM_CFG_Z1(0x00014a40U), \
-        SM_CFG_Z1(0x00014a44U), \
-        SM_CFG_Z1(0x00014a48U), \
-        SM_CFG_Z1(0x00014b80U), \
-        SM_CFG_Z1(0x00014b84U), \
-        SM_CFG_Z1(0x00014b88U), \
-        SM_CFG_Z1(0x00014c40U), \
-        SM_CFG_Z1(0x00014c44U), \
-        SM_CFG_Z1(0x00014c48U), \
-        SM_CFG_Z1(0x00014d80U), \
-        SM_CFG_Z1(0x00014d84U), \
-        SM_CFG_Z1(0x00014d88U), \
-        SM_CFG_Z1(0x00014e40U), \
-        SM_CFG_Z1(0x00014e44U), \
-        SM_CFG_Z1(0x00014e48U), \
-        SM_CFG_Z1(0x00014f80U), \
-        SM_CFG_Z1(0x00014f84U), \
-        SM_CFG_Z1(0x00014f88U), \
-        SM_CFG_W1(0x00015240U), 0x99999999U, \
-        SM_CFG_W1(0x00015244U), 0x99999999U, \
-        SM_CFG_W1(0x00015248U), 0x00999999U, \
-        SM_CFG_W1(0x00015380U), 0x99999999U, \
-        SM_CFG_W1(0x00015384U), 0x99999999U, \
-        SM_CFG_W1(0x00015388U), 0x00999999U, \
-        SM_CFG_W1(0x000153a8U), 0x99999999U, \
-        SM_CFG_W1(0x000153acU), 0x99999999U, \
-        SM_CFG_W1(0x000153b0U), 0x00000999U, \
-        SM_CFG_W1(0x000153d0U), 0x99999999U, \
-        SM_CFG_W1(0x000153d4U), 0x99999999U, \
-        SM_CFG_W1(0x000153d8U), 0x00000999U, \
-        SM_CFG_Z1(0x00015440U), \
-        SM_CFG_Z1(0x00015444U), \
-        SM_CFG_Z1(0x00015448U), \
-        SM_CFG_Z1(0x00015580U), \
-        SM_CFG_Z1(0x00015584U), \
-        SM_CFG_Z1(0x00015588U), \
-        SM_CFG_Z1(0x00015640U), \
-        SM_CFG_Z1(0x00015644U), \
-        SM_CFG_Z1(0x00015648U), \
-        SM_CFG_Z1(0x00015780U), \
-        SM_CFG_Z1(0x00015784U), \
-        SM_CFG_Z1(0x00015788U), \
-        SM_CFG_Z1(0x00015840U), \
-        SM_CFG_Z1(0x00015844U), \
-        SM_CFG_Z1(0x00015848U), \
-        SM_CFG_Z1(0x00015980U), \
-        SM_CFG_Z1(0x00015984U), \
-        SM_CFG_Z1(0x00015988U), \
-        SM_CFG_Z1(0x00015a40U), \
-        SM_CFG_Z1(0x00015a44U), \
-        SM_CFG_Z1(0x00015a48U), \
-        SM_CFG_Z1(0x00015b80U), \
-        SM_CFG_Z1(0x00015b84U), \
-        SM_CFG_Z1(0x00015b88U), \
-        SM_CFG_Z1(0x00015c40U), \
-        SM_CFG_Z1(0x00015c44U), \
-        SM_CFG_Z1(0x00015c48U), \
-        SM_CFG_Z1(0x00015d80U), \
-        SM_CFG_Z1(0x00015d84U), \
-        SM_CFG_Z1(0x00015d88U), \
-        SM_CFG_W1(0x00016024U), 0x6666U, \
-        SM_CFG_W1(0x00016028U), 0x7777U, \
-        SM_CFG_W1(0x0001602cU), 0x6600U, \
-        SM_CFG_W1(0x000161a8U), 0x00003000U, \
-        SM_CFG_W1(0x000161d0U), 0x00003000U, \
+        SM_CFG_Z1(0x00011A40U), \
+        SM_CFG_Z1(0x00011B80U), \
+        SM_CFG_Z1(0x00011C40U), \
+        SM_CFG_Z1(0x00011D80U), \
+        SM_CFG_Z1(0x00011E40U), \
+        SM_CFG_Z1(0x00011F80U), \
+        SM_CFG_WN(0x00012024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
+        SM_CFG_WN(0x00012440U, 3U), \
+            0x33333333U, 0x33333333U, 0x00000333U, \
+        SM_CFG_WN(0x00012580U, 3U), \
+            0x33333333U, 0x33333333U, 0x00000333U, \
+        SM_CFG_WN(0x00012640U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_WN(0x00012780U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_WN(0x00013240U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_WN(0x00013380U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_WN(0x00014024U, 3U), \
+            0x6666U, 0x7777U, 0x7700U, \
+        SM_CFG_WN(0x00014040U, 3U), \
+            0x99999999U, 0x99999999U, 0x00999999U, \
+        SM_CFG_WN(0x00014180U, 3U), \
+            0x99999999U, 0x99999999U, 0x00999999U, \
+        SM_CFG_ZN(0x00014440U, 3U), \
+        SM_CFG_ZN(0x00014580U, 3U), \
+        SM_CFG_WN(0x00014640U, 3U), \
+            0x33333333U, 0x33333333U, 0x00AAAAAAU, \
+        SM_CFG_WN(0x00014780U, 3U), \
+            0x33333333U, 0x33333333U, 0x00AAAAAAU, \
+        SM_CFG_WN(0x000147A8U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_WN(0x000147D0U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_ZN(0x00014840U, 3U), \
+        SM_CFG_ZN(0x00014980U, 3U), \
+        SM_CFG_ZN(0x00014A40U, 3U), \
+        SM_CFG_ZN(0x00014B80U, 3U), \
+        SM_CFG_ZN(0x00014C40U, 3U), \
+        SM_CFG_ZN(0x00014D80U, 3U), \
+        SM_CFG_ZN(0x00014E40U, 3U), \
+        SM_CFG_ZN(0x00014F80U, 3U), \
+        SM_CFG_WN(0x00015240U, 3U), \
+            0x99999999U, 0x99999999U, 0x00999999U, \
+        SM_CFG_WN(0x00015380U, 3U), \
+            0x99999999U, 0x99999999U, 0x00999999U, \
+        SM_CFG_WN(0x000153A8U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_WN(0x000153D0U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000999U, \
+        SM_CFG_ZN(0x00015440U, 3U), \
+        SM_CFG_ZN(0x00015580U, 3U), \
+        SM_CFG_ZN(0x00015640U, 3U), \
+        SM_CFG_ZN(0x00015780U, 3U), \
+        SM_CFG_ZN(0x00015840U, 3U), \
+        SM_CFG_ZN(0x00015980U, 3U), \
+        SM_CFG_ZN(0x00015A40U, 3U), \
+        SM_CFG_ZN(0x00015B80U, 3U), \
+        SM_CFG_ZN(0x00015C40U, 3U), \
+        SM_CFG_ZN(0x00015D80U, 3U), \
+        SM_CFG_WN(0x00016024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
+        SM_CFG_W1(0x000161A8U), 0x00003000U, \
+        SM_CFG_W1(0x000161D0U), 0x00003000U, \
         SM_CFG_W1(0x00016240U), 0x00000900U, \
         SM_CFG_W1(0x00016380U), 0x00000900U, \
-        SM_CFG_W1(0x000163a8U), 0x00000900U, \
-        SM_CFG_W1(0x000163d0U), 0x00000900U, \
-        SM_CFG_W1(0x00016440U), 0x33300030U, \
-        SM_CFG_W1(0x00016444U), 0x00000033U, \
-        SM_CFG_W1(0x00016580U), 0x33300030U, \
-        SM_CFG_W1(0x00016584U), 0x00000033U, \
-        SM_CFG_W1(0x000165a8U), 0x33300000U, \
-        SM_CFG_W1(0x000165d0U), 0x33300000U, \
+        SM_CFG_W1(0x000163A8U), 0x00000900U, \
+        SM_CFG_W1(0x000163D0U), 0x00000900U, \
+        SM_CFG_WN(0x00016440U, 2U), \
+            0x33300030U, 0x00000033U, \
+        SM_CFG_WN(0x00016580U, 2U), \
+            0x33300030U, 0x00000033U, \
+        SM_CFG_W1(0x000165A8U), 0x33300000U, \
+        SM_CFG_W1(0x000165D0U), 0x33300000U, \
         SM_CFG_W1(0x00016644U), 0x00000090U, \
         SM_CFG_W1(0x00016784U), 0x00000090U, \
-        SM_CFG_W1(0x000167a8U), 0x00000090U, \
-        SM_CFG_W1(0x000167d0U), 0x00000090U, \
+        SM_CFG_W1(0x000167A8U), 0x00000090U, \
+        SM_CFG_W1(0x000167D0U), 0x00000090U, \
         SM_CFG_W1(0x00017040U), 0x00000009U, \
         SM_CFG_W1(0x00017180U), 0x00000009U, \
-        SM_CFG_W1(0x000171a8U), 0x00000009U, \
-        SM_CFG_W1(0x000171d0U), 0x00000009U, \
-        SM_CFG_W1(0x00017240U), 0x99900999U, \
-        SM_CFG_W1(0x00017244U), 0x00000099U, \
-        SM_CFG_W1(0x00017380U), 0x99900999U, \
-        SM_CFG_W1(0x00017384U), 0x00000099U, \
-        SM_CFG_W1(0x000173a8U), 0x99909999U, \
-        SM_CFG_W1(0x000173d0U), 0x99909999U, \
-        SM_CFG_W1(0x00018024U), 0x6666U, \
-        SM_CFG_W1(0x00018028U), 0x7777U, \
-        SM_CFG_W1(0x0001802cU), 0x6600U, \
+        SM_CFG_W1(0x000171A8U), 0x00000009U, \
+        SM_CFG_W1(0x000171D0U), 0x00000009U, \
+        SM_CFG_WN(0x00017240U, 2U), \
+            0x99900999U, 0x00000099U, \
+        SM_CFG_WN(0x00017380U, 2U), \
+            0x99900999U, 0x00000099U, \
+        SM_CFG_W1(0x000173A8U), 0x99909999U, \
+        SM_CFG_W1(0x000173D0U), 0x99909999U, \
+        SM_CFG_WN(0x00018024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
         SM_CFG_W1(0x00018440U), 0x33333333U, \
         SM_CFG_W1(0x00018580U), 0x33333333U, \
         SM_CFG_W1(0x00019240U), 0x99999999U, \
         SM_CFG_W1(0x00019380U), 0x99999999U, \
-        SM_CFG_W1(0x0001a024U), 0x7777U, \
-        SM_CFG_W1(0x0001a028U), 0x7700U, \
-        SM_CFG_W1(0x0001a040U), 0x08000000U, \
-        SM_CFG_W1(0x0001a044U), 0x87FFFC11U, \
-        SM_CFG_Z1(0x0001a04cU), \
-        SM_CFG_Z1(0x0001a054U), \
-        SM_CFG_Z1(0x0001a05cU), \
-        SM_CFG_Z1(0x0001a244U), \
-        SM_CFG_Z1(0x0001a24cU), \
-        SM_CFG_Z1(0x0001a254U), \
-        SM_CFG_Z1(0x0001a25cU), \
-        SM_CFG_W1(0x0001a340U), 0x08200001U, \
-        SM_CFG_W1(0x0001a344U), 0x085FFC11U, \
-        SM_CFG_W1(0x0001a348U), 0x08A00002U, \
-        SM_CFG_W1(0x0001a34cU), 0x08DFFC01U, \
-        SM_CFG_W1(0x0001a350U), 0x08E00001U, \
-        SM_CFG_W1(0x0001a354U), 0x87FFFC11U, \
-        SM_CFG_Z1(0x0001a35cU), \
-        SM_CFG_W1(0x0001a440U), 0x08000001U, \
-        SM_CFG_W1(0x0001a444U), 0x080FFC11U, \
-        SM_CFG_W1(0x0001a448U), 0x08200001U, \
-        SM_CFG_W1(0x0001a44cU), 0x083FFC11U, \
-        SM_CFG_W1(0x0001a450U), 0x08600001U, \
-        SM_CFG_W1(0x0001a454U), 0x089FFC11U, \
-        SM_CFG_Z1(0x0001a45cU), \
-        SM_CFG_Z1(0x0001a544U), \
-        SM_CFG_Z1(0x0001a54cU), \
-        SM_CFG_Z1(0x0001a554U), \
-        SM_CFG_Z1(0x0001a55cU), \
-        SM_CFG_Z1(0x0001a644U), \
-        SM_CFG_Z1(0x0001a64cU), \
-        SM_CFG_Z1(0x0001a654U), \
-        SM_CFG_Z1(0x0001a65cU), \
-        SM_CFG_Z1(0x0001a744U), \
-        SM_CFG_Z1(0x0001a74cU), \
-        SM_CFG_Z1(0x0001a754U), \
-        SM_CFG_Z1(0x0001a75cU), \
-        SM_CFG_Z1(0x0001a844U), \
-        SM_CFG_Z1(0x0001a84cU), \
-        SM_CFG_Z1(0x0001a854U), \
-        SM_CFG_Z1(0x0001a85cU), \
-        SM_CFG_W1(0x0001a940U), 0x08000000U, \
-        SM_CFG_W1(0x0001a944U), 0x080FFC11U, \
-        SM_CFG_W1(0x0001a948U), 0x08100000U, \
-        SM_CFG_W1(0x0001a94cU), 0x081FFC11U, \
-        SM_CFG_W1(0x0001a950U), 0x08200000U, \
-        SM_CFG_W1(0x0001a954U), 0x083FFC11U, \
-        SM_CFG_W1(0x0001a958U), 0x08200000U, \
-        SM_CFG_W1(0x0001a95cU), 0x085FFC11U, \
-        SM_CFG_W1(0x0001a960U), 0x08400000U, \
-        SM_CFG_W1(0x0001a964U), 0x089FFC11U, \
-        SM_CFG_W1(0x0001a968U), 0x08600000U, \
-        SM_CFG_W1(0x0001a96cU), 0x089FFC11U, \
-        SM_CFG_W1(0x0001a970U), 0x08600000U, \
-        SM_CFG_W1(0x0001a974U), 0x089FFC11U, \
-        SM_CFG_W1(0x0001a978U), 0x08600000U, \
-        SM_CFG_W1(0x0001a97cU), 0x089FFC11U, \
-        SM_CFG_W1(0x0001a980U), 0x08A00000U, \
-        SM_CFG_W1(0x0001a984U), 0x08DFFC11U, \
-        SM_CFG_W1(0x0001a988U), 0x08E00000U, \
-        SM_CFG_W1(0x0001a98cU), 0x87FFFC11U, \
-        SM_CFG_Z1(0x0001aa44U), \
-        SM_CFG_Z1(0x0001aa4cU), \
-        SM_CFG_Z1(0x0001aa54U), \
-        SM_CFG_Z1(0x0001aa5cU), \
-        SM_CFG_Z1(0x0001ab44U), \
-        SM_CFG_Z1(0x0001ab4cU), \
-        SM_CFG_Z1(0x0001ab54U), \
-        SM_CFG_Z1(0x0001ab5cU), \
-        SM_CFG_W1(0x0001ac40U), 0x08B00000U, \
-        SM_CFG_W1(0x0001ac44U), 0x08BFFC11U, \
-        SM_CFG_Z1(0x0001ac4cU), \
-        SM_CFG_Z1(0x0001ac54U), \
-        SM_CFG_Z1(0x0001ac5cU), \
-        SM_CFG_W1(0x0001ad40U), 0x08600001U, \
-        SM_CFG_W1(0x0001ad44U), 0x089FFC11U, \
-        SM_CFG_Z1(0x0001ad4cU), \
-        SM_CFG_Z1(0x0001ad54U), \
-        SM_CFG_Z1(0x0001ad5cU), \
-        SM_CFG_W1(0x0001ae40U), 0x08100001U, \
-        SM_CFG_W1(0x0001ae44U), 0x081FFC11U, \
-        SM_CFG_W1(0x0001ae48U), 0x08400001U, \
-        SM_CFG_W1(0x0001ae4cU), 0x089FFC11U, \
-        SM_CFG_W1(0x0001ae50U), 0x08600001U, \
-        SM_CFG_W1(0x0001ae54U), 0x089FFC11U, \
-        SM_CFG_Z1(0x0001ae5cU), \
+        SM_CFG_WN(0x0001A024U, 2U), \
+            0x7777U, 0x7700U, \
+        SM_CFG_WN(0x0001A040U, 2U), \
+            0x08000000U, 0x87FFFC11U, \
+        SM_CFG_Z1(0x0001A04CU), \
+        SM_CFG_Z1(0x0001A054U), \
+        SM_CFG_Z1(0x0001A05CU), \
+        SM_CFG_Z1(0x0001A244U), \
+        SM_CFG_Z1(0x0001A24CU), \
+        SM_CFG_Z1(0x0001A254U), \
+        SM_CFG_Z1(0x0001A25CU), \
+        SM_CFG_WN(0x0001A340U, 6U), \
+            0x08200001U, 0x085FFC11U, 0x08A00002U, 0x08DFFC01U, \
+            0x08E00001U, 0x87FFFC11U, \
+        SM_CFG_Z1(0x0001A35CU), \
+        SM_CFG_WN(0x0001A440U, 6U), \
+            0x08000001U, 0x080FFC11U, 0x08200001U, 0x083FFC11U, \
+            0x08600001U, 0x089FFC11U, \
+        SM_CFG_Z1(0x0001A45CU), \
+        SM_CFG_Z1(0x0001A544U), \
+        SM_CFG_Z1(0x0001A54CU), \
+        SM_CFG_Z1(0x0001A554U), \
+        SM_CFG_Z1(0x0001A55CU), \
+        SM_CFG_Z1(0x0001A644U), \
+        SM_CFG_Z1(0x0001A64CU), \
+        SM_CFG_Z1(0x0001A654U), \
+        SM_CFG_Z1(0x0001A65CU), \
+        SM_CFG_Z1(0x0001A744U), \
+        SM_CFG_Z1(0x0001A74CU), \
+        SM_CFG_Z1(0x0001A754U), \
+        SM_CFG_Z1(0x0001A75CU), \
+        SM_CFG_Z1(0x0001A844U), \
+        SM_CFG_Z1(0x0001A84CU), \
+        SM_CFG_Z1(0x0001A854U), \
+        SM_CFG_Z1(0x0001A85CU), \
+        SM_CFG_WN(0x0001A940U, 20U), \
+            0x08000000U, 0x080FFC11U, 0x08100000U, 0x081FFC11U, \
+            0x08200000U, 0x083FFC11U, 0x08200000U, 0x085FFC11U, \
+            0x08400000U, 0x089FFC11U, 0x08600000U, 0x089FFC11U, \
+            0x08600000U, 0x089FFC11U, 0x08600000U, 0x089FFC11U, \
+            0x08A00000U, 0x08DFFC11U, 0x08E00000U, 0x87FFFC11U, \
+        SM_CFG_Z1(0x0001AA44U), \
+        SM_CFG_Z1(0x0001AA4CU), \
+        SM_CFG_Z1(0x0001AA54U), \
+        SM_CFG_Z1(0x0001AA5CU), \
+        SM_CFG_Z1(0x0001AB44U), \
+        SM_CFG_Z1(0x0001AB4CU), \
+        SM_CFG_Z1(0x0001AB54U), \
+        SM_CFG_Z1(0x0001AB5CU), \
+        SM_CFG_WN(0x0001AC40U, 2U), \
+            0x08B00000U, 0x08BFFC11U, \
+        SM_CFG_Z1(0x0001AC4CU), \
+        SM_CFG_Z1(0x0001AC54U), \
+        SM_CFG_Z1(0x0001AC5CU), \
+        SM_CFG_WN(0x0001AD40U, 2U), \
+            0x08600001U, 0x089FFC11U, \
+        SM_CFG_Z1(0x0001AD4CU), \
+        SM_CFG_Z1(0x0001AD54U), \
+        SM_CFG_Z1(0x0001AD5CU), \
+        SM_CFG_WN(0x0001AE40U, 6U), \
+            0x08100001U, 0x081FFC11U, 0x08400001U, 0x089FFC11U, \
+            0x08600001U, 0x089FFC11U, \
+        SM_CFG_Z1(0x0001AE5CU), \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_Z1(0x00012020U), \
         SM_CFG_Z1(0x00014020U), \
         SM_CFG_Z1(0x00016020U), \
         SM_CFG_Z1(0x00018020U), \
-        SM_CFG_W1(0x0001a020U), 0x6666U, \
+        SM_CFG_W1(0x0001A020U), 0x6666U, \
         SM_CFG_C1(0x00000000U), 0x0000C001U, \
         SM_CFG_END \
     }
@@ -938,116 +686,47 @@
 /*! Config for TRDC S */
 #define SM_TRDC_S_CONFIG \
     { \
-        SM_CFG_W1(0x00000800U), 0x9000000DU, \
-        SM_CFG_W1(0x00000804U), 0x9000000DU, \
-        SM_CFG_W1(0x00000808U), 0x9000000DU, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x00011240U), 0x99999999U, \
-        SM_CFG_W1(0x00011244U), 0x99999999U, \
-        SM_CFG_W1(0x00011248U), 0x99999999U, \
-        SM_CFG_W1(0x0001124cU), 0x99999999U, \
-        SM_CFG_W1(0x00011380U), 0x99999999U, \
-        SM_CFG_W1(0x00011384U), 0x99999999U, \
-        SM_CFG_W1(0x00011388U), 0x99999999U, \
-        SM_CFG_W1(0x0001138cU), 0x99999999U, \
-        SM_CFG_W1(0x00011a40U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011a44U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011a48U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011a4cU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011b80U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011b84U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011b88U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00011b8cU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00012024U), 0x6666U, \
-        SM_CFG_W1(0x00012028U), 0x7777U, \
-        SM_CFG_W1(0x0001202cU), 0x6600U, \
-        SM_CFG_W1(0x000121d0U), 0x00333000U, \
-        SM_CFG_W1(0x000123d0U), 0x00000900U, \
-        SM_CFG_W1(0x000125d0U), 0x33330000U, \
-        SM_CFG_W1(0x000125d4U), 0x00000033U, \
-        SM_CFG_W1(0x000125dcU), 0x00300000U, \
-        SM_CFG_W1(0x00012780U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00012784U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00012788U), 0x0000000AU, \
-        SM_CFG_W1(0x000127a8U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127acU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127b0U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127b4U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127b8U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127bcU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127c0U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x000127c4U), 0xAAAAAAAAU, \
-        SM_CFG_Z1(0x000127d0U), \
-        SM_CFG_Z1(0x000129d0U), \
-        SM_CFG_W1(0x000129d8U), 0x09000099U, \
-        SM_CFG_W1(0x000129dcU), 0x00000009U, \
-        SM_CFG_Z1(0x00012bd0U), \
-        SM_CFG_Z1(0x00012dd0U), \
-        SM_CFG_Z1(0x00012fd0U), \
-        SM_CFG_W1(0x000131d0U), 0x00000009U, \
-        SM_CFG_W1(0x00013240U), 0x99999999U, \
-        SM_CFG_W1(0x00013244U), 0x99999999U, \
-        SM_CFG_W1(0x00013248U), 0x99999999U, \
-        SM_CFG_W1(0x0001324cU), 0x99999999U, \
-        SM_CFG_W1(0x00013250U), 0x99999999U, \
-        SM_CFG_W1(0x00013254U), 0x99999999U, \
-        SM_CFG_W1(0x00013258U), 0x99999999U, \
-        SM_CFG_W1(0x0001325cU), 0x99999999U, \
-        SM_CFG_W1(0x00013380U), 0x99999999U, \
-        SM_CFG_W1(0x00013384U), 0x99999999U, \
-        SM_CFG_W1(0x00013388U), 0x99999999U, \
-        SM_CFG_W1(0x0001338cU), 0x99999999U, \
-        SM_CFG_W1(0x00013390U), 0x99999999U, \
-        SM_CFG_W1(0x00013394U), 0x99999999U, \
-        SM_CFG_W1(0x00013398U), 0x99999999U, \
-        SM_CFG_W1(0x0001339cU), 0x99999999U, \
-        SM_CFG_W1(0x000133a8U), 0x99999999U, \
-        SM_CFG_W1(0x000133acU), 0x99999999U, \
-        SM_CFG_W1(0x000133b0U), 0x99999999U, \
-        SM_CFG_W1(0x000133b4U), 0x99999999U, \
-        SM_CFG_W1(0x000133b8U), 0x99999999U, \
-        SM_CFG_W1(0x000133bcU), 0x99999999U, \
-        SM_CFG_W1(0x000133c0U), 0x99999999U, \
-        SM_CFG_W1(0x000133c4U), 0x99999999U, \
-        SM_CFG_W1(0x000133d0U), 0x99999909U, \
-        SM_CFG_W1(0x000133d4U), 0x99009999U, \
-        SM_CFG_W1(0x000133d8U), 0x99999999U, \
-        SM_CFG_W1(0x000133dcU), 0x00999999U, \
-        SM_CFG_Z1(0x000135d0U), \
-        SM_CFG_Z1(0x000137d0U), \
-        SM_CFG_Z1(0x000139d0U), \
-        SM_CFG_W1(0x00013a40U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a44U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a48U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a4cU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a50U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a54U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a58U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013a5cU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b80U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b84U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b88U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b8cU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b90U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b94U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b98U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013b9cU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013ba8U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bacU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bb0U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bb4U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bb8U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bbcU), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bc0U), 0xAAAAAAAAU, \
-        SM_CFG_W1(0x00013bc4U), 0xAAAAAAAAU, \
-        SM_CFG_Z1(0x00013bd0U), \
-        SM_CFG_W1(0x00013bd4U), 0x99009900U, \
-        SM_CFG_W1(0x00013bd8U), 0x90909000U, \
-        SM_CFG_W1(0x00013bdcU), 0x00099990U, \
-        SM_CFG_Z1(0x00013dd0U), \
-        SM_CFG_W1(0x00013dd8U), 0x00090900U, \
-        SM_CFG_Z1(0x00013fd0U), \
+        SM_CFG_FN(0x00000800U, 3U), 0x9000000DU, \
+        SM_CFG_WN(0x00010024U, 2U), \
+            0x6666U, 0x7777U, \
+        SM_CFG_FN(0x00011240U, 4U), 0x99999999U, \
+        SM_CFG_FN(0x00011380U, 4U), 0x99999999U, \
+        SM_CFG_FN(0x00011A40U, 4U), 0xAAAAAAAAU, \
+        SM_CFG_FN(0x00011B80U, 4U), 0xAAAAAAAAU, \
+        SM_CFG_WN(0x00012024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
+        SM_CFG_W1(0x000121D0U), 0x00333000U, \
+        SM_CFG_W1(0x000123D0U), 0x00000900U, \
+        SM_CFG_WN(0x000125D0U, 2U), \
+            0x33330000U, 0x00000033U, \
+        SM_CFG_W1(0x000125DCU), 0x00300000U, \
+        SM_CFG_WN(0x00012780U, 3U), \
+            0xAAAAAAAAU, 0xAAAAAAAAU, 0x0000000AU, \
+        SM_CFG_FN(0x000127A8U, 8U), 0xAAAAAAAAU, \
+        SM_CFG_Z1(0x000127D0U), \
+        SM_CFG_Z1(0x000129D0U), \
+        SM_CFG_WN(0x000129D8U, 2U), \
+            0x09000099U, 0x00000009U, \
+        SM_CFG_Z1(0x00012BD0U), \
+        SM_CFG_Z1(0x00012DD0U), \
+        SM_CFG_Z1(0x00012FD0U), \
+        SM_CFG_W1(0x000131D0U), 0x00000009U, \
+        SM_CFG_FN(0x00013240U, 8U), 0x99999999U, \
+        SM_CFG_FN(0x00013380U, 8U), 0x99999999U, \
+        SM_CFG_FN(0x000133A8U, 8U), 0x99999999U, \
+        SM_CFG_WN(0x000133D0U, 4U), \
+            0x99999909U, 0x99009999U, 0x99999999U, 0x00999999U, \
+        SM_CFG_Z1(0x000135D0U), \
+        SM_CFG_Z1(0x000137D0U), \
+        SM_CFG_Z1(0x000139D0U), \
+        SM_CFG_FN(0x00013A40U, 8U), 0xAAAAAAAAU, \
+        SM_CFG_FN(0x00013B80U, 8U), 0xAAAAAAAAU, \
+        SM_CFG_FN(0x00013BA8U, 8U), 0xAAAAAAAAU, \
+        SM_CFG_WN(0x00013BD0U, 4U), \
+            0x00000000U, 0x99009900U, 0x90909000U, 0x00099990U, \
+        SM_CFG_Z1(0x00013DD0U), \
+        SM_CFG_W1(0x00013DD8U), 0x00090900U, \
+        SM_CFG_Z1(0x00013FD0U), \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_Z1(0x00012020U), \
         SM_CFG_C1(0x00000000U), 0x0000C001U, \
@@ -1066,438 +745,371 @@
         SM_CFG_W1(0x00000840U), 0xB0000053U, \
         SM_CFG_W1(0x00000860U), 0xB0000053U, \
         SM_CFG_W1(0x00000880U), 0xB0000053U, \
-        SM_CFG_W1(0x000008a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008e0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008E0U), 0xB0000053U, \
         SM_CFG_W1(0x00000900U), 0xB0000053U, \
         SM_CFG_W1(0x00000920U), 0xB0000053U, \
         SM_CFG_W1(0x00000940U), 0xB0000053U, \
         SM_CFG_W1(0x00000960U), 0xB0000053U, \
         SM_CFG_W1(0x00000980U), 0xB0000053U, \
-        SM_CFG_W1(0x000009a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009e0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000aa0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ac0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ae0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ba0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000bc0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000be0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c80U), 0x90000004U, \
-        SM_CFG_W1(0x00000ca0U), 0x9000000EU, \
-        SM_CFG_W1(0x00010024U), 0x6666U, \
-        SM_CFG_W1(0x00010028U), 0x7777U, \
-        SM_CFG_W1(0x0001002cU), 0x6600U, \
-        SM_CFG_W1(0x00010030U), 0x4444U, \
+        SM_CFG_W1(0x000009A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009E0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C80U), 0x90000004U, \
+        SM_CFG_W1(0x00000CA0U), 0x9000000EU, \
+        SM_CFG_WN(0x00010024U, 4U), \
+            0x6666U, 0x7777U, 0x6600U, 0x4444U, \
         SM_CFG_Z1(0x00010060U), \
         SM_CFG_W1(0x00010070U), 0x00003000U, \
         SM_CFG_Z1(0x00010260U), \
         SM_CFG_W1(0x00010270U), 0x00000090U, \
         SM_CFG_W1(0x00010460U), 0x33000300U, \
-        SM_CFG_W1(0x00010474U), 0x00000003U, \
-        SM_CFG_W1(0x00010478U), 0x33300000U, \
-        SM_CFG_W1(0x0001047cU), 0x00300333U, \
-        SM_CFG_W1(0x000105d0U), 0x33333333U, \
-        SM_CFG_W1(0x000105d4U), 0x33333333U, \
-        SM_CFG_W1(0x000105d8U), 0x00000003U, \
-        SM_CFG_W1(0x00010640U), 0x99999999U, \
-        SM_CFG_W1(0x00010644U), 0x99999999U, \
-        SM_CFG_W1(0x00010648U), 0x99999999U, \
-        SM_CFG_W1(0x0001064cU), 0x99999999U, \
-        SM_CFG_W1(0x00010650U), 0x99999999U, \
-        SM_CFG_W1(0x00010654U), 0x99999999U, \
-        SM_CFG_W1(0x00010658U), 0x99999999U, \
-        SM_CFG_W1(0x0001065cU), 0x99999999U, \
-        SM_CFG_W1(0x00010660U), 0x00909099U, \
-        SM_CFG_W1(0x00010664U), 0x00090000U, \
-        SM_CFG_W1(0x00010668U), 0x99999900U, \
-        SM_CFG_W1(0x0001066cU), 0x99999999U, \
-        SM_CFG_W1(0x00010670U), 0x99900009U, \
-        SM_CFG_W1(0x00010674U), 0x99999090U, \
-        SM_CFG_W1(0x00010678U), 0x00009999U, \
+        SM_CFG_WN(0x00010474U, 3U), \
+            0x00000003U, 0x33300000U, 0x00300333U, \
+        SM_CFG_WN(0x000105D0U, 3U), \
+            0x33333333U, 0x33333333U, 0x00000003U, \
+        SM_CFG_FN(0x00010640U, 8U), 0x99999999U, \
+        SM_CFG_WN(0x00010660U, 7U), \
+            0x00909099U, 0x00090000U, 0x99999900U, 0x99999999U, \
+            0x99900009U, 0x99999090U, 0x00009999U, \
         SM_CFG_W1(0x00010780U), 0x00000009U, \
-        SM_CFG_W1(0x000107a8U), 0x00000009U, \
-        SM_CFG_W1(0x00010860U), 0x00090000U, \
-        SM_CFG_W1(0x00010864U), 0x90909009U, \
-        SM_CFG_W1(0x00010878U), 0x00090000U, \
-        SM_CFG_W1(0x0001087cU), 0x00099000U, \
-        SM_CFG_Z1(0x00010a60U), \
-        SM_CFG_Z1(0x00010c60U), \
-        SM_CFG_Z1(0x00010e60U), \
+        SM_CFG_W1(0x000107A8U), 0x00000009U, \
+        SM_CFG_WN(0x00010860U, 2U), \
+            0x00090000U, 0x90909009U, \
+        SM_CFG_WN(0x00010878U, 2U), \
+            0x00090000U, 0x00099000U, \
+        SM_CFG_Z1(0x00010A60U), \
+        SM_CFG_Z1(0x00010C60U), \
+        SM_CFG_Z1(0x00010E60U), \
         SM_CFG_Z1(0x00011060U), \
         SM_CFG_W1(0x00011070U), 0x00000900U, \
-        SM_CFG_W1(0x00011240U), 0x99999999U, \
-        SM_CFG_W1(0x00011244U), 0x99999999U, \
-        SM_CFG_W1(0x00011248U), 0x99999999U, \
-        SM_CFG_W1(0x0001124cU), 0x99999999U, \
-        SM_CFG_W1(0x00011250U), 0x99999999U, \
-        SM_CFG_W1(0x00011254U), 0x99999999U, \
-        SM_CFG_W1(0x00011258U), 0x99999999U, \
-        SM_CFG_W1(0x0001125cU), 0x99999999U, \
-        SM_CFG_W1(0x00011260U), 0x99999999U, \
-        SM_CFG_W1(0x00011264U), 0x99999009U, \
-        SM_CFG_W1(0x00011268U), 0x99999999U, \
-        SM_CFG_W1(0x0001126cU), 0x99999999U, \
-        SM_CFG_W1(0x00011270U), 0x99909999U, \
-        SM_CFG_W1(0x00011274U), 0x99999999U, \
-        SM_CFG_W1(0x00011278U), 0x99999999U, \
-        SM_CFG_W1(0x0001127cU), 0x99999999U, \
+        SM_CFG_FN(0x00011240U, 9U), 0x99999999U, \
+        SM_CFG_WN(0x00011264U, 4U), \
+            0x99999009U, 0x99999999U, 0x99999999U, 0x99909999U, \
+        SM_CFG_FN(0x00011274U, 3U), 0x99999999U, \
         SM_CFG_W1(0x00011380U), 0x00000009U, \
-        SM_CFG_W1(0x000113a8U), 0x00000009U, \
-        SM_CFG_W1(0x000113d0U), 0x99999999U, \
-        SM_CFG_W1(0x000113d4U), 0x99999999U, \
-        SM_CFG_W1(0x000113d8U), 0x00000009U, \
+        SM_CFG_W1(0x000113A8U), 0x00000009U, \
+        SM_CFG_WN(0x000113D0U, 3U), \
+            0x99999999U, 0x99999999U, 0x00000009U, \
         SM_CFG_Z1(0x00011460U), \
         SM_CFG_Z1(0x00011660U), \
         SM_CFG_Z1(0x00011860U), \
-        SM_CFG_Z1(0x00011a60U), \
-        SM_CFG_W1(0x00011a64U), 0x0000000CU, \
-        SM_CFG_W1(0x00011a68U), 0x00000099U, \
-        SM_CFG_W1(0x00011a74U), 0x00000900U, \
-        SM_CFG_Z1(0x00011c60U), \
-        SM_CFG_W1(0x00011c64U), 0x0900000CU, \
-        SM_CFG_W1(0x00011c7cU), 0x99000000U, \
-        SM_CFG_Z1(0x00011e60U), \
-        SM_CFG_W1(0x00012024U), 0x6666U, \
-        SM_CFG_W1(0x00012028U), 0x7777U, \
-        SM_CFG_W1(0x0001202cU), 0x6600U, \
+        SM_CFG_WN(0x00011A60U, 3U), \
+            0x00000000U, 0x0000000CU, 0x00000099U, \
+        SM_CFG_W1(0x00011A74U), 0x00000900U, \
+        SM_CFG_WN(0x00011C60U, 2U), \
+            0x00000000U, 0x0900000CU, \
+        SM_CFG_W1(0x00011C7CU), 0x99000000U, \
+        SM_CFG_Z1(0x00011E60U), \
+        SM_CFG_WN(0x00012024U, 3U), \
+            0x6666U, 0x7777U, 0x6600U, \
         SM_CFG_Z1(0x00012040U), \
         SM_CFG_W1(0x00012180U), 0x00000003U, \
         SM_CFG_W1(0x00012240U), 0x90000000U, \
         SM_CFG_W1(0x00012440U), 0x00003033U, \
         SM_CFG_W1(0x00012448U), 0x00300000U, \
-        SM_CFG_W1(0x000125a8U), 0x00000003U, \
-        SM_CFG_W1(0x00012640U), 0x09900000U, \
-        SM_CFG_W1(0x00012644U), 0x00000009U, \
-        SM_CFG_W1(0x00012650U), 0x09900000U, \
-        SM_CFG_W1(0x00012654U), 0x09090000U, \
-        SM_CFG_W1(0x00012658U), 0x09090909U, \
-        SM_CFG_W1(0x0001265cU), 0x99999990U, \
-        SM_CFG_W1(0x00012660U), 0x00000999U, \
-        SM_CFG_W1(0x0001266cU), 0x90000000U, \
-        SM_CFG_W1(0x00012670U), 0x99999999U, \
-        SM_CFG_W1(0x00012674U), 0x99999999U, \
-        SM_CFG_W1(0x00012678U), 0x99999999U, \
-        SM_CFG_W1(0x0001267cU), 0x99999999U, \
-        SM_CFG_W1(0x000127d0U), 0x00009999U, \
-        SM_CFG_W1(0x00012840U), 0x00090000U, \
-        SM_CFG_W1(0x00012844U), 0x99999000U, \
-        SM_CFG_W1(0x00012848U), 0x99099999U, \
-        SM_CFG_W1(0x0001284cU), 0x99099999U, \
-        SM_CFG_W1(0x00012850U), 0x90099999U, \
-        SM_CFG_W1(0x00012854U), 0x00000090U, \
-        SM_CFG_W1(0x0001285cU), 0x00000009U, \
-        SM_CFG_W1(0x00012860U), 0x09999000U, \
-        SM_CFG_W1(0x00012864U), 0x99999000U, \
-        SM_CFG_W1(0x00012868U), 0x00099999U, \
-        SM_CFG_Z1(0x00012a40U), \
-        SM_CFG_Z1(0x00012c40U), \
-        SM_CFG_Z1(0x00012e40U), \
+        SM_CFG_W1(0x000125A8U), 0x00000003U, \
+        SM_CFG_WN(0x00012640U, 2U), \
+            0x09900000U, 0x00000009U, \
+        SM_CFG_WN(0x00012650U, 5U), \
+            0x09900000U, 0x09090000U, 0x09090909U, 0x99999990U, \
+            0x00000999U, \
+        SM_CFG_W1(0x0001266CU), 0x90000000U, \
+        SM_CFG_FN(0x00012670U, 4U), 0x99999999U, \
+        SM_CFG_W1(0x000127D0U), 0x00009999U, \
+        SM_CFG_WN(0x00012840U, 6U), \
+            0x00090000U, 0x99999000U, 0x99099999U, 0x99099999U, \
+            0x90099999U, 0x00000090U, \
+        SM_CFG_WN(0x0001285CU, 4U), \
+            0x00000009U, 0x09999000U, 0x99999000U, 0x00099999U, \
+        SM_CFG_Z1(0x00012A40U), \
+        SM_CFG_Z1(0x00012C40U), \
+        SM_CFG_Z1(0x00012E40U), \
         SM_CFG_Z1(0x00013040U), \
         SM_CFG_W1(0x00013240U), 0x99999099U, \
-        SM_CFG_W1(0x00013244U), 0x99999999U, \
-        SM_CFG_W1(0x00013248U), 0x99999999U, \
-        SM_CFG_W1(0x0001324cU), 0x99999999U, \
-        SM_CFG_W1(0x00013250U), 0x99999999U, \
-        SM_CFG_W1(0x00013254U), 0x99999999U, \
-        SM_CFG_W1(0x00013258U), 0x99999999U, \
-        SM_CFG_W1(0x0001325cU), 0x99999999U, \
-        SM_CFG_W1(0x00013260U), 0x99999999U, \
-        SM_CFG_W1(0x00013264U), 0x99999999U, \
-        SM_CFG_W1(0x00013268U), 0x00099999U, \
-        SM_CFG_W1(0x0001326cU), 0x90000000U, \
-        SM_CFG_W1(0x00013270U), 0x99999999U, \
-        SM_CFG_W1(0x00013274U), 0x99999999U, \
-        SM_CFG_W1(0x00013278U), 0x99999999U, \
-        SM_CFG_W1(0x0001327cU), 0x99999999U, \
+        SM_CFG_FN(0x00013244U, 9U), 0x99999999U, \
+        SM_CFG_WN(0x00013268U, 2U), \
+            0x00099999U, 0x90000000U, \
+        SM_CFG_FN(0x00013270U, 4U), 0x99999999U, \
         SM_CFG_W1(0x00013380U), 0x00000009U, \
-        SM_CFG_W1(0x000133a8U), 0x00000009U, \
-        SM_CFG_W1(0x000133d0U), 0x00009999U, \
+        SM_CFG_W1(0x000133A8U), 0x00000009U, \
+        SM_CFG_W1(0x000133D0U), 0x00009999U, \
         SM_CFG_Z1(0x00013440U), \
         SM_CFG_Z1(0x00013640U), \
         SM_CFG_Z1(0x00013840U), \
-        SM_CFG_Z1(0x00013a40U), \
-        SM_CFG_W1(0x00013a54U), 0x90000000U, \
-        SM_CFG_W1(0x00013a58U), 0x00909090U, \
-        SM_CFG_Z1(0x00013c40U), \
-        SM_CFG_W1(0x00013c44U), 0x00000990U, \
-        SM_CFG_W1(0x00013c4cU), 0x00900000U, \
-        SM_CFG_W1(0x00013c54U), 0x00909909U, \
-        SM_CFG_W1(0x00013c58U), 0x90000000U, \
-        SM_CFG_W1(0x00013c60U), 0x90000000U, \
-        SM_CFG_W1(0x00013c64U), 0x00000999U, \
-        SM_CFG_Z1(0x00013e40U), \
-        SM_CFG_W1(0x00014024U), 0x6666U, \
-        SM_CFG_W1(0x00014028U), 0x7777U, \
+        SM_CFG_Z1(0x00013A40U), \
+        SM_CFG_WN(0x00013A54U, 2U), \
+            0x90000000U, 0x00909090U, \
+        SM_CFG_WN(0x00013C40U, 2U), \
+            0x00000000U, 0x00000990U, \
+        SM_CFG_W1(0x00013C4CU), 0x00900000U, \
+        SM_CFG_WN(0x00013C54U, 2U), \
+            0x00909909U, 0x90000000U, \
+        SM_CFG_WN(0x00013C60U, 2U), \
+            0x90000000U, 0x00000999U, \
+        SM_CFG_Z1(0x00013E40U), \
+        SM_CFG_WN(0x00014024U, 2U), \
+            0x6666U, 0x7777U, \
         SM_CFG_W1(0x00014640U), 0x00999999U, \
         SM_CFG_W1(0x00014780U), 0x00999999U, \
         SM_CFG_W1(0x00015240U), 0x00999999U, \
         SM_CFG_W1(0x00015380U), 0x00999999U, \
         SM_CFG_W1(0x00017024U), 0x6666U, \
         SM_CFG_Z1(0x00017244U), \
-        SM_CFG_Z1(0x0001724cU), \
+        SM_CFG_Z1(0x0001724CU), \
         SM_CFG_Z1(0x00017254U), \
-        SM_CFG_Z1(0x0001725cU), \
-        SM_CFG_Z1(0x00017340U), \
-        SM_CFG_W1(0x00017344U), 0xFFFFC011U, \
-        SM_CFG_Z1(0x0001734cU), \
+        SM_CFG_Z1(0x0001725CU), \
+        SM_CFG_WN(0x00017340U, 2U), \
+            0x00000000U, 0xFFFFC011U, \
+        SM_CFG_Z1(0x0001734CU), \
         SM_CFG_Z1(0x00017354U), \
-        SM_CFG_Z1(0x0001735cU), \
+        SM_CFG_Z1(0x0001735CU), \
         SM_CFG_Z1(0x00017444U), \
-        SM_CFG_Z1(0x0001744cU), \
+        SM_CFG_Z1(0x0001744CU), \
         SM_CFG_Z1(0x00017454U), \
-        SM_CFG_Z1(0x0001745cU), \
+        SM_CFG_Z1(0x0001745CU), \
         SM_CFG_Z1(0x00017544U), \
-        SM_CFG_Z1(0x0001754cU), \
+        SM_CFG_Z1(0x0001754CU), \
         SM_CFG_Z1(0x00017554U), \
-        SM_CFG_Z1(0x0001755cU), \
+        SM_CFG_Z1(0x0001755CU), \
         SM_CFG_Z1(0x00017644U), \
-        SM_CFG_Z1(0x0001764cU), \
+        SM_CFG_Z1(0x0001764CU), \
         SM_CFG_Z1(0x00017654U), \
-        SM_CFG_Z1(0x0001765cU), \
+        SM_CFG_Z1(0x0001765CU), \
         SM_CFG_Z1(0x00017744U), \
-        SM_CFG_Z1(0x0001774cU), \
+        SM_CFG_Z1(0x0001774CU), \
         SM_CFG_Z1(0x00017754U), \
-        SM_CFG_Z1(0x0001775cU), \
+        SM_CFG_Z1(0x0001775CU), \
         SM_CFG_Z1(0x00017844U), \
-        SM_CFG_Z1(0x0001784cU), \
+        SM_CFG_Z1(0x0001784CU), \
         SM_CFG_Z1(0x00017854U), \
-        SM_CFG_Z1(0x0001785cU), \
-        SM_CFG_W1(0x00017940U), 0x00000001U, \
-        SM_CFG_W1(0x00017944U), 0xFFFFC011U, \
-        SM_CFG_Z1(0x0001794cU), \
+        SM_CFG_Z1(0x0001785CU), \
+        SM_CFG_WN(0x00017940U, 2U), \
+            0x00000001U, 0xFFFFC011U, \
+        SM_CFG_Z1(0x0001794CU), \
         SM_CFG_Z1(0x00017954U), \
-        SM_CFG_Z1(0x0001795cU), \
-        SM_CFG_Z1(0x00017a44U), \
-        SM_CFG_Z1(0x00017a4cU), \
-        SM_CFG_Z1(0x00017a54U), \
-        SM_CFG_Z1(0x00017a5cU), \
-        SM_CFG_Z1(0x00017b44U), \
-        SM_CFG_Z1(0x00017b4cU), \
-        SM_CFG_Z1(0x00017b54U), \
-        SM_CFG_Z1(0x00017b5cU), \
-        SM_CFG_Z1(0x00017c44U), \
-        SM_CFG_Z1(0x00017c4cU), \
-        SM_CFG_Z1(0x00017c54U), \
-        SM_CFG_Z1(0x00017c5cU), \
-        SM_CFG_Z1(0x00017d44U), \
-        SM_CFG_Z1(0x00017d4cU), \
-        SM_CFG_Z1(0x00017d54U), \
-        SM_CFG_Z1(0x00017d5cU), \
-        SM_CFG_Z1(0x00017e44U), \
-        SM_CFG_Z1(0x00017e4cU), \
-        SM_CFG_Z1(0x00017e54U), \
-        SM_CFG_Z1(0x00017e5cU), \
+        SM_CFG_Z1(0x0001795CU), \
+        SM_CFG_Z1(0x00017A44U), \
+        SM_CFG_Z1(0x00017A4CU), \
+        SM_CFG_Z1(0x00017A54U), \
+        SM_CFG_Z1(0x00017A5CU), \
+        SM_CFG_Z1(0x00017B44U), \
+        SM_CFG_Z1(0x00017B4CU), \
+        SM_CFG_Z1(0x00017B54U), \
+        SM_CFG_Z1(0x00017B5CU), \
+        SM_CFG_Z1(0x00017C44U), \
+        SM_CFG_Z1(0x00017C4CU), \
+        SM_CFG_Z1(0x00017C54U), \
+        SM_CFG_Z1(0x00017C5CU), \
+        SM_CFG_Z1(0x00017D44U), \
+        SM_CFG_Z1(0x00017D4CU), \
+        SM_CFG_Z1(0x00017D54U), \
+        SM_CFG_Z1(0x00017D5CU), \
+        SM_CFG_Z1(0x00017E44U), \
+        SM_CFG_Z1(0x00017E4CU), \
+        SM_CFG_Z1(0x00017E54U), \
+        SM_CFG_Z1(0x00017E5CU), \
         SM_CFG_W1(0x00018024U), 0x6666U, \
-        SM_CFG_W1(0x00018040U), 0x4A030000U, \
-        SM_CFG_W1(0x00018044U), 0x4A03C001U, \
-        SM_CFG_Z1(0x0001804cU), \
+        SM_CFG_WN(0x00018040U, 2U), \
+            0x4A030000U, 0x4A03C001U, \
+        SM_CFG_Z1(0x0001804CU), \
         SM_CFG_Z1(0x00018054U), \
-        SM_CFG_Z1(0x0001805cU), \
-        SM_CFG_W1(0x00018140U), 0x4A020001U, \
-        SM_CFG_W1(0x00018144U), 0x4A02C011U, \
-        SM_CFG_Z1(0x0001814cU), \
+        SM_CFG_Z1(0x0001805CU), \
+        SM_CFG_WN(0x00018140U, 2U), \
+            0x4A020001U, 0x4A02C011U, \
+        SM_CFG_Z1(0x0001814CU), \
         SM_CFG_Z1(0x00018154U), \
-        SM_CFG_Z1(0x0001815cU), \
-        SM_CFG_W1(0x00018240U), 0x4A050000U, \
-        SM_CFG_W1(0x00018244U), 0x4A0AC001U, \
-        SM_CFG_Z1(0x0001824cU), \
+        SM_CFG_Z1(0x0001815CU), \
+        SM_CFG_WN(0x00018240U, 2U), \
+            0x4A050000U, 0x4A0AC001U, \
+        SM_CFG_Z1(0x0001824CU), \
         SM_CFG_Z1(0x00018254U), \
-        SM_CFG_Z1(0x0001825cU), \
+        SM_CFG_Z1(0x0001825CU), \
         SM_CFG_Z1(0x00018344U), \
-        SM_CFG_Z1(0x0001834cU), \
+        SM_CFG_Z1(0x0001834CU), \
         SM_CFG_Z1(0x00018354U), \
-        SM_CFG_Z1(0x0001835cU), \
-        SM_CFG_W1(0x00018440U), 0x4A060001U, \
-        SM_CFG_W1(0x00018444U), 0x4A09C011U, \
-        SM_CFG_W1(0x00018448U), 0x20380001U, \
-        SM_CFG_W1(0x0001844cU), 0x2047C011U, \
+        SM_CFG_Z1(0x0001835CU), \
+        SM_CFG_WN(0x00018440U, 4U), \
+            0x4A060001U, 0x4A09C011U, 0x20380001U, 0x2047C011U, \
         SM_CFG_Z1(0x00018454U), \
-        SM_CFG_Z1(0x0001845cU), \
+        SM_CFG_Z1(0x0001845CU), \
         SM_CFG_Z1(0x00018544U), \
-        SM_CFG_Z1(0x0001854cU), \
+        SM_CFG_Z1(0x0001854CU), \
         SM_CFG_Z1(0x00018554U), \
-        SM_CFG_Z1(0x0001855cU), \
+        SM_CFG_Z1(0x0001855CU), \
         SM_CFG_Z1(0x00018644U), \
-        SM_CFG_Z1(0x0001864cU), \
+        SM_CFG_Z1(0x0001864CU), \
         SM_CFG_Z1(0x00018654U), \
-        SM_CFG_Z1(0x0001865cU), \
+        SM_CFG_Z1(0x0001865CU), \
         SM_CFG_Z1(0x00018744U), \
-        SM_CFG_Z1(0x0001874cU), \
+        SM_CFG_Z1(0x0001874CU), \
         SM_CFG_Z1(0x00018754U), \
-        SM_CFG_Z1(0x0001875cU), \
+        SM_CFG_Z1(0x0001875CU), \
         SM_CFG_Z1(0x00018844U), \
-        SM_CFG_Z1(0x0001884cU), \
+        SM_CFG_Z1(0x0001884CU), \
         SM_CFG_Z1(0x00018854U), \
-        SM_CFG_Z1(0x0001885cU), \
-        SM_CFG_W1(0x00018940U), 0x4A020001U, \
-        SM_CFG_W1(0x00018944U), 0x4A02C011U, \
-        SM_CFG_W1(0x00018948U), 0x4A030001U, \
-        SM_CFG_W1(0x0001894cU), 0x4A03C011U, \
-        SM_CFG_W1(0x00018950U), 0x4A050001U, \
-        SM_CFG_W1(0x00018954U), 0x4A0AC011U, \
-        SM_CFG_W1(0x00018958U), 0x4A060001U, \
-        SM_CFG_W1(0x0001895cU), 0x4A09C011U, \
-        SM_CFG_W1(0x00018960U), 0x20380001U, \
-        SM_CFG_W1(0x00018964U), 0x2047C011U, \
-        SM_CFG_Z1(0x00018a44U), \
-        SM_CFG_Z1(0x00018a4cU), \
-        SM_CFG_Z1(0x00018a54U), \
-        SM_CFG_Z1(0x00018a5cU), \
-        SM_CFG_Z1(0x00018b44U), \
-        SM_CFG_Z1(0x00018b4cU), \
-        SM_CFG_Z1(0x00018b54U), \
-        SM_CFG_Z1(0x00018b5cU), \
-        SM_CFG_Z1(0x00018c44U), \
-        SM_CFG_Z1(0x00018c4cU), \
-        SM_CFG_Z1(0x00018c54U), \
-        SM_CFG_Z1(0x00018c5cU), \
-        SM_CFG_Z1(0x00018d44U), \
-        SM_CFG_Z1(0x00018d4cU), \
-        SM_CFG_Z1(0x00018d54U), \
-        SM_CFG_Z1(0x00018d5cU), \
-        SM_CFG_Z1(0x00018e44U), \
-        SM_CFG_Z1(0x00018e4cU), \
-        SM_CFG_Z1(0x00018e54U), \
-        SM_CFG_Z1(0x00018e5cU), \
+        SM_CFG_Z1(0x0001885CU), \
+        SM_CFG_WN(0x00018940U, 10U), \
+            0x4A020001U, 0x4A02C011U, 0x4A030001U, 0x4A03C011U, \
+            0x4A050001U, 0x4A0AC011U, 0x4A060001U, 0x4A09C011U, \
+            0x20380001U, 0x2047C011U, \
+        SM_CFG_Z1(0x00018A44U), \
+        SM_CFG_Z1(0x00018A4CU), \
+        SM_CFG_Z1(0x00018A54U), \
+        SM_CFG_Z1(0x00018A5CU), \
+        SM_CFG_Z1(0x00018B44U), \
+        SM_CFG_Z1(0x00018B4CU), \
+        SM_CFG_Z1(0x00018B54U), \
+        SM_CFG_Z1(0x00018B5CU), \
+        SM_CFG_Z1(0x00018C44U), \
+        SM_CFG_Z1(0x00018C4CU), \
+        SM_CFG_Z1(0x00018C54U), \
+        SM_CFG_Z1(0x00018C5CU), \
+        SM_CFG_Z1(0x00018D44U), \
+        SM_CFG_Z1(0x00018D4CU), \
+        SM_CFG_Z1(0x00018D54U), \
+        SM_CFG_Z1(0x00018D5CU), \
+        SM_CFG_Z1(0x00018E44U), \
+        SM_CFG_Z1(0x00018E4CU), \
+        SM_CFG_Z1(0x00018E54U), \
+        SM_CFG_Z1(0x00018E5CU), \
         SM_CFG_W1(0x00019024U), 0x6666U, \
-        SM_CFG_W1(0x00019040U), 0x49C30000U, \
-        SM_CFG_W1(0x00019044U), 0x49C3C001U, \
-        SM_CFG_Z1(0x0001904cU), \
+        SM_CFG_WN(0x00019040U, 2U), \
+            0x49C30000U, 0x49C3C001U, \
+        SM_CFG_Z1(0x0001904CU), \
         SM_CFG_Z1(0x00019054U), \
-        SM_CFG_Z1(0x0001905cU), \
-        SM_CFG_W1(0x00019140U), 0x49C20001U, \
-        SM_CFG_W1(0x00019144U), 0x49C2C011U, \
-        SM_CFG_Z1(0x0001914cU), \
+        SM_CFG_Z1(0x0001905CU), \
+        SM_CFG_WN(0x00019140U, 2U), \
+            0x49C20001U, 0x49C2C011U, \
+        SM_CFG_Z1(0x0001914CU), \
         SM_CFG_Z1(0x00019154U), \
-        SM_CFG_Z1(0x0001915cU), \
-        SM_CFG_W1(0x00019240U), 0x49C50000U, \
-        SM_CFG_W1(0x00019244U), 0x49CAC001U, \
-        SM_CFG_Z1(0x0001924cU), \
+        SM_CFG_Z1(0x0001915CU), \
+        SM_CFG_WN(0x00019240U, 2U), \
+            0x49C50000U, 0x49CAC001U, \
+        SM_CFG_Z1(0x0001924CU), \
         SM_CFG_Z1(0x00019254U), \
-        SM_CFG_Z1(0x0001925cU), \
+        SM_CFG_Z1(0x0001925CU), \
         SM_CFG_Z1(0x00019344U), \
-        SM_CFG_Z1(0x0001934cU), \
+        SM_CFG_Z1(0x0001934CU), \
         SM_CFG_Z1(0x00019354U), \
-        SM_CFG_Z1(0x0001935cU), \
+        SM_CFG_Z1(0x0001935CU), \
         SM_CFG_Z1(0x00019444U), \
-        SM_CFG_Z1(0x0001944cU), \
+        SM_CFG_Z1(0x0001944CU), \
         SM_CFG_Z1(0x00019454U), \
-        SM_CFG_Z1(0x0001945cU), \
+        SM_CFG_Z1(0x0001945CU), \
         SM_CFG_Z1(0x00019544U), \
-        SM_CFG_Z1(0x0001954cU), \
+        SM_CFG_Z1(0x0001954CU), \
         SM_CFG_Z1(0x00019554U), \
-        SM_CFG_Z1(0x0001955cU), \
+        SM_CFG_Z1(0x0001955CU), \
         SM_CFG_Z1(0x00019644U), \
-        SM_CFG_Z1(0x0001964cU), \
+        SM_CFG_Z1(0x0001964CU), \
         SM_CFG_Z1(0x00019654U), \
-        SM_CFG_Z1(0x0001965cU), \
+        SM_CFG_Z1(0x0001965CU), \
         SM_CFG_Z1(0x00019744U), \
-        SM_CFG_Z1(0x0001974cU), \
+        SM_CFG_Z1(0x0001974CU), \
         SM_CFG_Z1(0x00019754U), \
-        SM_CFG_Z1(0x0001975cU), \
+        SM_CFG_Z1(0x0001975CU), \
         SM_CFG_Z1(0x00019844U), \
-        SM_CFG_Z1(0x0001984cU), \
+        SM_CFG_Z1(0x0001984CU), \
         SM_CFG_Z1(0x00019854U), \
-        SM_CFG_Z1(0x0001985cU), \
-        SM_CFG_W1(0x00019940U), 0x49C20001U, \
-        SM_CFG_W1(0x00019944U), 0x49C2C011U, \
-        SM_CFG_W1(0x00019948U), 0x49C30001U, \
-        SM_CFG_W1(0x0001994cU), 0x49C3C011U, \
-        SM_CFG_W1(0x00019950U), 0x49C50001U, \
-        SM_CFG_W1(0x00019954U), 0x49CAC011U, \
-        SM_CFG_W1(0x00019958U), 0x49C60001U, \
-        SM_CFG_W1(0x0001995cU), 0x49C9C011U, \
-        SM_CFG_W1(0x00019960U), 0x20280001U, \
-        SM_CFG_W1(0x00019964U), 0x2037C011U, \
-        SM_CFG_Z1(0x00019a44U), \
-        SM_CFG_Z1(0x00019a4cU), \
-        SM_CFG_Z1(0x00019a54U), \
-        SM_CFG_Z1(0x00019a5cU), \
-        SM_CFG_Z1(0x00019b44U), \
-        SM_CFG_Z1(0x00019b4cU), \
-        SM_CFG_Z1(0x00019b54U), \
-        SM_CFG_Z1(0x00019b5cU), \
-        SM_CFG_Z1(0x00019c44U), \
-        SM_CFG_Z1(0x00019c4cU), \
-        SM_CFG_Z1(0x00019c54U), \
-        SM_CFG_Z1(0x00019c5cU), \
-        SM_CFG_Z1(0x00019d44U), \
-        SM_CFG_Z1(0x00019d4cU), \
-        SM_CFG_Z1(0x00019d54U), \
-        SM_CFG_Z1(0x00019d5cU), \
-        SM_CFG_W1(0x00019e40U), 0x49C60001U, \
-        SM_CFG_W1(0x00019e44U), 0x49C9C011U, \
-        SM_CFG_W1(0x00019e48U), 0x20280001U, \
-        SM_CFG_W1(0x00019e4cU), 0x2037C011U, \
-        SM_CFG_Z1(0x00019e54U), \
-        SM_CFG_Z1(0x00019e5cU), \
-        SM_CFG_Z1(0x0001a244U), \
-        SM_CFG_Z1(0x0001a24cU), \
-        SM_CFG_Z1(0x0001a254U), \
-        SM_CFG_Z1(0x0001a25cU), \
-        SM_CFG_Z1(0x0001a344U), \
-        SM_CFG_Z1(0x0001a34cU), \
-        SM_CFG_Z1(0x0001a354U), \
-        SM_CFG_Z1(0x0001a35cU), \
-        SM_CFG_Z1(0x0001a444U), \
-        SM_CFG_Z1(0x0001a44cU), \
-        SM_CFG_Z1(0x0001a454U), \
-        SM_CFG_Z1(0x0001a45cU), \
-        SM_CFG_Z1(0x0001a544U), \
-        SM_CFG_Z1(0x0001a54cU), \
-        SM_CFG_Z1(0x0001a554U), \
-        SM_CFG_Z1(0x0001a55cU), \
-        SM_CFG_Z1(0x0001a644U), \
-        SM_CFG_Z1(0x0001a64cU), \
-        SM_CFG_Z1(0x0001a654U), \
-        SM_CFG_Z1(0x0001a65cU), \
-        SM_CFG_Z1(0x0001a744U), \
-        SM_CFG_Z1(0x0001a74cU), \
-        SM_CFG_Z1(0x0001a754U), \
-        SM_CFG_Z1(0x0001a75cU), \
-        SM_CFG_Z1(0x0001a844U), \
-        SM_CFG_Z1(0x0001a84cU), \
-        SM_CFG_Z1(0x0001a854U), \
-        SM_CFG_Z1(0x0001a85cU), \
-        SM_CFG_Z1(0x0001a944U), \
-        SM_CFG_Z1(0x0001a94cU), \
-        SM_CFG_Z1(0x0001a954U), \
-        SM_CFG_Z1(0x0001a95cU), \
-        SM_CFG_Z1(0x0001aa44U), \
-        SM_CFG_Z1(0x0001aa4cU), \
-        SM_CFG_Z1(0x0001aa54U), \
-        SM_CFG_Z1(0x0001aa5cU), \
-        SM_CFG_Z1(0x0001ab44U), \
-        SM_CFG_Z1(0x0001ab4cU), \
-        SM_CFG_Z1(0x0001ab54U), \
-        SM_CFG_Z1(0x0001ab5cU), \
-        SM_CFG_Z1(0x0001ac44U), \
-        SM_CFG_Z1(0x0001ac4cU), \
-        SM_CFG_Z1(0x0001ac54U), \
-        SM_CFG_Z1(0x0001ac5cU), \
-        SM_CFG_Z1(0x0001ad44U), \
-        SM_CFG_Z1(0x0001ad4cU), \
-        SM_CFG_Z1(0x0001ad54U), \
-        SM_CFG_Z1(0x0001ad5cU), \
-        SM_CFG_Z1(0x0001ae44U), \
-        SM_CFG_Z1(0x0001ae4cU), \
-        SM_CFG_Z1(0x0001ae54U), \
-        SM_CFG_Z1(0x0001ae5cU), \
+        SM_CFG_Z1(0x0001985CU), \
+        SM_CFG_WN(0x00019940U, 10U), \
+            0x49C20001U, 0x49C2C011U, 0x49C30001U, 0x49C3C011U, \
+            0x49C50001U, 0x49CAC011U, 0x49C60001U, 0x49C9C011U, \
+            0x20280001U, 0x2037C011U, \
+        SM_CFG_Z1(0x00019A44U), \
+        SM_CFG_Z1(0x00019A4CU), \
+        SM_CFG_Z1(0x00019A54U), \
+        SM_CFG_Z1(0x00019A5CU), \
+        SM_CFG_Z1(0x00019B44U), \
+        SM_CFG_Z1(0x00019B4CU), \
+        SM_CFG_Z1(0x00019B54U), \
+        SM_CFG_Z1(0x00019B5CU), \
+        SM_CFG_Z1(0x00019C44U), \
+        SM_CFG_Z1(0x00019C4CU), \
+        SM_CFG_Z1(0x00019C54U), \
+        SM_CFG_Z1(0x00019C5CU), \
+        SM_CFG_Z1(0x00019D44U), \
+        SM_CFG_Z1(0x00019D4CU), \
+        SM_CFG_Z1(0x00019D54U), \
+        SM_CFG_Z1(0x00019D5CU), \
+        SM_CFG_WN(0x00019E40U, 4U), \
+            0x49C60001U, 0x49C9C011U, 0x20280001U, 0x2037C011U, \
+        SM_CFG_Z1(0x00019E54U), \
+        SM_CFG_Z1(0x00019E5CU), \
+        SM_CFG_Z1(0x0001A244U), \
+        SM_CFG_Z1(0x0001A24CU), \
+        SM_CFG_Z1(0x0001A254U), \
+        SM_CFG_Z1(0x0001A25CU), \
+        SM_CFG_Z1(0x0001A344U), \
+        SM_CFG_Z1(0x0001A34CU), \
+        SM_CFG_Z1(0x0001A354U), \
+        SM_CFG_Z1(0x0001A35CU), \
+        SM_CFG_Z1(0x0001A444U), \
+        SM_CFG_Z1(0x0001A44CU), \
+        SM_CFG_Z1(0x0001A454U), \
+        SM_CFG_Z1(0x0001A45CU), \
+        SM_CFG_Z1(0x0001A544U), \
+        SM_CFG_Z1(0x0001A54CU), \
+        SM_CFG_Z1(0x0001A554U), \
+        SM_CFG_Z1(0x0001A55CU), \
+        SM_CFG_Z1(0x0001A644U), \
+        SM_CFG_Z1(0x0001A64CU), \
+        SM_CFG_Z1(0x0001A654U), \
+        SM_CFG_Z1(0x0001A65CU), \
+        SM_CFG_Z1(0x0001A744U), \
+        SM_CFG_Z1(0x0001A74CU), \
+        SM_CFG_Z1(0x0001A754U), \
+        SM_CFG_Z1(0x0001A75CU), \
+        SM_CFG_Z1(0x0001A844U), \
+        SM_CFG_Z1(0x0001A84CU), \
+        SM_CFG_Z1(0x0001A854U), \
+        SM_CFG_Z1(0x0001A85CU), \
+        SM_CFG_Z1(0x0001A944U), \
+        SM_CFG_Z1(0x0001A94CU), \
+        SM_CFG_Z1(0x0001A954U), \
+        SM_CFG_Z1(0x0001A95CU), \
+        SM_CFG_Z1(0x0001AA44U), \
+        SM_CFG_Z1(0x0001AA4CU), \
+        SM_CFG_Z1(0x0001AA54U), \
+        SM_CFG_Z1(0x0001AA5CU), \
+        SM_CFG_Z1(0x0001AB44U), \
+        SM_CFG_Z1(0x0001AB4CU), \
+        SM_CFG_Z1(0x0001AB54U), \
+        SM_CFG_Z1(0x0001AB5CU), \
+        SM_CFG_Z1(0x0001AC44U), \
+        SM_CFG_Z1(0x0001AC4CU), \
+        SM_CFG_Z1(0x0001AC54U), \
+        SM_CFG_Z1(0x0001AC5CU), \
+        SM_CFG_Z1(0x0001AD44U), \
+        SM_CFG_Z1(0x0001AD4CU), \
+        SM_CFG_Z1(0x0001AD54U), \
+        SM_CFG_Z1(0x0001AD5CU), \
+        SM_CFG_Z1(0x0001AE44U), \
+        SM_CFG_Z1(0x0001AE4CU), \
+        SM_CFG_Z1(0x0001AE54U), \
+        SM_CFG_Z1(0x0001AE5CU), \
         SM_CFG_Z1(0x00010020U), \
         SM_CFG_Z1(0x00012020U), \
         SM_CFG_Z1(0x00014020U), \
@@ -1520,35 +1132,35 @@
         SM_CFG_W1(0x00000840U), 0xB0000053U, \
         SM_CFG_W1(0x00000860U), 0xB0000053U, \
         SM_CFG_W1(0x00000880U), 0xB0000053U, \
-        SM_CFG_W1(0x000008a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000008e0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000008E0U), 0xB0000053U, \
         SM_CFG_W1(0x00000900U), 0xB0000053U, \
         SM_CFG_W1(0x00000920U), 0xB0000053U, \
         SM_CFG_W1(0x00000940U), 0xB0000053U, \
         SM_CFG_W1(0x00000960U), 0xB0000053U, \
         SM_CFG_W1(0x00000980U), 0xB0000053U, \
-        SM_CFG_W1(0x000009a0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009c0U), 0xB0000053U, \
-        SM_CFG_W1(0x000009e0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000a80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000aa0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ac0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ae0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b20U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b40U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b60U), 0xB0000053U, \
-        SM_CFG_W1(0x00000b80U), 0xB0000053U, \
-        SM_CFG_W1(0x00000ba0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000bc0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000be0U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c00U), 0xB0000053U, \
-        SM_CFG_W1(0x00000c20U), 0xB0000053U, \
+        SM_CFG_W1(0x000009A0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009C0U), 0xB0000053U, \
+        SM_CFG_W1(0x000009E0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000A80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000AE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B20U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B40U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B60U), 0xB0000053U, \
+        SM_CFG_W1(0x00000B80U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BA0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BC0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000BE0U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C00U), 0xB0000053U, \
+        SM_CFG_W1(0x00000C20U), 0xB0000053U, \
         SM_CFG_C1(0x00000000U), 0x0000C001U, \
         SM_CFG_END \
     }
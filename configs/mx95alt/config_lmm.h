@@ -128,6 +128,21 @@
      .numArg = 1, .arg[0] = 3U, }, \
     {.lmId = 1U, .mSel = 2U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_A55C0},
 
+/*! LM start program steps */
+#define SM_LM_START_STEP_DATA \
+    0U, \
+    1U, 3U, 5U, \
+    2U, 4U, 6U, 7U,
+
+/*! LM start programs, per LM and mSel */
+#define SM_LM_START_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 1U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [1][1] = {.first = 1U, .num = 3U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)}, \
+    [1][2] = {.first = 4U, .num = 4U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P) | (1UL << DEV_SM_CPU_A55C0)},
+
 /*! Config for number of stop */
 #define SM_LM_NUM_STOP  22U
 
@@ -156,6 +171,21 @@
     {.lmId = 1U, .mSel = 1U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_M7}, \
     {.lmId = 1U, .mSel = 2U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_M7},
 
+/*! LM stop program steps */
+#define SM_LM_STOP_STEP_DATA \
+    0U, 3U, \
+    1U, 4U, 6U, 8U, 10U, 12U, 14U, 16U, 18U, 20U, \
+    2U, 5U, 7U, 9U, 11U, 13U, 15U, 17U, 19U, 21U,
+
+/*! LM stop programs, per LM and mSel */
+#define SM_LM_STOP_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [1][1] = {.first = 2U, .num = 10U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P) | (1UL << DEV_SM_CPU_M7P)}, \
+    [1][2] = {.first = 12U, .num = 10U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P) | (1UL << DEV_SM_CPU_M7P)},
+
 /*--------------------------------------------------------------------------*/
 /* LM Fault Lists                                                           */
 /*--------------------------------------------------------------------------*/
@@ -161,6 +161,30 @@
     {.lmId = 2U, .mSel = 1U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_A55C0}, \
     {.lmId = 2U, .mSel = 2U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_A55C0},
 
+/*! LM start program steps */
+#define SM_LM_START_STEP_DATA \
+    0U, 3U, \
+    1U, 4U, \
+    2U, 5U, \
+    6U, 9U, 12U, 15U, \
+    7U, 10U, 13U, 16U, \
+    8U, 11U, 14U, 17U,
+
+/*! LM start programs, per LM and mSel */
+#define SM_LM_START_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [1][1] = {.first = 2U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [1][2] = {.first = 4U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [2][0] = {.first = 6U, .num = 4U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)}, \
+    [2][1] = {.first = 10U, .num = 4U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)}, \
+    [2][2] = {.first = 14U, .num = 4U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55C0)},
+
 /*! Config for number of stop */
 #define SM_LM_NUM_STOP  33U
 
@@ -200,6 +224,30 @@
     {.lmId = 2U, .mSel = 1U, .ss = LMM_SS_VOLT, .rsrc = DEV_SM_VOLT_ARM}, \
     {.lmId = 2U, .mSel = 2U, .ss = LMM_SS_VOLT, .rsrc = DEV_SM_VOLT_ARM},
 
+/*! LM stop program steps */
+#define SM_LM_STOP_STEP_DATA \
+    0U, 3U, \
+    1U, 4U, \
+    2U, 5U, \
+    6U, 9U, 12U, 15U, 18U, 21U, 24U, 27U, 30U, \
+    7U, 10U, 13U, 16U, 19U, 22U, 25U, 28U, 31U, \
+    8U, 11U, 14U, 17U, 20U, 23U, 26U, 29U, 32U,
+
+/*! LM stop programs, per LM and mSel */
+#define SM_LM_STOP_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [1][1] = {.first = 2U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [1][2] = {.first = 4U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_M7P)}, \
+    [2][0] = {.first = 6U, .num = 9U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P)}, \
+    [2][1] = {.first = 15U, .num = 9U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P)}, \
+    [2][2] = {.first = 24U, .num = 9U, \
+     .cpuMask = (1UL << DEV_SM_CPU_A55P)},
+
 /*--------------------------------------------------------------------------*/
 /* LM Fault Lists                                                           */
 /*--------------------------------------------------------------------------*/
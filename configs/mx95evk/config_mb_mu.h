@@ -112,6 +112,12 @@
     SM_MB_MU1_CONFIG, \
     SM_MB_MU3_CONFIG
 
+/*! Config data for MU to MB instance map (instance + 1) */
+#define SM_MB_MU_MAP_DATA \
+    [1U] = 2U, \
+    [3U] = 3U, \
+    [9U] = 1U
+
 #endif /* CONFIG_MB_MU_H */
 
 /** @} */
@@ -109,8 +109,10 @@
         .rpcType = SM_RPC_SCMI, \
         .rpcInst = 2U, \
         .boot[0] = 4U, \
+        .deadline = 100U, \
         .safeType = LMM_SAFE_TYPE_SEENV, \
         .autoBoot = LMM_AUTO_BOTH, \
+        .warm = LMM_WARM_PD, \
         .start = 11U, \
         .stop = 11U, \
     }
@@ -167,6 +169,21 @@
     {.lmId = 3U, .mSel = 0U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_2}, \
     {.lmId = 3U, .mSel = 0U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_2},
 
+/*! LM start program steps */
+#define SM_LM_START_STEP_DATA \
+    0U, 1U, 2U, 3U, 4U, \
+    5U, 6U, 7U, 8U, 9U, \
+    10U, 11U,
+
+/*! LM start programs, per LM and mSel */
+#define SM_LM_START_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 5U, \
+     .cpuMask = (1UL << DEV_SM_CPU_1)}, \
+    [2][0] = {.first = 5U, .num = 5U, \
+     .cpuMask = (1UL << DEV_SM_CPU_2)}, \
+    [3][0] = {.first = 10U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_2)},
+
 /*! Config for number of stop */
 #define SM_LM_NUM_STOP  12U
 
@@ -187,6 +204,21 @@
     {.lmId = 3U, .mSel = 0U, .ss = LMM_SS_CPU, .rsrc = DEV_SM_CPU_2}, \
     {.lmId = 3U, .mSel = 0U, .ss = LMM_SS_PD, .rsrc = DEV_SM_PD_2},
 
+/*! LM stop program steps */
+#define SM_LM_STOP_STEP_DATA \
+    0U, 1U, 2U, 3U, 4U, \
+    5U, 6U, 7U, 8U, 9U, \
+    10U, 11U,
+
+/*! LM stop programs, per LM and mSel */
+#define SM_LM_STOP_PROG_DATA \
+    [1][0] = {.first = 0U, .num = 5U, \
+     .cpuMask = (1UL << DEV_SM_CPU_1)}, \
+    [2][0] = {.first = 5U, .num = 5U, \
+     .cpuMask = (1UL << DEV_SM_CPU_2)}, \
+    [3][0] = {.first = 10U, .num = 2U, \
+     .cpuMask = (1UL << DEV_SM_CPU_2)},
+
 /*--------------------------------------------------------------------------*/
 /* LM Fault Lists                                                           */
 /*--------------------------------------------------------------------------*/
@@ -77,6 +77,9 @@
         .pdPerms[DEV_SM_PD_1] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_4] = SM_SCMI_PERM_ALL, \
         .perlpiPerms[DEV_SM_PERLPI_RESV] = SM_SCMI_PERM_ALL, \
+        .pinGrpPerms[0] = SM_SCMI_PERM_ALL, \
+        .pinPerms[DEV_SM_PIN_2] = SM_SCMI_PERM_ALL, \
+        .pinPerms[DEV_SM_PIN_3] = SM_SCMI_PERM_ALL, \
         .sensorPerms[DEV_SM_SENSOR_0] = SM_SCMI_PERM_ALL, \
         .sysPerms = SM_SCMI_PERM_ALL, \
     }
@@ -132,6 +135,8 @@
         .domId = 3U, \
         .secure = 1U, \
         .seenvId = 2U, \
+        .schedPrio = 1U, \
+        .schedWeight = 2U, \
         .basePerms[DEV_SM_BASE_DEV_TEST] = SM_SCMI_PERM_PRIV, \
         .buttonPerms[DEV_SM_BUTTON_0] = SM_SCMI_PERM_NOTIFY, \
         .clkPerms[DEV_SM_CLK_0] = SM_SCMI_PERM_GET, \
@@ -187,6 +192,8 @@
         .domId = 3U, \
         .secure = 0U, \
         .seenvId = 3U, \
+        .schedPrio = 1U, \
+        .schedBudget = 1U, \
         .basePerms[DEV_SM_BASE_AGENT_1] = SM_SCMI_PERM_ALL, \
         .buttonPerms[DEV_SM_BUTTON_0] = SM_SCMI_PERM_ALL, \
         .clkPerms[DEV_SM_CLK_2] = SM_SCMI_PERM_ALL, \
@@ -246,6 +253,7 @@
         .domId = 16U, \
         .secure = 0U, \
         .seenvId = 4U, \
+        .schedPrio = 2U, \
         .cpuPerms[DEV_SM_CPU_2] = SM_SCMI_PERM_ALL, \
         .perlpiPerms[DEV_SM_PERLPI_RESV] = SM_SCMI_PERM_ALL, \
     }
@@ -329,6 +337,89 @@
 /*! Max words to buffer for notification messages */
 #define SM_SCMI_MAX_NOTIFY  24U
 
+/*--------------------------------------------------------------------------*/
+/* SCMI Pin Group Config                                                    */
+/*--------------------------------------------------------------------------*/
+
+/*! Config for SCMI pin group 0 */
+#define SM_SCMI_PIN_GRP0_CONFIG \
+    { \
+        .name = "grp_a", \
+        .firstPin = 0U, \
+        .numPins = 2U, \
+    }
+
+/*! Config for SCMI pin group 1 */
+#define SM_SCMI_PIN_GRP1_CONFIG \
+    { \
+        .name = "grp_b", \
+        .firstPin = 2U, \
+        .numPins = 2U, \
+    }
+
+/*! Config for number of SCMI pin groups */
+#define SM_SCMI_NUM_PIN_GRP  2U
+
+/*! Config for number of pins in all SCMI pin groups */
+#define SM_SCMI_NUM_PIN_GRP_PINS  4U
+
+/*! Config data array for SCMI pin groups */
+#define SM_SCMI_PIN_GRP_CONFIG_DATA \
+    SM_SCMI_PIN_GRP0_CONFIG, \
+    SM_SCMI_PIN_GRP1_CONFIG
+
+/*! Config data array for pins in SCMI pin groups */
+#define SM_SCMI_PIN_GRP_PINS_DATA \
+    DEV_SM_PIN_2, \
+    DEV_SM_PIN_3, \
+    DEV_SM_PIN_0, \
+    DEV_SM_PIN_1
+
+/*! Config for number of SCMI pin group references */
+#define SM_SCMI_NUM_PIN_GRP_REFS  4U
+
+/*! Config data array for groups containing each pin */
+#define SM_SCMI_PIN_GRP_REFS_DATA \
+    0U, \
+    0U, \
+    1U, \
+    1U
+
+/*! Config data array for pin to group index */
+#define SM_SCMI_PIN_GRP_IDX_DATA \
+    [DEV_SM_PIN_2] = {.firstGrp = 0U, .numGrp = 1U}, \
+    [DEV_SM_PIN_3] = {.firstGrp = 1U, .numGrp = 1U}, \
+    [DEV_SM_PIN_0] = {.firstGrp = 2U, .numGrp = 1U}, \
+    [DEV_SM_PIN_1] = {.firstGrp = 3U, .numGrp = 1U}
+
+/*--------------------------------------------------------------------------*/
+/* SCMI Pin Function Config                                                 */
+/*--------------------------------------------------------------------------*/
+
+/*! Config for SCMI pin function 0 */
+#define SM_SCMI_PIN_FUNC0_CONFIG \
+    { \
+        .name = "func_a", \
+        .grp = 0U, \
+        .mux = 1U, \
+    }
+
+/*! Config for SCMI pin function 1 */
+#define SM_SCMI_PIN_FUNC1_CONFIG \
+    { \
+        .name = "func_b", \
+        .grp = 1U, \
+        .mux = 2U, \
+    }
+
+/*! Config for number of SCMI pin functions */
+#define SM_SCMI_NUM_PIN_FUNC  2U
+
+/*! Config data array for SCMI pin functions */
+#define SM_SCMI_PIN_FUNC_CONFIG_DATA \
+    SM_SCMI_PIN_FUNC0_CONFIG, \
+    SM_SCMI_PIN_FUNC1_CONFIG
+
 #endif /* CONFIG_SCMI_H */
 
 /** @} */
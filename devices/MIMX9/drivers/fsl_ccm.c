@@ -31,6 +31,7 @@
 
 #include "fsl_clock.h"
 #include "fsl_ccm.h"
+#include "fsl_fixmath.h"
 #include "fsl_cpu.h"
 #include "fsl_power.h"
 #include "fsl_device_registers.h"
@@ -132,7 +133,7 @@ uint64_t CCM_RootGetRate(uint32_t rootIdx)
                 = (rootCtrl & CCM_CLOCK_ROOT_DIV_MASK)
                 >> CCM_CLOCK_ROOT_DIV_SHIFT;
 
-            rate = rate / (((uint64_t) rootDiv) + 1ULL);
+            rate = FIXMATH_DivU64U16(rate, rootDiv + 1U);
         }
     }
 
@@ -155,7 +156,7 @@ bool CCM_RootSetRate(uint32_t rootIdx, uint64_t rate, uint32_t roundRule)
         uint64_t newRate = rate + 1ULL;
 
         /* Calculate integer divider needed to achieve specified rate */
-        uint64_t quotient = srcRate / newRate;
+        uint64_t quotient = FIXMATH_DivU64(srcRate, newRate);
 
         /* Apply rounding rule */
         switch (roundRule)
@@ -197,8 +198,10 @@ bool CCM_RootSetRate(uint32_t rootIdx, uint64_t rate, uint32_t roundRule)
                 /* Otherwise, compare rates of closest dividers */
                 else
                 {
-                    uint64_t floorRate = srcRate / quotient;
-                    uint64_t ceilingRate = srcRate / (quotient + 1U);
+                    uint64_t floorRate = FIXMATH_DivU64U16(srcRate,
+                        U64_U32(quotient));
+                    uint64_t ceilingRate = FIXMATH_DivU64U16(srcRate,
+                        U64_U32(quotient + 1U));
 
                     uint64_t floorDelta = floorRate - newRate;
                     uint64_t ceilingDelta = newRate - ceilingRate;
@@ -32,6 +32,7 @@
 #include "fsl_def.h"
 #include "fsl_clock.h"
 #include "fsl_fract_pll.h"
+#include "fsl_fixmath.h"
 #include "fsl_device_registers.h"
 
 /* Local Defines */
@@ -41,6 +42,8 @@
 /* Local Types */
 
 /* Local Functions */
+static bool FRACTPLL_ProgramRate(uint32_t pllIdx, uint32_t mfi,
+    uint32_t mfn, uint32_t odiv);
 static bool FRACTPLL_DynamicSetRate(uint32_t pllIdx, uint64_t vcoRate);
 static bool FRACTPLL_EnableSsc(uint32_t pllIdx, uint32_t mfi, uint32_t mfn);
 
@@ -198,8 +201,8 @@ uint64_t FRACTPLL_GetRate(uint32_t pllIdx, bool vcoOp)
 
             uint32_t mfd = pll->DENOMINATOR.RW;
 
-            rate = (CLOCK_PLL_FREF_HZ * mfi) + ((CLOCK_PLL_FREF_HZ * mfn)
-                / mfd);
+            rate = (CLOCK_PLL_FREF_HZ * mfi)
+                + FIXMATH_DivU64(CLOCK_PLL_FREF_HZ * mfn, mfd);
         }
         else
         {
@@ -208,7 +211,7 @@ uint64_t FRACTPLL_GetRate(uint32_t pllIdx, bool vcoOp)
 
         if (vcoOp)
         {
-            rate = rate / ((uint64_t) rdiv);
+            rate = FIXMATH_DivU64U16(rate, rdiv);
         }
         else
         {
@@ -219,7 +222,7 @@ uint64_t FRACTPLL_GetRate(uint32_t pllIdx, bool vcoOp)
                 odiv += 2U;
             }
 
-            rate = rate / (((uint64_t) rdiv) * ((uint64_t) odiv));
+            rate = FIXMATH_DivU64U16(rate, rdiv * odiv);
         }
     }
 
@@ -256,23 +259,8 @@ bool FRACTPLL_UpdateRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
             pll->CTRL.CLR = PLL_CTRL_POWERUP_MASK;
         }
 
-        /* Set rdiv, mfi, and odiv */
-        pll->DIV.RW = PLL_DIV_MFI(mfi) | PLL_DIV_RDIV(0U)
-            | PLL_DIV_ODIV(odiv);
-
-        /* Disable spread spectrum */
-        pll->SPREAD_SPECTRUM.RW = 0U;
-
-        /* Check if MFN/MFD calculation and configuration needed */
-        if (g_pllAttrs[pllIdx].isFrac)
-        {
-            /* Set mfn and mfd */
-            pll->NUMERATOR.RW   = PLL_NUMERATOR_MFN(mfn);
-            pll->DENOMINATOR.RW = PLL_DENOMINATOR_MFD(CLOCK_PLL_MFD);
-        }
-
-        /* Enable Spread Spectrum */
-        bool status = FRACTPLL_EnableSsc(pllIdx, mfi, mfn);
+        /* Program dividers */
+        bool status = FRACTPLL_ProgramRate(pllIdx, mfi, mfn, odiv);
 
         if (status == true)
         {
@@ -311,6 +299,92 @@ bool FRACTPLL_UpdateRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
     return updateRate;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check if PLL is locked at a rate                                         */
+/*--------------------------------------------------------------------------*/
+bool FRACTPLL_RateMatch(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
+    uint32_t odiv)
+{
+    bool match = false;
+
+    if (pllIdx < CLOCK_NUM_PLL)
+    {
+        const PLL_Type *pll = s_pllPtrs[pllIdx];
+        uint32_t div = PLL_DIV_MFI(mfi) | PLL_DIV_RDIV(0U)
+            | PLL_DIV_ODIV(odiv);
+
+        /* Must be running and locked with same dividers */
+        match = ((pll->CTRL.RW & PLL_CTRL_POWERUP_MASK) != 0U)
+            && ((pll->PLL_STATUS & PLL_PLL_STATUS_PLL_LOCK_MASK) != 0U)
+            && (pll->DIV.RW == div);
+
+        /* Check MFN for fractional PLLs */
+        if (match && g_pllAttrs[pllIdx].isFrac)
+        {
+            match = (pll->NUMERATOR.RW == PLL_NUMERATOR_MFN(mfn));
+        }
+    }
+
+    return match;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start PLL relock at a new rate                                           */
+/*--------------------------------------------------------------------------*/
+bool FRACTPLL_StartRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
+    uint32_t odiv)
+{
+    bool started = false;
+
+    if (pllIdx < CLOCK_NUM_PLL)
+    {
+        PLL_Type *pll = s_pllPtrs[pllIdx];
+
+        /* Disable PLL output */
+        pll->CTRL.CLR = PLL_CTRL_CLKMUX_EN_MASK;
+
+        /* Disable PLL */
+        pll->CTRL.CLR = PLL_CTRL_POWERUP_MASK;
+
+        /* Program dividers */
+        if (FRACTPLL_ProgramRate(pllIdx, mfi, mfn, odiv))
+        {
+            /* Wait before POWERUP */
+            SystemTimeDelay(ES_MAX_USEC_PLL_PREP);
+
+            /* Power up for locking, caller polls FRACTPLL_RateLocked() */
+            pll->CTRL.SET = PLL_CTRL_POWERUP_MASK;
+
+            started = true;
+        }
+    }
+
+    return started;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete PLL relock                                                      */
+/*--------------------------------------------------------------------------*/
+bool FRACTPLL_RateLocked(uint32_t pllIdx)
+{
+    bool locked = false;
+
+    if (pllIdx < CLOCK_NUM_PLL)
+    {
+        PLL_Type *pll = s_pllPtrs[pllIdx];
+
+        if ((pll->PLL_STATUS & PLL_PLL_STATUS_PLL_LOCK_MASK) != 0U)
+        {
+            /* Enable PLL output */
+            pll->CTRL.SET = PLL_CTRL_CLKMUX_EN_MASK;
+
+            locked = true;
+        }
+    }
+
+    return locked;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Dynamically set PLL clock rate                                           */
 /*--------------------------------------------------------------------------*/
@@ -564,7 +638,7 @@ uint64_t FRACTPLL_GetDfsRate(uint32_t pllIdx, uint8_t dfsIdx,
             /* Check the multiplication doesn't wrap */
             if (rate <= (UINT64_MAX / 5U))
             {
-                rate = (rate * 5U) / ((mfi * 5U) + mfn);
+                rate = FIXMATH_DivU64U16(rate * 5U, (mfi * 5U) + mfn);
 
                 if (div2)
                 {
@@ -943,6 +1017,33 @@ bool FRACTPLL_CalcSscParams(const fracpll_ssc_t *pllSsc, uint64_t rate,
     return updateSsc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Program PLL dividers                                                     */
+/*--------------------------------------------------------------------------*/
+static bool FRACTPLL_ProgramRate(uint32_t pllIdx, uint32_t mfi,
+    uint32_t mfn, uint32_t odiv)
+{
+    PLL_Type *pll = s_pllPtrs[pllIdx];
+
+    /* Set rdiv, mfi, and odiv */
+    pll->DIV.RW = PLL_DIV_MFI(mfi) | PLL_DIV_RDIV(0U)
+        | PLL_DIV_ODIV(odiv);
+
+    /* Disable spread spectrum */
+    pll->SPREAD_SPECTRUM.RW = 0U;
+
+    /* Check if MFN/MFD calculation and configuration needed */
+    if (g_pllAttrs[pllIdx].isFrac)
+    {
+        /* Set mfn and mfd */
+        pll->NUMERATOR.RW   = PLL_NUMERATOR_MFN(mfn);
+        pll->DENOMINATOR.RW = PLL_DENOMINATOR_MFD(CLOCK_PLL_MFD);
+    }
+
+    /* Enable Spread Spectrum */
+    return FRACTPLL_EnableSsc(pllIdx, mfi, mfn);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Enable Spread Spectrum                                                   */
 /*--------------------------------------------------------------------------*/
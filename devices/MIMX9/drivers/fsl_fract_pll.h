@@ -156,6 +156,52 @@ uint64_t FRACTPLL_GetRate(uint32_t pllIdx, bool vcoOp);
 bool FRACTPLL_UpdateRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
     uint32_t odiv, bool forceActive);
 
+/*!
+ * Check PLL clock rate
+ *
+ * @param[in]   pllIdx      PLL identifier
+ * @param[in]   mfi         Integer portion of loop divider
+ * @param[in]   mfn         Numerator of fractional loop divider
+ * @param[in]   odiv        Output frequency divider for clock output
+ *
+ * This function checks if the PLL is powered, locked, and programmed
+ * with the specified dividers. Used to skip a relock.
+ *
+ * @return Return true if PLL is locked at the rate.
+ */
+bool FRACTPLL_RateMatch(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
+    uint32_t odiv);
+
+/*!
+ * Start PLL clock rate update
+ *
+ * @param[in]   pllIdx      PLL identifier
+ * @param[in]   mfi         Integer portion of loop divider
+ * @param[in]   mfn         Numerator of fractional loop divider
+ * @param[in]   odiv        Output frequency divider for clock output
+ *
+ * This function powers down the PLL, programs the new rate, and powers
+ * it back up without waiting for lock. The PLL output remains disabled
+ * until FRACTPLL_RateLocked() returns true. Clients must be switched to
+ * another source before calling.
+ *
+ * @return Return true if PLL relock is started.
+ */
+bool FRACTPLL_StartRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
+    uint32_t odiv);
+
+/*!
+ * Complete PLL clock rate update
+ *
+ * @param[in]   pllIdx      PLL identifier
+ *
+ * This function checks for lock after FRACTPLL_StartRate() and enables
+ * the PLL output once locked.
+ *
+ * @return Return true if PLL is locked and output enabled.
+ */
+bool FRACTPLL_RateLocked(uint32_t pllIdx);
+
 /*!
  * Set PLL clock rate
  *
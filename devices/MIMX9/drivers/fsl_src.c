@@ -510,6 +510,18 @@ static bool SRC_MixRstExitPoll(uint32_t srcMixIdx, uint32_t timeoutUsec)
 /*--------------------------------------------------------------------------*/
 void SRC_MixSoftPowerDown(uint32_t srcMixIdx)
 {
+    /* Request power down and wait for completion */
+    bool started = SRC_MixSoftPowerDownStart(srcMixIdx);
+    SRC_MixSoftPowerDownFinish(srcMixIdx, started);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start software-controlled power down of MIX slice                        */
+/*--------------------------------------------------------------------------*/
+bool SRC_MixSoftPowerDownStart(uint32_t srcMixIdx)
+{
+    bool started = false;
+
     if (srcMixIdx < PWR_NUM_MIX_SLICE)
     {
         src_mix_slice_t *srcMix = s_srcMixPtrs[srcMixIdx];
@@ -545,37 +557,29 @@ void SRC_MixSoftPowerDown(uint32_t srcMixIdx)
             /* Request software-controlled power down */
             srcMix->SLICE_SW_CTRL |= SLICE_SW_CTRL_PDN_SOFT_MASK;
 
+            started = true;
+        }
+    }
+
+    return started;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Finish software-controlled power down of MIX slice                       */
+/*--------------------------------------------------------------------------*/
+void SRC_MixSoftPowerDownFinish(uint32_t srcMixIdx, bool started)
+{
+    if (srcMixIdx < PWR_NUM_MIX_SLICE)
+    {
+        if (started)
+        {
 #ifdef PWR_MIX_FLAG_QCH_TIMEOUT
-            /* Wait for power down sequence to compete */
-            if ((g_pwrMixMgmtInfo[srcMixIdx].flags & PWR_MIX_FLAG_QCH_TIMEOUT) == 0U)
-            {
-                while (!SRC_MixPowerDownCompleted(srcMixIdx))
-                {
-                    ; /* Intentional empty while */
-                }
-            }
-            else
-            {
-                /* Poll MIX power down complete or timeout reached */
-                if (!SRC_MixPowerDownPoll(srcMixIdx, 100U))
-                {
-                    /* Use LPCG handshake timeout to complete power down */
-                    uint32_t lpcgIdxStart = g_pwrMixMgmtInfo[srcMixIdx].lpcgIdxStart;
-                    uint32_t lpcgIdxEnd = g_pwrMixMgmtInfo[srcMixIdx].lpcgIdxEnd;
-                    for (uint32_t lpcgIdx = lpcgIdxStart; lpcgIdx <= lpcgIdxEnd; lpcgIdx++)
-                    {
-                        (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, true);
-                    }
-                    (void) SRC_MixPowerDownPoll(srcMixIdx, 1U);
-                    for (uint32_t lpcgIdx = lpcgIdxStart; lpcgIdx <= lpcgIdxEnd; lpcgIdx++)
-                    {
-                        (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, false);
-                    }
-                }
-            }
+            uint32_t timeoutFlag = PWR_MIX_FLAG_QCH_TIMEOUT;
 #else
+            uint32_t timeoutFlag = PWR_MIX_FLAG_SSI_TIMEOUT;
+#endif
             /* Wait for power down sequence to compete */
-            if ((g_pwrMixMgmtInfo[srcMixIdx].flags & PWR_MIX_FLAG_SSI_TIMEOUT) == 0U)
+            if ((g_pwrMixMgmtInfo[srcMixIdx].flags & timeoutFlag) == 0U)
             {
                 while (!SRC_MixPowerDownCompleted(srcMixIdx))
                 {
@@ -588,13 +592,9 @@ void SRC_MixSoftPowerDown(uint32_t srcMixIdx)
                 if (!SRC_MixPowerDownPoll(srcMixIdx, 100U))
                 {
                     /* Use LPCG handshake timeout to complete power down */
-                    uint32_t lpcgIdx = g_pwrMixMgmtInfo[srcMixIdx].ssiLpcgIdx;
-                    (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, true);
-                    (void) SRC_MixPowerDownPoll(srcMixIdx, 1U);
-                    (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, false);
+                    (void) SRC_MixSoftPowerDownForce(srcMixIdx);
                 }
             }
-#endif
             /* Restore A55 handshake */
             SRC_MixSetA55HdskMode(srcMixIdx, SRC_MIX_A55_HDSK_ACK_WAIT);
 
@@ -609,10 +609,73 @@ void SRC_MixSoftPowerDown(uint32_t srcMixIdx)
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Force completion of software-controlled power down of MIX slice          */
+/*--------------------------------------------------------------------------*/
+bool SRC_MixSoftPowerDownForce(uint32_t srcMixIdx)
+{
+    bool rc = false;
+
+    if (srcMixIdx < PWR_NUM_MIX_SLICE)
+    {
+#ifdef PWR_MIX_FLAG_QCH_TIMEOUT
+        if ((g_pwrMixMgmtInfo[srcMixIdx].flags & PWR_MIX_FLAG_QCH_TIMEOUT) != 0U)
+        {
+            /* Use LPCG handshake timeout to complete power down */
+            uint32_t lpcgIdxStart = g_pwrMixMgmtInfo[srcMixIdx].lpcgIdxStart;
+            uint32_t lpcgIdxEnd = g_pwrMixMgmtInfo[srcMixIdx].lpcgIdxEnd;
+            for (uint32_t lpcgIdx = lpcgIdxStart; lpcgIdx <= lpcgIdxEnd; lpcgIdx++)
+            {
+                (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, true);
+            }
+            rc = SRC_MixPowerDownPoll(srcMixIdx, 1U);
+            for (uint32_t lpcgIdx = lpcgIdxStart; lpcgIdx <= lpcgIdxEnd; lpcgIdx++)
+            {
+                (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, false);
+            }
+        }
+#else
+        if ((g_pwrMixMgmtInfo[srcMixIdx].flags & PWR_MIX_FLAG_SSI_TIMEOUT) != 0U)
+        {
+            /* Use LPCG handshake timeout to complete power down */
+            uint32_t lpcgIdx = g_pwrMixMgmtInfo[srcMixIdx].ssiLpcgIdx;
+            (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, true);
+            rc = SRC_MixPowerDownPoll(srcMixIdx, 1U);
+            (void) CCM_LpcgTimeoutSetEnable(lpcgIdx, false);
+        }
+#endif
+    }
+
+    return rc;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Software-controlled power up of MIX slice                                */
 /*--------------------------------------------------------------------------*/
 bool SRC_MixSoftPowerUp(uint32_t srcMixIdx)
+{
+    /* Request power up */
+    bool trans = SRC_MixSoftPowerUpStart(srcMixIdx);
+
+    if (trans)
+    {
+        /* Wait for power up sequence to complete */
+        while (!SRC_MixPowerUpCompleted(srcMixIdx))
+        {
+            ; /* Intentional empty while */
+        }
+    }
+
+    /* Restore handshake and power control */
+    SRC_MixSoftPowerUpFinish(srcMixIdx);
+
+    return trans;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start software-controlled power up of MIX slice                          */
+/*--------------------------------------------------------------------------*/
+bool SRC_MixSoftPowerUpStart(uint32_t srcMixIdx)
 {
     bool trans = false;
 
@@ -635,7 +698,7 @@ bool SRC_MixSoftPowerUp(uint32_t srcMixIdx)
             /* For MIXes that default to OFF, synchronize the software-controlled
              * OFF state which requires MEM_LP_EN by forcing a power off cycle.
              * MIXes that default to OFF can be detected by inspecting the
-             * MEM_STAT field.
+             * MEM_STAT field. Only happens on the first power up.
              */
             if (0U == (srcMix->FUNC_STAT & FUNC_STAT_MEM_STAT_MASK))
             {
@@ -659,15 +722,22 @@ bool SRC_MixSoftPowerUp(uint32_t srcMixIdx)
             /* Request software-controlled power up */
             srcMix->SLICE_SW_CTRL &= ~SLICE_SW_CTRL_PDN_SOFT_MASK;
 
-            /* Wait for power up sequence to complete */
-            while (!SRC_MixPowerUpCompleted(srcMixIdx))
-            {
-                ; /* Intentional empty while */
-            }
-
             /* Indicate a transition happened */
             trans = true;
         }
+    }
+
+    return trans;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Finish software-controlled power up of MIX slice                         */
+/*--------------------------------------------------------------------------*/
+void SRC_MixSoftPowerUpFinish(uint32_t srcMixIdx)
+{
+    if (srcMixIdx < PWR_NUM_MIX_SLICE)
+    {
+        src_mix_slice_t *srcMix = s_srcMixPtrs[srcMixIdx];
 
         /* Restore GPC LP handshake */
         PWR_LpHandshakeMaskSet(srcMixIdx, true);
@@ -687,8 +757,6 @@ bool SRC_MixSoftPowerUp(uint32_t srcMixIdx)
             (void) SRC_MixLpmModeSet(srcMixIdx, true);
         }
     }
-
-    return trans;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -724,6 +792,14 @@ bool SRC_MixIsPwrReady(uint32_t srcMixIdx)
     return SRC_MixPowerUpCompleted(srcMixIdx);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check if MIX slice power down sequence is complete                       */
+/*--------------------------------------------------------------------------*/
+bool SRC_MixIsPwrDown(uint32_t srcMixIdx)
+{
+    return SRC_MixPowerDownCompleted(srcMixIdx);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Block until MIX slice reset phase exits                                  */
 /*--------------------------------------------------------------------------*/
@@ -160,6 +160,50 @@ bool SRC_MemMaskGet(uint32_t srcMixIdx, uint32_t *retMask);
  */
 void SRC_MixSoftPowerDown(uint32_t srcMixIdx);
 
+/*!
+ * Start software-controlled power down of MIX slice
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ *
+ * This function executes the first phase of SRC_MixSoftPowerDown(). It
+ * configures the handshakes and requests the power-down sequence without
+ * waiting for it to complete. Completion can be polled with
+ * SRC_MixIsPwrDown(). The caller must then call
+ * SRC_MixSoftPowerDownFinish().
+ *
+ * @return Returns true if a power-down sequence was requested, false if
+ * the MIX was already off.
+ */
+bool SRC_MixSoftPowerDownStart(uint32_t srcMixIdx);
+
+/*!
+ * Finish software-controlled power down of MIX slice
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ * @param[in]   started         Return value of SRC_MixSoftPowerDownStart()
+ *
+ * This function executes the last phase of SRC_MixSoftPowerDown(). If a
+ * sequence was started, it waits for any remaining completion (using the
+ * LPCG handshake timeout for MIXes that require it) and then restores the
+ * handshakes.
+ */
+void SRC_MixSoftPowerDownFinish(uint32_t srcMixIdx, bool started);
+
+/*!
+ * Force completion of software-controlled power down of MIX slice
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ *
+ * This function uses the LPCG handshake timeout to complete a power-down
+ * sequence started with SRC_MixSoftPowerDownStart() that has not completed
+ * on its own. Only MIXes flagged as requiring the timeout support this.
+ * The caller must still call SRC_MixSoftPowerDownFinish().
+ *
+ * @return Returns true if the power-down sequence completed, false if it
+ * did not or the MIX does not support the timeout.
+ */
+bool SRC_MixSoftPowerDownForce(uint32_t srcMixIdx);
+
 /*!
  * Software-controlled power up of MIX slice
  *
@@ -175,6 +219,31 @@ void SRC_MixSoftPowerDown(uint32_t srcMixIdx);
  */
 bool SRC_MixSoftPowerUp(uint32_t srcMixIdx);
 
+/*!
+ * Start software-controlled power up of MIX slice
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ *
+ * This function executes the first phase of SRC_MixSoftPowerUp(). It
+ * requests the power-up sequence without waiting for it to complete.
+ * Completion can be polled with SRC_MixIsPwrReady(). The caller must then
+ * call SRC_MixSoftPowerUpFinish().
+ *
+ * @return Returns true if a power-up sequence was requested, false if the
+ * MIX was already on.
+ */
+bool SRC_MixSoftPowerUpStart(uint32_t srcMixIdx);
+
+/*!
+ * Finish software-controlled power up of MIX slice
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ *
+ * This function executes the last phase of SRC_MixSoftPowerUp(). It
+ * restores the GPC LP handshake and HW/SW power control.
+ */
+void SRC_MixSoftPowerUpFinish(uint32_t srcMixIdx);
+
 /*!
  * Check MIX slice power switch status
  *
@@ -198,6 +267,19 @@ bool SRC_MixIsPwrSwitchOn(uint32_t srcMixIdx);
  */
 bool SRC_MixIsPwrReady(uint32_t srcMixIdx);
 
+/*!
+ * Check if MIX power down sequence is complete
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ *
+ * This function allows caller to get power down sequence completion status
+ * of MIX.
+ *
+ * @return Returns true if MIX power down sequence is completed, otherwise
+ * false.
+ */
+bool SRC_MixIsPwrDown(uint32_t srcMixIdx);
+
 /*!
  * Block until MIX slice reset phase exits
  *
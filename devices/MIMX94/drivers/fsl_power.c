@@ -387,6 +387,22 @@ bool PWR_Init(uint32_t srcMixIdx)
     return rc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get parent of MIX slice                                                  */
+/*--------------------------------------------------------------------------*/
+uint32_t PWR_ParentGet(uint32_t srcMixIdx)
+{
+    uint32_t parentIdx = PWR_NUM_MIX_SLICE;
+
+    if ((srcMixIdx >= PWR_MIX_SLICE_IDX_A55C0) &&
+        (srcMixIdx <= PWR_MIX_SLICE_IDX_A55C_LAST))
+    {
+        parentIdx = PWR_MIX_SLICE_IDX_A55P;
+    }
+
+    return parentIdx;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Check if parent of MIX slice powered                                     */
 /*--------------------------------------------------------------------------*/
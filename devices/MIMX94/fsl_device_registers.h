@@ -32,6 +32,13 @@
 
 /* SWI mapping */
 #define SWI_0_IRQn Reserved68_IRQn
+#define SWI_1_IRQn Reserved16_IRQn
+
+/* ELE MU mapping */
+#define ELE_MU_IRQn Reserved39_IRQn
+
+/* Tick timer mapping (SYSCTR compare frame 0) */
+#define DEV_SM_TICK_IRQn SYSCTR1_IRQn
 
 #endif /* __FSL_DEVICE_REGISTERS_H__ */
 
@@ -186,6 +186,12 @@ int32_t DEV_SM_Init(uint32_t bootPerfLevel, uint32_t runPerfLevel)
         }
     }
 
+    /* Wait for remaining RDC releases */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_RdcReleaseWait(DEV_SM_NUM_RDC);
+    }
+
     /* Configure BBM */
     if (status == SM_ERR_SUCCESS)
     {
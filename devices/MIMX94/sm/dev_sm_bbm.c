@@ -345,6 +345,41 @@ int32_t DEV_SM_BbmRtcAlarmSet(uint32_t rtcId, bool enable, uint64_t val)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get time until BBM RTC alarm                                             */
+/*--------------------------------------------------------------------------*/
+uint32_t DEV_SM_BbmRtcAlarmUsecGet(void)
+{
+    uint32_t usec = UINT32_MAX;
+
+    /* Alarm enabled? */
+    if ((BBNSM_GetEnabledInterrupts(BBNSM)
+        & ((uint32_t) kBBNSM_RTC_AlarmInterrupt)) != 0U)
+    {
+        uint32_t alarm = BBNSM_RTC_GetAlarm(BBNSM);
+        uint32_t seconds = BBNSM_RTC_GetSeconds(BBNSM);
+
+        /* Discount the partial current second */
+        if (alarm > seconds)
+        {
+            uint32_t delta = alarm - seconds - 1U;
+
+            /* Saturate */
+            if (delta < (UINT32_MAX / 1000000U))
+            {
+                usec = delta * 1000000U;
+            }
+        }
+        else
+        {
+            usec = 0U;
+        }
+    }
+
+    /* Return time until alarm */
+    return usec;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Enable BBM RTC rollover interrupt                                        */
 /*--------------------------------------------------------------------------*/
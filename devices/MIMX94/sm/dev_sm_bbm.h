@@ -107,6 +107,16 @@
 
 /* Functions */
 
+/*!
+ * Get time until the BBM RTC alarm.
+ *
+ * Returns a conservative (rounded down) estimate of the time until an
+ * enabled RTC alarm fires. Used to bound the predicted system idle time.
+ *
+ * @return Returns the time in microseconds, UINT32_MAX if no alarm.
+ */
+uint32_t DEV_SM_BbmRtcAlarmUsecGet(void);
+
 /** @} */
 
 /* Include SM device API */
@@ -182,6 +182,9 @@ int32_t DEV_SM_CpuStart(uint32_t cpuId)
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -206,6 +209,9 @@ int32_t DEV_SM_CpuHold(uint32_t cpuId)
             status = SM_ERR_NOT_FOUND;
         }
     }
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -245,6 +251,9 @@ int32_t DEV_SM_CpuStop(uint32_t cpuId)
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -368,6 +377,9 @@ int32_t DEV_SM_CpuSleepModeSet(uint32_t cpuId, uint32_t sleepMode,
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -404,6 +416,9 @@ int32_t DEV_SM_CpuIrqWakeSet(uint32_t cpuId, uint32_t maskIdx,
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -472,6 +487,9 @@ int32_t DEV_SM_CpuPdLpmConfigSet(uint32_t cpuId, uint32_t domainId,
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "fsl_ele.h"
 
 /* Local defines */
 
@@ -56,7 +57,7 @@ typedef struct
 
 /* Fuse ID map */
 // coverity[misra_c_2012_rule_8_9_violation]
-static dev_sm_fuse_map_t s_fuseMap[DEV_SM_NUM_FUSE] =
+static const dev_sm_fuse_map_t s_fuseMap[DEV_SM_NUM_FUSE] =
 {
     [DEV_SM_FUSE_ECID3]              = {384U,   32U},
     [DEV_SM_FUSE_ECID2]              = {416U,   32U},
@@ -87,8 +88,18 @@ static dev_sm_fuse_map_t s_fuseMap[DEV_SM_NUM_FUSE] =
     [DEV_SM_FUSE_M33_ROM_PATCH_VER]  = {17152U, 32U}
 };
 
+/* Snapshot of fuse fields and derived state */
+static uint32_t s_fuseVal[DEV_SM_NUM_FUSE];
+static bool s_fusePdDisabled[DEV_SM_NUM_POWER];
+static bool s_fuseCpuDisabled[DEV_SM_NUM_CPU];
+
 /* Local functions */
 
+static void DEV_SM_FuseSnapshot(void);
+static uint32_t DEV_SM_FuseRead(uint32_t fuseId);
+static bool DEV_SM_FusePdRead(uint32_t domainId);
+static bool DEV_SM_FuseCpuRead(uint32_t cpuId);
+
 /*--------------------------------------------------------------------------*/
 /* Get address of a fuse word                                               */
 /*--------------------------------------------------------------------------*/
@@ -110,37 +121,46 @@ int32_t DEV_SM_FuseInfoGet(uint32_t fuseWord, uint32_t *addr)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Read a fuse field                                                        */
+/* Init fuses                                                               */
 /*--------------------------------------------------------------------------*/
-uint32_t DEV_SM_FuseGet(uint32_t fuseId)
+void DEV_SM_FuseInit(void)
 {
-    uint32_t fuse;
-    uint32_t shift;
-    uint32_t mask;
-
-    /* Get fuse word */
-    fuse = FSB->FUSE[s_fuseMap[fuseId].bitIdx / 32U];
-
-    /* Calculate shift and mask */
-    shift = ((uint32_t) s_fuseMap[fuseId].bitIdx) % 32U;
+    /* Snapshot fuses */
+    DEV_SM_FuseSnapshot();
+}
 
-    /* Added to improve the test coverage */
-    SM_TEST_MODE_EXEC(SM_TEST_MODE_EXEC_LVL1,
-        s_fuseMap[fuseId].bitWidth = 33U);
+/*--------------------------------------------------------------------------*/
+/* Write a fuse word                                                        */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_FuseWrite(uint32_t fuseWord, uint32_t fuseVal)
+{
+    int32_t status;
 
-    /* Check the mask value not exceeding the max shift value */
-    if ((uint32_t) s_fuseMap[fuseId].bitWidth  <= 32U)
+    if (fuseWord < DEV_SM_NUM_OTP)
     {
-        mask = (2UL << (((uint32_t) s_fuseMap[fuseId].bitWidth) - 1U)) - 1U;
+        /* Write fuse via ELE */
+        ELE_FuseWrite(fuseWord, fuseVal, false);
+        status = g_eleStatus;
+
+        /* Update snapshot */
+        DEV_SM_FuseSnapshot();
     }
     else
     {
-        /* If exceeded, wrap to max range */
-        mask = 0U;
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return result */
-    return (fuse >> shift) & mask;
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read a fuse field                                                        */
+/*--------------------------------------------------------------------------*/
+uint32_t DEV_SM_FuseGet(uint32_t fuseId)
+{
+    /* Return result */
+    return s_fuseVal[fuseId];
 }
 
 /*--------------------------------------------------------------------------*/
@@ -171,6 +191,98 @@ uint32_t DEV_SM_FuseSpeedGet(void)
 /* Get the fuse state of a power domain                                     */
 /*--------------------------------------------------------------------------*/
 bool DEV_SM_FusePdDisabled(uint32_t domainId)
+{
+    bool pdDisabled = true;
+
+    if (domainId < DEV_SM_NUM_POWER)
+    {
+        pdDisabled = s_fusePdDisabled[domainId];
+    }
+
+    /* Return state */
+    return pdDisabled;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get the fuse state of a CPU ID                                           */
+/*--------------------------------------------------------------------------*/
+bool DEV_SM_FuseCpuDisabled(uint32_t cpuId)
+{
+    bool cpuDisabled = true;
+
+    if (cpuId < DEV_SM_NUM_CPU)
+    {
+        cpuDisabled = s_fuseCpuDisabled[cpuId];
+    }
+
+    /* Return state */
+    return cpuDisabled;
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Snapshot fuses                                                           */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_FuseSnapshot(void)
+{
+    /* Read all fuse fields used by the SM */
+    for (uint32_t fuseId = 0U; fuseId < DEV_SM_NUM_FUSE; fuseId++)
+    {
+        s_fuseVal[fuseId] = DEV_SM_FuseRead(fuseId);
+    }
+
+    /* Cache power domain state */
+    for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER; domainId++)
+    {
+        s_fusePdDisabled[domainId] = DEV_SM_FusePdRead(domainId);
+    }
+
+    /* Cache CPU state */
+    for (uint32_t cpuId = 0U; cpuId < DEV_SM_NUM_CPU; cpuId++)
+    {
+        s_fuseCpuDisabled[cpuId] = DEV_SM_FuseCpuRead(cpuId);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read a fuse field from the fuse block                                    */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_FuseRead(uint32_t fuseId)
+{
+    uint32_t fuse;
+    uint32_t shift;
+    uint32_t mask;
+    uint32_t bitWidth = (uint32_t) s_fuseMap[fuseId].bitWidth;
+
+    /* Get fuse word */
+    fuse = FSB->FUSE[s_fuseMap[fuseId].bitIdx / 32U];
+
+    /* Calculate shift and mask */
+    shift = ((uint32_t) s_fuseMap[fuseId].bitIdx) % 32U;
+
+    /* Added to improve the test coverage */
+    SM_TEST_MODE_EXEC(SM_TEST_MODE_EXEC_LVL1, bitWidth = 33U);
+
+    /* Check the mask value not exceeding the max shift value */
+    if (bitWidth <= 32U)
+    {
+        mask = (2UL << (bitWidth - 1U)) - 1U;
+    }
+    else
+    {
+        /* If exceeded, wrap to max range */
+        mask = 0U;
+    }
+
+    /* Return result */
+    return (fuse >> shift) & mask;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read the fuse state of a power domain                                    */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_FusePdRead(uint32_t domainId)
 {
     bool pdDisabled = false;
 
@@ -203,9 +315,9 @@ bool DEV_SM_FusePdDisabled(uint32_t domainId)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Get the fuse state of a CPU ID                                           */
+/* Read the fuse state of a CPU ID                                          */
 /*--------------------------------------------------------------------------*/
-bool DEV_SM_FuseCpuDisabled(uint32_t cpuId)
+static bool DEV_SM_FuseCpuRead(uint32_t cpuId)
 {
     bool cpuDisabled = false;
 
@@ -51,17 +51,15 @@
 
 /* Types */
 
-/*! Dynamic IRQ priority structure */
+/*! IRQ priority table structure */
 typedef struct
 {
     /*! IRQ number */
     IRQn_Type irqId;
     /*! IRQ counter */
     uint32_t irqCntr;
-    /*! IRQ base priority */
+    /*! IRQ NVIC priority, static once set (not boosted) */
     uint32_t basePrio;
-    /*! Dynamic priority enable */
-    bool dynPrioEn;
 } irq_prio_info_t;
 
 /* Functions */
@@ -106,11 +104,6 @@ void BusFault_Handler(const uint32_t *sp);
  */
 void UsageFault_Handler(const uint32_t *sp);
 
-/*!
- * SYSTICK interrupt handler.
- */
-void SysTick_Handler(void);
-
 /*!
  * SM watchdog interrupt handler.
  *
@@ -185,6 +178,16 @@ void TMPSNS_CORTEXA_2_IRQHandler(void);
  */
 void Reserved68_IRQHandler(void);
 
+/*!
+ * ELE MU interrupt handler.
+ */
+void Reserved39_IRQHandler(void);
+
+/*!
+ * SCMI scheduler software interrupt handler.
+ */
+void Reserved16_IRQHandler(void);
+
 /*!
  * ELE group 1 handler.
  *
@@ -336,6 +339,11 @@ void FCCU_INT0_IRQHandler(void);
  */
 void GPC_SM_REQ_IRQHandler(void);
 
+/*!
+ * System counter compare (tick timer) IRQ handler.
+ */
+void SYSCTR1_IRQHandler(void);
+
 /** @} */
 
 /*!
@@ -343,6 +351,13 @@ void GPC_SM_REQ_IRQHandler(void);
  */
 void SWI_Trigger(void);
 
+/*!
+ * Trigger SCMI scheduler software interrupt.
+ *
+ * Runs RPC_SCMI_Schedule() at a priority below the MU handlers.
+ */
+void SWI_SchedTrigger(void);
+
 /*!
  * Read timer.
  *
@@ -351,13 +366,42 @@ void SWI_Trigger(void);
 uint64_t DEV_SM_GetTimerMsec(void);
 
 /*!
- * Update dynamic IRQ base priority.
+ * Start the tick timer.
+ *
+ * Captures the timebase and programs the system counter compare for
+ * the first tick. The tick timer is one-shot and is reprogrammed for
+ * the earliest deadline returned by the tick functions.
+ */
+void DEV_SM_TickStart(void);
+
+/*!
+ * Enable or disable the tick timer interrupt.
+ *
+ * @param[in]     enable   True to enable
+ *
+ * Used to keep the tick timer from waking the system from sleep. On
+ * enable the deadlines are reevaluated.
+ */
+void DEV_SM_TickEnable(bool enable);
+
+/*!
+ * Request reevaluation of the tick deadlines.
+ *
+ * Called when an event creates a deadline earlier than the one
+ * currently programmed.
+ */
+void DEV_SM_TickUpdate(void);
+
+/*!
+ * Update IRQ base priority.
  *
  * @param[in]     irq      IRQ index
  * @param[in]     basePrio Base IRQ priority
  *
- * This function updates the base priority for an IRQ participating
- * in dynamic prioritization.
+ * This function sets the NVIC priority of an IRQ and records it in the
+ * IRQ priority table. Used by MB_MU_Init() to apply the mailbox priority
+ * from the config. The priority is static, the order in which SCMI
+ * requests are serviced is decided by RPC_SCMI_Schedule().
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -367,13 +411,13 @@ uint64_t DEV_SM_GetTimerMsec(void);
 int32_t DEV_SM_IrqPrioBaseSet(IRQn_Type irq, uint32_t basePrio);
 
 /*!
- * Get dynamic IRQ base priority.
+ * Get IRQ base priority.
  *
  * @param[in]     irq      IRQ index
  * @param[out]    basePrio Base IRQ priority
  *
- * This function gets the base priority for an IRQ participating
- * in dynamic prioritization.
+ * This function gets the NVIC priority recorded for an IRQ by
+ * DEV_SM_IrqPrioBaseSet().
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -383,13 +427,13 @@ int32_t DEV_SM_IrqPrioBaseSet(IRQn_Type irq, uint32_t basePrio);
 int32_t DEV_SM_IrqPrioBaseGet(IRQn_Type irq, uint32_t *basePrio);
 
 /*!
- * Update dynamic IRQ occurrence counter.
+ * Update IRQ occurrence counter.
  *
  * @param[in]     irq      IRQ index
  * @param[in]     irqCntr  Value for IRQ counter
  *
- * This function updates the occurrence counter for an IRQ participating
- * in dynamic prioritization.
+ * This function updates the occurrence counter for an IRQ in the IRQ
+ * priority table.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -399,13 +443,13 @@ int32_t DEV_SM_IrqPrioBaseGet(IRQn_Type irq, uint32_t *basePrio);
 int32_t DEV_SM_IrqPrioCntrSet(IRQn_Type irq, uint32_t irqCntr);
 
 /*!
- * Get dynamic IRQ occurrence counter.
+ * Get IRQ occurrence counter.
  *
  * @param[in]     irq      IRQ index
  * @param[out]    irqCntr  Value for IRQ counter
  *
- * This function gets the occurrence counter for an IRQ participating
- * in dynamic prioritization.
+ * This function gets the occurrence counter for an IRQ in the IRQ
+ * priority table.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -415,10 +459,10 @@ int32_t DEV_SM_IrqPrioCntrSet(IRQn_Type irq, uint32_t irqCntr);
 int32_t DEV_SM_IrqPrioCntrGet(IRQn_Type irq, uint32_t *irqCntr);
 
 /*!
- * Update dynamic priority of active IRQ.
+ * Update occurrence counter of active IRQ.
  *
- * This function updates the priority for an IRQ participating
- * in dynamic prioritization.
+ * This function counts an occurrence of the active IRQ in the IRQ
+ * priority table.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -47,6 +47,9 @@
 
 /* Local defines */
 
+/*! Spacing of DDR PHY reset steps on retention exit */
+#define DEV_SM_MEM_PHY_STEP_USEC  15U
+
 /* Local types */
 
 /* Local variables */
@@ -60,6 +63,7 @@ static uint32_t s_ddrMseconds = 0U;
 
 /* Local functions */
 
+static uint64_t DEV_SM_MemPhyStep(uint64_t stepUsec);
 #ifdef USES_RX_REPLICA
 static void DEV_SM_RxReplicaInit(void);
 static void DEV_SM_RxReplicaDeinit(void);
@@ -190,6 +194,12 @@ int32_t DEV_SM_MemDdrRetentionEnter(void)
         {
             status = SM_ERR_HARDWARE_ERROR;
         }
+
+        /* Record retention entry timing */
+        struct ddr_timing timing;
+        DDR_GetRetentionTiming(&timing);
+        g_syslog.sysSleepRecord.ddrIdleUsec = timing.idleUsec;
+        g_syslog.sysSleepRecord.ddrLpUsec = timing.lpUsec;
     }
 
     if (status == SM_ERR_SUCCESS)
@@ -222,8 +232,10 @@ int32_t DEV_SM_MemDdrRetentionEnter(void)
 int32_t DEV_SM_MemDdrRetentionExit(void)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint64_t rstStart = DEV_SM_Usec64Get();
     const struct ddr_info* ddr = (struct ddr_info*) &__DdrInfo;
     uint8_t powerState = DEV_SM_POWER_STATE_OFF;
+    uint64_t stepUsec = rstStart;
 
     /* Get power state of DDRMIX */
     status = DEV_SM_PowerStateGet(DEV_SM_PD_DDR, &powerState);
@@ -249,12 +261,13 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
         {
             status = SM_ERR_HARDWARE_ERROR;
         }
+        stepUsec = DEV_SM_Usec64Get();
     }
 
     if (status == SM_ERR_SUCCESS)
     {
         /* sleep for a while, just random */
-        SystemTimeDelay(15U);
+        stepUsec = DEV_SM_MemPhyStep(stepUsec);
 
         /* set PRESETN LOW after power-up */
         if (!SRC_MixSetResetLine(RST_LINE_DDRPHY_PRESETN,
@@ -270,7 +283,7 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
          * APBCLK is @200MHz in waveform. Timer clock is @24MHz =>
          * => (16 * 24.000.000 / 200.000.000) = 1.92us minimum
          * => set x4 = 8us */
-        SystemTimeDelay(15U);
+        stepUsec = DEV_SM_MemPhyStep(stepUsec);
 
         /* set PRESETN HIGH */
         if (!SRC_MixSetResetLine(RST_LINE_DDRPHY_PRESETN,
@@ -283,7 +296,7 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
     if (status == SM_ERR_SUCCESS)
     {
         /* The delay below shall be 0 according to PHY PUB, set 8 just in case */
-        SystemTimeDelay(15U);
+        stepUsec = DEV_SM_MemPhyStep(stepUsec);
 
         /* set RESET_N HIGH */
         if (!SRC_MixSetResetLine(RST_LINE_DDRPHY_RESETN,
@@ -297,7 +310,7 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
     {
         /* The duration for the delay below is not mentioned in PHY PUB,
            set 8 just in case */
-        SystemTimeDelay(15U);
+        (void) DEV_SM_MemPhyStep(stepUsec);
 
         status = DEV_SM_ClockEnable(DEV_SM_CLK_DRAMPLL_VCO, true);
     }
@@ -309,12 +322,22 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
 
     if (status == SM_ERR_SUCCESS)
     {
+        /* Record PHY reset and DRAM PLL timing */
+        g_syslog.sysSleepRecord.ddrRstUsec =
+            UINT64_L(DEV_SM_Usec64Get() - rstStart);
+
         /* Exit retention */
         if (!DDR_ExitRetention(ddr))
         {
             status = SM_ERR_HARDWARE_ERROR;
         }
 
+        /* Record retention exit timing */
+        struct ddr_timing timing;
+        DDR_GetRetentionTiming(&timing);
+        g_syslog.sysSleepRecord.ddrPhyUsec = timing.phyUsec;
+        g_syslog.sysSleepRecord.ddrCtrlUsec = timing.ddrcUsec;
+
         /* Restore DDRMIX block control */
         BLK_CTRL_DDRMIX->HWFFC_CTRL = s_ddrBlkCtrl.HWFFC_CTRL;
         BLK_CTRL_DDRMIX->CA55_SEL_CTRL = s_ddrBlkCtrl.CA55_SEL_CTRL;
@@ -345,16 +368,18 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
 /*--------------------------------------------------------------------------*/
 /* Memory timer tick                                                        */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_MemTick(uint32_t msec)
+uint32_t DEV_SM_MemTick(uint32_t msec)
 {
+    uint32_t next = DEV_SM_TICK_IDLE;
+
 #ifdef USES_RX_REPLICA
     /* Tick DDR */
     /*
-     * False Positive: The msec value is 10
+     * False Positive: The msec value is clamped to 1000
      * and the base rolls to 0 at 1000.
      */
     // coverity[cert_int30_c_violation:FALSE]
-    s_ddrMseconds += msec;
+    s_ddrMseconds += MIN(msec, 1000U);
 
     /* Handle DDR periodic tick */
     if (s_ddrMseconds >= 1000U)
@@ -362,11 +387,37 @@ void DEV_SM_MemTick(uint32_t msec)
         s_ddrMseconds = 0U;
         DDR_RxReplicaWa(&s_rxClkDelay, 16U);
     }
+
+    /* Next DDR periodic tick */
+    next = 1000U - s_ddrMseconds;
 #endif
+
+    /* Return next deadline */
+    return next;
 }
 
 /*==========================================================================*/
 
+/*--------------------------------------------------------------------------*/
+/* Wait for the next DDR PHY reset step, returns the step time              */
+/*--------------------------------------------------------------------------*/
+static uint64_t DEV_SM_MemPhyStep(uint64_t stepUsec)
+{
+    uint64_t usec = DEV_SM_Usec64Get();
+
+    /*
+     * Runs in the sleep exit path with the tick and scheduler stopped, so
+     * wait on the timer timebase. Time spent in the previous step counts.
+     */
+    while ((usec - stepUsec) < U64(DEV_SM_MEM_PHY_STEP_USEC))
+    {
+        usec = DEV_SM_Usec64Get();
+    }
+
+    /* Return step time */
+    return usec;
+}
+
 #ifdef USES_RX_REPLICA
 /*--------------------------------------------------------------------------*/
 /* DDR RX Replica workaround Init                                           */
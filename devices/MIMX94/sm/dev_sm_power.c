@@ -40,13 +40,64 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
+#include "timer.h"
 
 /* Local defines */
 
+/* Time to poll a power down before using the timeout fallback */
+#define DEV_SM_POWER_DOWN_USEC     100ULL
+
+/* Time to wait on a hardware sequence before failing the transition */
+#define DEV_SM_POWER_TIMEOUT_USEC  10000ULL
+
+/* Interval to poll in flight transitions */
+#define DEV_SM_POWER_POLL_USEC     10U
+
+/* Max MIX slices ramping at once if not limited by the board */
+#ifndef BOARD_PWR_MAX_INRUSH
+#define BOARD_PWR_MAX_INRUSH       1U
+#endif
+
+/* Power transition steps */
+#define DEV_SM_POWER_STEP_IDLE  0U  /* No transition */
+#define DEV_SM_POWER_STEP_WAIT  1U  /* Waiting on parent, child, or inrush */
+#define DEV_SM_POWER_STEP_RAMP  2U  /* Hardware sequence in flight */
+#define DEV_SM_POWER_STEP_POST  3U  /* Post-processing due */
+
 /* Local types */
 
+/* Split-phase power transition of a domain */
+typedef struct
+{
+    uint64_t startUsec;   /* Time the hardware sequence was requested */
+    int32_t status;       /* Status of the last transition */
+    uint32_t rootCtrl;    /* Saved clock root control */
+    uint8_t step;         /* Transition step */
+    uint8_t powerState;   /* Target power state */
+    uint8_t nextState;    /* Power state queued behind this transition */
+    bool next;            /* Next state queued */
+    bool report;          /* Report completion to the LMM */
+} dev_sm_power_trans_t;
+
 /* Local variables */
 static uint8_t s_powerStateM33S = DEV_SM_POWER_STATE_OFF;
+static uint8_t s_powerStateNETC = DEV_SM_POWER_STATE_OFF;
+static dev_sm_power_trans_t s_powerTrans[DEV_SM_NUM_POWER];
+static timer_work_t s_powerTimer;
+
+/* Local functions */
+
+static uint32_t DEV_SM_PowerMixGet(uint32_t domainId);
+static void DEV_SM_PowerTransRequest(uint32_t domainId, uint8_t powerState);
+static void DEV_SM_PowerTransStep(uint32_t domainId);
+static bool DEV_SM_PowerTransBlocked(uint32_t domainId);
+static bool DEV_SM_PowerTransTo(uint32_t domainId, uint8_t powerState);
+static void DEV_SM_PowerTransStart(uint32_t domainId);
+static void DEV_SM_PowerTransRamp(uint32_t domainId);
+static void DEV_SM_PowerTransDone(uint32_t domainId, int32_t status);
+static void DEV_SM_PowerTimer(uint32_t cookie);
+static void DEV_SM_PowerNetcUpdate(void);
 
 /*--------------------------------------------------------------------------*/
 /* Initialize CPU domains                                                   */
@@ -65,6 +116,9 @@ int32_t DEV_SM_PowerInit(void)
         }
     }
 
+    /* Init transition poll timer */
+    TIMER_WorkInit(&s_powerTimer, DEV_SM_PowerTimer, 0U);
+
     /* Disable AutoAck of SM LP handshakes */
     BLK_CTRL_S_AONMIX->SM_LP_HANDSHAKE_STATUS =
         BLK_CTRL_S_AONMIX_SM_LP_HANDSHAKE_STATUS_AUTOACK(0U);
@@ -166,129 +220,163 @@ int32_t DEV_SM_PowerStateNameGet(uint32_t powerState, string *stateNameAddr,
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
 {
-    int32_t status = SM_ERR_SUCCESS;
-    uint32_t srcMixIdx = domainId;
-    static uint8_t s_powerStateNETC = DEV_SM_POWER_STATE_OFF;
+    bool pending = false;
 
-    if (domainId == DEV_SM_PD_M33S)
+    /* Start transition */
+    int32_t status = DEV_SM_PowerStateSetAsync(domainId, powerState,
+        &pending);
+
+    /* Advance transitions until this domain is done */
+    if (pending)
     {
-        srcMixIdx = DEV_SM_PD_NETC;
+        while (s_powerTrans[domainId].step != DEV_SM_POWER_STEP_IDLE)
+        {
+            (void) DEV_SM_PowerPoll();
+        }
+        status = s_powerTrans[domainId].status;
     }
 
-    bool pdDisabled = DEV_SM_FusePdDisabled(srcMixIdx);
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start setting power domain state                                         */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PowerStateSetAsync(uint32_t domainId, uint8_t powerState,
+    bool *pending)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool pdDisabled = DEV_SM_FusePdDisabled(DEV_SM_PowerMixGet(domainId));
+
+    *pending = false;
 
     if (pdDisabled || (domainId >= DEV_SM_NUM_POWER))
     {
         status = SM_ERR_NOT_FOUND;
     }
+    else if (powerState >= DEV_SM_NUM_POWER_STATE)
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
     else
     {
-        if (domainId == DEV_SM_PD_NETC)
+        dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+        /* Try to start a new transition right away */
+        if (trans->step == DEV_SM_POWER_STEP_IDLE)
         {
-            s_powerStateNETC = powerState;
+            DEV_SM_PowerTransRequest(domainId, powerState);
+            DEV_SM_PowerTransStep(domainId);
+
+            status = trans->status;
         }
-        if (domainId == DEV_SM_PD_M33S)
+        else
         {
-            s_powerStateM33S = powerState;
+            DEV_SM_PowerTransRequest(domainId, powerState);
         }
 
-        switch (powerState)
+        /* Report completion if still in flight */
+        if (trans->step != DEV_SM_POWER_STEP_IDLE)
         {
-            case DEV_SM_POWER_STATE_ON:
-                if (PWR_IsParentPowered(srcMixIdx))
-                {
-#if (defined(FSL_FEATURE_V2X_HAS_ERRATA_052682) && FSL_FEATURE_V2X_HAS_ERRATA_052682)
-                    uint32_t rootCtrl;
-                    /* Switch V2X clock to OSC_24M prior to WAKEUPMIX power up */
-                    if (domainId == DEV_SM_PD_WAKEUP)
-                    {
-                        rootCtrl = CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.RW;
-
-                        /* Set MUX = 0 (OSC_24M) */
-                        CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.CLR =
-                            CCM_CLOCK_ROOT_MUX_MASK;
+            status = SM_ERR_SUCCESS;
+            trans->report = true;
+            *pending = true;
 
-                        /* Set DIV = 0 (/1) */
-                        CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.CLR =
-                            CCM_CLOCK_ROOT_DIV_MASK;
-                    }
-#endif
-                    if (SRC_MixSoftPowerUp(srcMixIdx))
-                    {
-#if (defined(FSL_FEATURE_V2X_HAS_ERRATA_052682) && FSL_FEATURE_V2X_HAS_ERRATA_052682)
-                        /* Restore V2X clock root after WAKEUPMIX power up */
-                        if (domainId == DEV_SM_PD_WAKEUP)
-                        {
-                            /* Restore DIV */
-                            CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.SET =
-                                rootCtrl & CCM_CLOCK_ROOT_DIV_MASK;
-
-                            /* Restore MUX */
-                            CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.SET =
-                                rootCtrl & CCM_CLOCK_ROOT_MUX_MASK;
-                        }
-#endif
-                        status = DEV_SM_PowerUpPost(srcMixIdx);
-                    }
-                }
-                else
-                {
-                    status = SM_ERR_POWER;
-                }
-                break;
-            case DEV_SM_POWER_STATE_OFF:
-                if (!PWR_AnyChildPowered(srcMixIdx))
-                {
-                    /* Apply special power state management for NETCMIX */
-                    if (srcMixIdx == DEV_SM_PD_NETC)
-                    {
-                        /* Only switch off NETCMIX if both virtual domains are off */
-                        if ((s_powerStateNETC == DEV_SM_POWER_STATE_OFF) &&
-                            (s_powerStateM33S == DEV_SM_POWER_STATE_OFF))
-                        {
-                            if (DEV_SM_PowerDownPre(srcMixIdx) == SM_ERR_SUCCESS)
-                            {
-                                SRC_MixSoftPowerDown(srcMixIdx);
-                            }
-                        }
-                    }
-                    else
-                    {
-                        if (DEV_SM_PowerDownPre(srcMixIdx) == SM_ERR_SUCCESS)
-                        {
-                            SRC_MixSoftPowerDown(srcMixIdx);
-                        }
-                    }
-                }
-                else
-                {
-                    status = SM_ERR_POWER;
-                }
-                break;
-            default:
-                status = SM_ERR_INVALID_PARAMETERS;
-                break;
+            /* Poll from a timer rather than spinning */
+            TIMER_Start(&s_powerTimer, DEV_SM_POWER_POLL_USEC);
         }
     }
 
-    /* Apply special power state management for NETCMIX */
-    if ((status == SM_ERR_SUCCESS) && (srcMixIdx == DEV_SM_PD_NETC))
-    {
-        /* Switch to HW-control of NETCMIX based on status of NETC virtual
-         * domains.  When only M33S virtual domain remains active, switch
-         * to GPC HW-control.
-         */
-        if ((s_powerStateNETC == DEV_SM_POWER_STATE_OFF) &&
-            (s_powerStateM33S == DEV_SM_POWER_STATE_ON))
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Advance in flight power transitions                                      */
+/*--------------------------------------------------------------------------*/
+bool DEV_SM_PowerPoll(void)
+{
+    bool busy = false;
+
+    /* Step each domain in transition */
+    for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER; domainId++)
+    {
+        if (s_powerTrans[domainId].step != DEV_SM_POWER_STEP_IDLE)
         {
-            /* Switch NETCMIX to GPC HW-control */
-            (void) SRC_MixLpmModeSet(DEV_SM_PD_NETC, true);
+            DEV_SM_PowerTransStep(domainId);
+
+            if (s_powerTrans[domainId].step != DEV_SM_POWER_STEP_IDLE)
+            {
+                busy = true;
+            }
+        }
+    }
+
+    /* Return if still in flight */
+    return busy;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Power up a set of power domains                                          */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PowerUpBatch(uint32_t domainMask)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool busy = true;
 
-            /* Ensure M33S is awakened to evaluate NETCMIX GPC HW-control */
-            (void) CPU_SwWakeup(CPU_IDX_M33P_S);
+    /* Check domains */
+    for (uint32_t domainId = 0U; domainId < 32U; domainId++)
+    {
+        if (((domainMask & (1UL << domainId)) != 0U)
+            && ((domainId >= DEV_SM_NUM_POWER)
+            || DEV_SM_FusePdDisabled(DEV_SM_PowerMixGet(domainId))))
+        {
+            status = SM_ERR_NOT_FOUND;
         }
     }
 
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Request all before stepping so children wait on parents */
+        for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+            domainId++)
+        {
+            if ((domainMask & (1UL << domainId)) != 0U)
+            {
+                DEV_SM_PowerTransRequest(domainId, DEV_SM_POWER_STATE_ON);
+            }
+        }
+
+        /* Advance transitions until all requested domains are done */
+        while (busy)
+        {
+            (void) DEV_SM_PowerPoll();
+
+            busy = false;
+            for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+                domainId++)
+            {
+                if (((domainMask & (1UL << domainId)) != 0U)
+                    && (s_powerTrans[domainId].step
+                    != DEV_SM_POWER_STEP_IDLE))
+                {
+                    busy = true;
+                }
+            }
+        }
+
+        /* Return first failure */
+        for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+            domainId++)
+        {
+            if ((status == SM_ERR_SUCCESS)
+                && ((domainMask & (1UL << domainId)) != 0U))
+            {
+                status = s_powerTrans[domainId].status;
+            }
+        }
+    }
 
     /* Return status */
     return status;
@@ -376,3 +464,381 @@ int32_t DEV_SM_PowerRetMaskGet(uint32_t domainId, uint32_t *retMask)
     return status;
 }
 
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Get MIX slice of a power domain                                          */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_PowerMixGet(uint32_t domainId)
+{
+    uint32_t srcMixIdx = domainId;
+
+    /* M33S is a virtual domain of NETCMIX */
+    if (domainId == DEV_SM_PD_M33S)
+    {
+        srcMixIdx = DEV_SM_PD_NETC;
+    }
+
+    /* Return MIX */
+    return srcMixIdx;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Request power transition of a domain                                     */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransRequest(uint32_t domainId, uint8_t powerState)
+{
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    switch (trans->step)
+    {
+        case DEV_SM_POWER_STEP_IDLE:
+            /* New transition, nothing to report yet */
+            trans->status = SM_ERR_SUCCESS;
+            trans->powerState = powerState;
+            trans->next = false;
+            trans->report = false;
+            trans->step = DEV_SM_POWER_STEP_WAIT;
+            break;
+        case DEV_SM_POWER_STEP_WAIT:
+            /* Not started, just retarget */
+            trans->powerState = powerState;
+            break;
+        default:
+            /* Queue behind the hardware sequence */
+            trans->nextState = powerState;
+            trans->next = (powerState != trans->powerState);
+            break;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Advance power transition of a domain by one step                         */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransStep(uint32_t domainId)
+{
+    switch (s_powerTrans[domainId].step)
+    {
+        case DEV_SM_POWER_STEP_WAIT:
+            if (!DEV_SM_PowerTransBlocked(domainId))
+            {
+                DEV_SM_PowerTransStart(domainId);
+            }
+            break;
+        case DEV_SM_POWER_STEP_RAMP:
+            DEV_SM_PowerTransRamp(domainId);
+            break;
+        case DEV_SM_POWER_STEP_POST:
+#if (defined(FSL_FEATURE_V2X_HAS_ERRATA_052682) && FSL_FEATURE_V2X_HAS_ERRATA_052682)
+            /* Restore V2X clock root after WAKEUPMIX power up */
+            if (domainId == DEV_SM_PD_WAKEUP)
+            {
+                uint32_t rootCtrl = s_powerTrans[domainId].rootCtrl;
+
+                /* Restore DIV */
+                CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.SET =
+                    rootCtrl & CCM_CLOCK_ROOT_DIV_MASK;
+
+                /* Restore MUX */
+                CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.SET =
+                    rootCtrl & CCM_CLOCK_ROOT_MUX_MASK;
+            }
+#endif
+
+            /* Post power up processing */
+            DEV_SM_PowerTransDone(domainId,
+                DEV_SM_PowerUpPost(DEV_SM_PowerMixGet(domainId)));
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if power transition must wait on another domain                    */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_PowerTransBlocked(uint32_t domainId)
+{
+    bool blocked = false;
+    uint32_t srcMixIdx = DEV_SM_PowerMixGet(domainId);
+
+    /* Wait for other domain sharing the MIX */
+    for (uint32_t id = 0U; id < DEV_SM_NUM_POWER; id++)
+    {
+        if ((id != domainId) && (DEV_SM_PowerMixGet(id) == srcMixIdx)
+            && (s_powerTrans[id].step >= DEV_SM_POWER_STEP_RAMP))
+        {
+            blocked = true;
+        }
+    }
+
+    if (s_powerTrans[domainId].powerState == DEV_SM_POWER_STATE_ON)
+    {
+        uint32_t parentId = PWR_ParentGet(srcMixIdx);
+        uint32_t numRamp = 0U;
+
+        /* Wait for parent powering up */
+        if ((parentId < DEV_SM_NUM_POWER)
+            && DEV_SM_PowerTransTo(parentId, DEV_SM_POWER_STATE_ON))
+        {
+            blocked = true;
+        }
+
+        /* Limit inrush current */
+        for (uint32_t id = 0U; id < DEV_SM_NUM_POWER; id++)
+        {
+            if ((s_powerTrans[id].step == DEV_SM_POWER_STEP_RAMP)
+                && (s_powerTrans[id].powerState == DEV_SM_POWER_STATE_ON))
+            {
+                numRamp++;
+            }
+        }
+        if (numRamp >= BOARD_PWR_MAX_INRUSH)
+        {
+            blocked = true;
+        }
+    }
+    else
+    {
+        /* Wait for children powering down */
+        for (uint32_t id = 0U; id < DEV_SM_NUM_POWER; id++)
+        {
+            if ((PWR_ParentGet(DEV_SM_PowerMixGet(id)) == srcMixIdx)
+                && DEV_SM_PowerTransTo(id, DEV_SM_POWER_STATE_OFF))
+            {
+                blocked = true;
+            }
+        }
+    }
+
+    /* Return result */
+    return blocked;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if a domain is in transition to a power state                      */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_PowerTransTo(uint32_t domainId, uint8_t powerState)
+{
+    const dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    /* Return result */
+    return (trans->step != DEV_SM_POWER_STEP_IDLE)
+        && ((trans->powerState == powerState)
+        || (trans->next && (trans->nextState == powerState)));
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start hardware sequence of power transition                              */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransStart(uint32_t domainId)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+    uint32_t srcMixIdx = DEV_SM_PowerMixGet(domainId);
+    bool started = false;
+
+    if (domainId == DEV_SM_PD_NETC)
+    {
+        s_powerStateNETC = trans->powerState;
+    }
+    if (domainId == DEV_SM_PD_M33S)
+    {
+        s_powerStateM33S = trans->powerState;
+    }
+
+    if (trans->powerState == DEV_SM_POWER_STATE_ON)
+    {
+        if (PWR_IsParentPowered(srcMixIdx))
+        {
+#if (defined(FSL_FEATURE_V2X_HAS_ERRATA_052682) && FSL_FEATURE_V2X_HAS_ERRATA_052682)
+            /* Switch V2X clock to OSC_24M prior to WAKEUPMIX power up */
+            if (domainId == DEV_SM_PD_WAKEUP)
+            {
+                trans->rootCtrl = CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.RW;
+
+                /* Set MUX = 0 (OSC_24M) */
+                CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.CLR =
+                    CCM_CLOCK_ROOT_MUX_MASK;
+
+                /* Set DIV = 0 (/1) */
+                CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_V2XPK].CLOCK_ROOT_CONTROL.CLR =
+                    CCM_CLOCK_ROOT_DIV_MASK;
+            }
+#endif
+            /* Request power up */
+            started = SRC_MixSoftPowerUpStart(srcMixIdx);
+            if (!started)
+            {
+                SRC_MixSoftPowerUpFinish(srcMixIdx);
+            }
+        }
+        else
+        {
+            status = SM_ERR_POWER;
+        }
+    }
+    else
+    {
+        if (!PWR_AnyChildPowered(srcMixIdx))
+        {
+            /* Only switch off NETCMIX if both virtual domains are off */
+            if ((srcMixIdx != DEV_SM_PD_NETC) ||
+                ((s_powerStateNETC == DEV_SM_POWER_STATE_OFF) &&
+                (s_powerStateM33S == DEV_SM_POWER_STATE_OFF)))
+            {
+                /* Request power down */
+                if (DEV_SM_PowerDownPre(srcMixIdx) == SM_ERR_SUCCESS)
+                {
+                    started = SRC_MixSoftPowerDownStart(srcMixIdx);
+                    if (!started)
+                    {
+                        SRC_MixSoftPowerDownFinish(srcMixIdx, false);
+                    }
+                }
+            }
+        }
+        else
+        {
+            status = SM_ERR_POWER;
+        }
+    }
+
+    if (started)
+    {
+        /* Poll hardware sequence */
+        trans->startUsec = DEV_SM_Usec64Get();
+        trans->step = DEV_SM_POWER_STEP_RAMP;
+    }
+    else
+    {
+        DEV_SM_PowerTransDone(domainId, status);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check hardware sequence of power transition                              */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransRamp(uint32_t domainId)
+{
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+    uint32_t srcMixIdx = DEV_SM_PowerMixGet(domainId);
+
+    /*
+     * False Positive: the start time is captured from the same
+     * monotonic counter before the current time.
+     */
+    // coverity[cert_int30_c_violation:FALSE]
+    uint64_t elapsed = DEV_SM_Usec64Get() - trans->startUsec;
+
+    if (trans->powerState == DEV_SM_POWER_STATE_ON)
+    {
+        if (SRC_MixIsPwrReady(srcMixIdx))
+        {
+            SRC_MixSoftPowerUpFinish(srcMixIdx);
+
+            /* Post-process on the next step */
+            trans->step = DEV_SM_POWER_STEP_POST;
+        }
+        else if (elapsed >= DEV_SM_POWER_TIMEOUT_USEC)
+        {
+            SRC_MixSoftPowerUpFinish(srcMixIdx);
+            DEV_SM_PowerTransDone(domainId, SM_ERR_HARDWARE_ERROR);
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+    }
+    else
+    {
+        /* Done, or forced done by the timeout fallback */
+        if (SRC_MixIsPwrDown(srcMixIdx)
+            || ((elapsed >= DEV_SM_POWER_DOWN_USEC)
+            && SRC_MixSoftPowerDownForce(srcMixIdx)))
+        {
+            SRC_MixSoftPowerDownFinish(srcMixIdx, true);
+            DEV_SM_PowerTransDone(domainId, SM_ERR_SUCCESS);
+        }
+        else if (elapsed >= DEV_SM_POWER_TIMEOUT_USEC)
+        {
+            /* Restore LP handshake without waiting */
+            SRC_MixSoftPowerDownFinish(srcMixIdx, false);
+            DEV_SM_PowerTransDone(domainId, SM_ERR_HARDWARE_ERROR);
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* End power transition of a domain                                         */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransDone(uint32_t domainId, int32_t status)
+{
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    trans->status = status;
+
+    /* Apply special power state management for NETCMIX */
+    if ((status == SM_ERR_SUCCESS)
+        && (DEV_SM_PowerMixGet(domainId) == DEV_SM_PD_NETC))
+    {
+        DEV_SM_PowerNetcUpdate();
+    }
+
+    if (trans->next)
+    {
+        /* Start queued transition */
+        trans->powerState = trans->nextState;
+        trans->next = false;
+        trans->step = DEV_SM_POWER_STEP_WAIT;
+    }
+    else
+    {
+        /* Mark done */
+        trans->step = DEV_SM_POWER_STEP_IDLE;
+
+        /* Report completion */
+        if (trans->report)
+        {
+            trans->report = false;
+            LMM_PowerStateComplete(domainId, status);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Poll in flight power transitions from timer                              */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTimer(uint32_t cookie)
+{
+    /* Rearm until complete */
+    if (DEV_SM_PowerPoll())
+    {
+        TIMER_Start(&s_powerTimer, DEV_SM_POWER_POLL_USEC);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update NETCMIX control from the NETC virtual domains                     */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerNetcUpdate(void)
+{
+    /* Switch to HW-control of NETCMIX based on status of NETC virtual
+     * domains.  When only M33S virtual domain remains active, switch
+     * to GPC HW-control.
+     */
+    if ((s_powerStateNETC == DEV_SM_POWER_STATE_OFF) &&
+        (s_powerStateM33S == DEV_SM_POWER_STATE_ON))
+    {
+        /* Switch NETCMIX to GPC HW-control */
+        (void) SRC_MixLpmModeSet(DEV_SM_PD_NETC, true);
+
+        /* Ensure M33S is awakened to evaluate NETCMIX GPC HW-control */
+        (void) CPU_SwWakeup(CPU_IDX_M33P_S);
+    }
+}
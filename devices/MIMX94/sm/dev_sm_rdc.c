@@ -58,6 +58,13 @@ typedef struct
     uint32_t pd;
 } dev_sm_trdc_info_t;
 
+/* Local functions */
+
+#ifdef DEVICE_HAS_ELE
+static void DEV_SM_RdcReleaseNext(uint32_t rdcId);
+static void DEV_SM_RdcReleaseDone(uint32_t cookie, int32_t status);
+#endif
+
 /* Local variables */
 
 static const uint32_t s_trdcAon[] = SM_TRDC_A_CONFIG;
@@ -83,6 +90,12 @@ static const dev_sm_trdc_info_t s_trdcInfo[DEV_SM_NUM_RDC] =
     {"sync",    0x4D040000, 'S', 0xE3U, s_trdcSync,     DEV_SM_PD_NETC},
 };
 
+#ifdef DEVICE_HAS_ELE
+/* First RDC not yet released, DEV_SM_NUM_RDC if none pending */
+static volatile uint32_t s_rdcReleaseIdx = DEV_SM_NUM_RDC;
+static volatile int32_t s_rdcReleaseStatus = SM_ERR_SUCCESS;
+#endif
+
 /*--------------------------------------------------------------------------*/
 /* Init RDC                                                                 */
 /*--------------------------------------------------------------------------*/
@@ -90,27 +103,16 @@ int32_t DEV_SM_RdcInit(void)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* RDC Init */
-    for (uint32_t rdcId = 0U; rdcId < DEV_SM_NUM_RDC; rdcId++)
-    {
-        /* Skip if no ID */
-        if (s_trdcInfo[rdcId].apiId == 0U)
-        {
-            continue;
-        }
-
 #ifdef DEVICE_HAS_ELE
-        /* Request RDC from ELE */
-        ELE_RdcRelease(s_trdcInfo[rdcId].apiId);
+    s_rdcReleaseStatus = SM_ERR_SUCCESS;
+    s_rdcReleaseIdx = 0U;
 
-        /* Check ELE error */
-        if (g_eleStatus != SM_ERR_SUCCESS)
-        {
-            status = g_eleStatus;
-            break;
-        }
+    /* Release RDCs in the background, each completion starts the next */
+    DEV_SM_RdcReleaseNext(0U);
+
+    /* Check ELE error */
+    status = s_rdcReleaseStatus;
 #endif
-    }
 
     /* Return status */
     return status;
@@ -162,6 +164,32 @@ int32_t DEV_SM_RdcInfoGet(uint32_t rdcId, string *rdcNameAddr,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Wait for RDC release                                                     */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_RdcReleaseWait(uint32_t rdcId)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+#ifdef DEVICE_HAS_ELE
+    /* Poll in case called with the ELE MU IRQ masked */
+    while ((s_rdcReleaseIdx <= rdcId) && (s_rdcReleaseIdx < DEV_SM_NUM_RDC)
+        && (s_rdcReleaseStatus == SM_ERR_SUCCESS))
+    {
+        ELE_Poll();
+    }
+
+    /* RDCs released before an error are still usable */
+    if (s_rdcReleaseIdx <= rdcId)
+    {
+        status = s_rdcReleaseStatus;
+    }
+#endif
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Load RDC config                                                          */
 /*--------------------------------------------------------------------------*/
@@ -171,9 +199,15 @@ int32_t DEV_SM_RdcLoad(uint32_t rdcId)
 
     /* Check ID */
     if (rdcId < DEV_SM_NUM_RDC)
+    {
+        /* Wait for RDC to be released */
+        status = DEV_SM_RdcReleaseWait(rdcId);
+    }
+
+    if (status == SM_ERR_SUCCESS)
     {
         /* Load config */
-        status = CONFIG_Load((uint32_t*)
+        status = CONFIG_Load((const uint32_t*)
             s_trdcInfo[rdcId].rdcBase, s_trdcInfo[rdcId].config);
     }
 
@@ -191,3 +225,52 @@ int32_t DEV_SM_RdcAccessSet(uint32_t deviceId, bool allow, uint8_t domId,
     return SM_ERR_NOT_SUPPORTED;
 }
 
+#ifdef DEVICE_HAS_ELE
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Start release of next RDC with an ELE ID                                 */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_RdcReleaseNext(uint32_t rdcId)
+{
+    uint32_t idx = rdcId;
+
+    /* Skip RDCs without an ID */
+    while ((idx < DEV_SM_NUM_RDC) && (s_trdcInfo[idx].apiId == 0U))
+    {
+        idx++;
+    }
+
+    /* Release of RDCs before idx is done */
+    s_rdcReleaseIdx = idx;
+
+    if (idx < DEV_SM_NUM_RDC)
+    {
+        /* Request RDC from ELE */
+        int32_t status = ELE_RdcReleaseAsync(s_trdcInfo[idx].apiId,
+            DEV_SM_RdcReleaseDone, idx);
+
+        /* Stop at first error */
+        if (status != SM_ERR_SUCCESS)
+        {
+            s_rdcReleaseStatus = status;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* RDC release complete                                                     */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_RdcReleaseDone(uint32_t cookie, int32_t status)
+{
+    if (status != SM_ERR_SUCCESS)
+    {
+        /* Stop at first error */
+        s_rdcReleaseStatus = status;
+    }
+    else
+    {
+        DEV_SM_RdcReleaseNext(cookie + 1U);
+    }
+}
+#endif
@@ -133,8 +133,27 @@
 #define DEV_SM_SSF_PMIC_STBY_INACTIVE_MASK  (1U << 3U)  /*!< No PMIC_STBY assertion */
 #define DEV_SM_SSF_OSC24M_ACTIVE_MASK       (1U << 4U)  /*!< Keep OSC24M active */
 #define DEV_SM_SSF_LPCOMP_INACTIVE_MASK     (1U << 5U)  /*!< LP compute mode inhibited */
+#define DEV_SM_SSF_GOV_INACTIVE_MASK        (1U << 6U)  /*!< Always full suspend */
 /** @} */
 
+/*!
+ * @name System sleep depths
+ *
+ * Depths selected by the system sleep governor when the system is allowed
+ * to SUSPEND. Deeper depths save more power but cost more entry/exit time.
+ */
+/** @{ */
+#define DEV_SM_SLEEP_DEPTH_WFI      0U  /*!< SM WFI, system stays in RUN */
+#define DEV_SM_SLEEP_DEPTH_ACTIVE   1U  /*!< SUSPEND with DDR, NOC, WAKEUP, SYSPLL on */
+#define DEV_SM_SLEEP_DEPTH_SUSPEND  2U  /*!< Full SUSPEND */
+/** @} */
+
+/*! Number of system sleep depths */
+#define DEV_SM_NUM_SLEEP_DEPTH  3U
+
+/*! Number of latency histogram bins (powers of 4 starting at 16 usec) */
+#define DEV_SM_NUM_SLEEP_HIST   8U
+
 /* Types */
 
 /*!
@@ -168,8 +187,65 @@ typedef struct
 
     /*! System sleep flags */
     uint32_t sysSleepFlags;
+
+    /*! System sleep depth */
+    uint32_t sleepDepth;
+
+    /*! System sleep residency */
+    uint32_t sleepUsec;
+
+    /*! DDR retention entry, DDRC idle wait */
+    uint32_t ddrIdleUsec;
+
+    /*! DDR retention entry, self-refresh/LP3 sequence */
+    uint32_t ddrLpUsec;
+
+    /*! DDR retention exit, PHY reset and DRAM PLL */
+    uint32_t ddrRstUsec;
+
+    /*! DDR retention exit, PHY restore */
+    uint32_t ddrPhyUsec;
+
+    /*! DDR retention exit, DDRC restore */
+    uint32_t ddrCtrlUsec;
 } dev_sm_sys_sleep_rec_t;
 
+/*!
+ * System sleep depth statistics
+ */
+typedef struct
+{
+    /*! Number of entries into the depth */
+    uint32_t cnt;
+
+    /*! Average entry latency */
+    uint32_t entryUsec;
+
+    /*! Average exit latency */
+    uint32_t exitUsec;
+
+    /*! Entry latency histogram */
+    uint32_t entryHist[DEV_SM_NUM_SLEEP_HIST];
+
+    /*! Exit latency histogram */
+    uint32_t exitHist[DEV_SM_NUM_SLEEP_HIST];
+} dev_sm_sys_sleep_depth_stat_t;
+
+/*!
+ * System sleep governor statistics
+ */
+typedef struct
+{
+    /*! Predicted idle duration */
+    uint32_t predictUsec;
+
+    /*! Last completed idle duration */
+    uint32_t idleUsec;
+
+    /*! Per depth statistics */
+    dev_sm_sys_sleep_depth_stat_t depth[DEV_SM_NUM_SLEEP_DEPTH];
+} dev_sm_sys_sleep_stat_t;
+
 #ifdef DEV_SM_MSG_PROF_CNT
 /*!
  * Message profile log entry
@@ -195,6 +271,24 @@ typedef struct
 
 /* Functions */
 
+/*!
+ * CPU event notification.
+ *
+ * Called when a GPC event indicates a CPU may have changed mode. Triggers
+ * an immediate check of CPU modes followed by polling at the tick period
+ * for a short time. Otherwise, CPU modes are polled at a relaxed period.
+ */
+void DEV_SM_SystemCpuEvent(void);
+
+/*!
+ * Invalidate the cached system sleep plan.
+ *
+ * Called when a CPU input to system sleep entry changes (run mode, sleep
+ * mode, GPC wake mask, or LPM config). The next system sleep entry
+ * rescans the CPU wake masks and MIX dependencies.
+ */
+void DEV_SM_SystemSleepPlanInvalidate(void);
+
 /** @} */
 
 /* Include SM device API */
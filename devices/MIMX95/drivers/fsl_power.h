@@ -275,6 +275,16 @@ typedef struct
  */
 bool PWR_Init(uint32_t srcMixIdx);
 
+/*!
+ * Get parent of MIX slice
+ *
+ * @param[in]   srcMixIdx       SRC MIX identifier
+ *
+ * @return Returns the SRC MIX identifier of the parent, or
+ *         PWR_NUM_MIX_SLICE if the MIX slice has no parent.
+ */
+uint32_t PWR_ParentGet(uint32_t srcMixIdx);
+
 /*!
  * Check if parent of MIX slice is powered
  *
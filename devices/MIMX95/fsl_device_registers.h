@@ -32,6 +32,13 @@
 
 /* SWI mapping */
 #define SWI_0_IRQn Reserved110_IRQn
+#define SWI_1_IRQn Reserved16_IRQn
+
+/* ELE MU mapping */
+#define ELE_MU_IRQn Reserved37_IRQn
+
+/* Tick timer mapping (SYSCTR compare frame 0) */
+#define DEV_SM_TICK_IRQn Reserved88_IRQn
 
 #endif /* __FSL_DEVICE_REGISTERS_H__ */
 
@@ -228,8 +228,45 @@ int32_t DEV_SM_SyslogDump(uint32_t flags)
         printf("Sleep latency = %u usec\n", sysSleepRecord->sleepEntryUsec);
         printf("Wake latency = %u usec\n", sysSleepRecord->sleepExitUsec);
         printf("Sleep count = %u\n", sysSleepRecord->sleepCnt);
+        printf("Sleep depth = %u\n", sysSleepRecord->sleepDepth);
+        printf("Sleep residency = %u usec\n", sysSleepRecord->sleepUsec);
+        printf("DDR ret entry = %u (idle) + %u (lp) usec\n",
+            sysSleepRecord->ddrIdleUsec, sysSleepRecord->ddrLpUsec);
+        printf("DDR ret exit = %u (rst) + %u (phy) + %u (ddrc) usec\n",
+            sysSleepRecord->ddrRstUsec, sysSleepRecord->ddrPhyUsec,
+            sysSleepRecord->ddrCtrlUsec);
         printf("Device err log = 0x%08X\n", syslog->devErrLog);
 
+        const dev_sm_sys_sleep_stat_t *sysSleepStat
+            = &g_syslog.sysSleepStat;
+
+        printf("\nSleep governor:\n");
+        printf("Predicted idle = %u usec\n", sysSleepStat->predictUsec);
+        printf("Last idle = %u usec\n", sysSleepStat->idleUsec);
+        printf("DEPTH       COUNT    ENTRY[usec]    EXIT[usec]\n");
+        for (uint32_t depth = 0U; depth < DEV_SM_NUM_SLEEP_DEPTH; depth++)
+        {
+            const dev_sm_sys_sleep_depth_stat_t *pStat
+                = &sysSleepStat->depth[depth];
+
+            printf("%5u    %8u    %11u    %10u\n", depth, pStat->cnt,
+                pStat->entryUsec, pStat->exitUsec);
+        }
+        printf("HIST[<usec]   ENTRY[%u]   EXIT[%u]   ENTRY[%u]   EXIT[%u]\n",
+            DEV_SM_SLEEP_DEPTH_ACTIVE, DEV_SM_SLEEP_DEPTH_ACTIVE,
+            DEV_SM_SLEEP_DEPTH_SUSPEND, DEV_SM_SLEEP_DEPTH_SUSPEND);
+        for (uint32_t bin = 0U; bin < DEV_SM_NUM_SLEEP_HIST; bin++)
+        {
+            const dev_sm_sys_sleep_depth_stat_t *pActive
+                = &sysSleepStat->depth[DEV_SM_SLEEP_DEPTH_ACTIVE];
+            const dev_sm_sys_sleep_depth_stat_t *pSuspend
+                = &sysSleepStat->depth[DEV_SM_SLEEP_DEPTH_SUSPEND];
+
+            printf("%11u   %8u   %7u   %8u   %7u\n", 16U << (bin * 2U),
+                pActive->entryHist[bin], pActive->exitHist[bin],
+                pSuspend->entryHist[bin], pSuspend->exitHist[bin]);
+        }
+
 #ifdef DEV_SM_MSG_PROF_CNT
         printf("\nMessage profile log:\n");
         printf("LOG_ID    LATENCY[usec]    CHAN    TYPE    PROTOCOL"
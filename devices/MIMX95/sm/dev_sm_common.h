@@ -101,6 +101,9 @@ typedef struct
     /*! System sleep record */
     dev_sm_sys_sleep_rec_t sysSleepRecord;
 
+    /*! System sleep governor statistics */
+    dev_sm_sys_sleep_stat_t sysSleepStat;
+
     /*! Device error log */
     uint32_t devErrLog;
 
@@ -182,6 +182,9 @@ int32_t DEV_SM_CpuStart(uint32_t cpuId)
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -210,6 +213,9 @@ int32_t DEV_SM_CpuHold(uint32_t cpuId)
             status = SM_ERR_NOT_FOUND;
         }
     }
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -239,6 +245,9 @@ int32_t DEV_SM_CpuStop(uint32_t cpuId)
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -363,6 +372,9 @@ int32_t DEV_SM_CpuSleepModeSet(uint32_t cpuId, uint32_t sleepMode,
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -399,6 +411,9 @@ int32_t DEV_SM_CpuIrqWakeSet(uint32_t cpuId, uint32_t maskIdx,
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -467,6 +482,9 @@ int32_t DEV_SM_CpuPdLpmConfigSet(uint32_t cpuId, uint32_t domainId,
         }
     }
 
+    /* Invalidate cached system sleep plan */
+    DEV_SM_SystemSleepPlanInvalidate();
+
     /* Return status */
     return status;
 }
@@ -44,16 +44,23 @@
 #include "mb_mu.h"
 #include "config_mb_mu.h"
 #include "lmm.h"
+#include "rpc_scmi.h"
+#include "timer.h"
+#include "fsl_ele.h"
+#include "fsl_sysctr.h"
 #ifdef DEVICE_HAS_FCCU
 #include "eMcem_Vfccu.h"
 #endif
 
 /* Local defines */
 
-/* Dynamic IRQ priority definitions */
+/*! Maximum tick timer period */
+#define DEV_SM_TICK_MAX_MSEC                    1000U
+
+/* IRQ priority table definitions */
 #define DEV_SM_NUM_IRQ_PRIO_IDX                 20U
 
-#define DEV_SM_IRQ_PRIO_IDX_SYSTICK             0U
+#define DEV_SM_IRQ_PRIO_IDX_SYSCTR              0U
 #define DEV_SM_IRQ_PRIO_IDX_BBNSM               1U
 #define DEV_SM_IRQ_PRIO_IDX_WDOG3               2U
 #define DEV_SM_IRQ_PRIO_IDX_WDOG4               3U
@@ -78,168 +85,149 @@
 
 /* Local variables */
 
-static uint64_t s_smTimeMsec = 0ULL;
+static uint64_t s_tickStart = 0ULL;
+static uint64_t s_tickMsec = 0ULL;
 
 static irq_prio_info_t s_irqPrioInfo[DEV_SM_NUM_IRQ_PRIO_IDX] =
 {
-    [DEV_SM_IRQ_PRIO_IDX_SYSTICK] =
+    [DEV_SM_IRQ_PRIO_IDX_SYSCTR] =
     {
-        .irqId = SysTick_IRQn,
+        .irqId = DEV_SM_TICK_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_BBNSM] =
     {
         .irqId = BBNSM_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_WDOG3] =
     {
         .irqId = WDOG3_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_WDOG4] =
     {
         .irqId = WDOG4_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_WDOG5] =
     {
         .irqId = WDOG5_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_TMPSNS_ANA_1] =
     {
         .irqId = TMPSNS_ANA_1_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_TMPSNS_ANA_2] =
     {
         .irqId = TMPSNS_ANA_2_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_TMPSNS_CORTEXA_1] =
     {
         .irqId = TMPSNS_CORTEXA_1_IRQ,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_TMPSNS_CORTEXA_2] =
     {
         .irqId = TMPSNS_CORTEXA_2_IRQ,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_BOARD_SWI] =
     {
         .irqId = BOARD_SWI_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_CM7_SYSRESETREQ] =
     {
         .irqId = CM7_SYSRESETREQ_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_CM7_LOCKUP] =
     {
         .irqId = CM7_LOCKUP_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_FCCU0] =
     {
         .irqId = FCCU_INT0_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_MU1_B] =
     {
         .irqId = MU1_B_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_MU2_B] =
     {
         .irqId = MU2_B_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_MU3_B] =
     {
         .irqId = MU3_B_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_MU4_B] =
     {
         .irqId = MU4_B_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_MU5_B] =
     {
         .irqId = MU5_B_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_MU6_B] =
     {
         .irqId = MU6_B_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     },
 
     [DEV_SM_IRQ_PRIO_IDX_GPC_SM_REQ] =
     {
         .irqId = GPC_SM_REQ_IRQn,
         .irqCntr = 0U,
-        .basePrio = 0U,
-        .dynPrioEn = false
+        .basePrio = 0U
     }
 };
 
@@ -248,11 +236,9 @@ static irq_prio_info_t s_irqPrioInfo[DEV_SM_NUM_IRQ_PRIO_IDX] =
 static void ExceptionHandler(IRQn_Type excId, const uint32_t *sp,
     uint32_t faultStatus, uint32_t faultAddr);
 static void FaultHandler(uint32_t faultId);
+static void TickSchedule(uint32_t msec);
 static irq_prio_info_t *IrqPrioMap(IRQn_Type irq);
-static void IrqPrioBoost(irq_prio_info_t const * pInfo, uint32_t relPrio);
-static void IrqPrioUpdateRelative(irq_prio_info_t const *pInfo,
-    uint32_t relPrio);
-static void IrqPrioUpdate(irq_prio_info_t *pInfo);
+static void IrqCntrUpdate(irq_prio_info_t *pInfo);
 
 /*--------------------------------------------------------------------------*/
 /* NMI exception handler                                                    */
@@ -341,30 +327,6 @@ void UsageFault_Handler(const uint32_t *sp)
     ExceptionHandler(UsageFault_IRQn, sp, SCB->CFSR, 0U);
 }
 
-/*--------------------------------------------------------------------------*/
-/* SysTick handler                                                          */
-/*--------------------------------------------------------------------------*/
-void SysTick_Handler(void)
-{
-    /*
-     * Intentional: Upon overflow value will rollback to zero.
-     */
-    // coverity[cert_int30_c_violation]
-    s_smTimeMsec += BOARD_TICK_PERIOD_MSEC;
-
-    /* Call system tick */
-    DEV_SM_SystemTick(BOARD_TICK_PERIOD_MSEC);
-
-    /* Call memory tick */
-    DEV_SM_MemTick(BOARD_TICK_PERIOD_MSEC);
-
-    /* Call sensor tick */
-    DEV_SM_SensorTick(BOARD_TICK_PERIOD_MSEC);
-
-    /* Call board tick */
-    BRD_SM_TimerTick(BOARD_TICK_PERIOD_MSEC);
-}
-
 /*--------------------------------------------------------------------------*/
 /* WDOG1 handler                                                            */
 /*--------------------------------------------------------------------------*/
@@ -388,7 +350,7 @@ void BBNSM_IRQHandler(void)
 {
     /* BBM handler will service BBNSM IRQs*/
     DEV_SM_BbmHandler();
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_BBNSM]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_BBNSM]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -397,7 +359,7 @@ void BBNSM_IRQHandler(void)
 void WDOG3_IRQHandler(void)
 {
     FaultHandler(DEV_SM_FAULT_WDOG3);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_WDOG3]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_WDOG3]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -406,7 +368,7 @@ void WDOG3_IRQHandler(void)
 void WDOG4_IRQHandler(void)
 {
     FaultHandler(DEV_SM_FAULT_WDOG4);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_WDOG4]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_WDOG4]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -415,7 +377,7 @@ void WDOG4_IRQHandler(void)
 void WDOG5_IRQHandler(void)
 {
     FaultHandler(DEV_SM_FAULT_WDOG5);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_WDOG5]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_WDOG5]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -424,7 +386,7 @@ void WDOG5_IRQHandler(void)
 void TMPSNS_ANA_1_IRQHandler(void)
 {
     DEV_SM_SensorHandler(0U, 1U);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_ANA_1]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_ANA_1]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -433,7 +395,7 @@ void TMPSNS_ANA_1_IRQHandler(void)
 void TMPSNS_ANA_2_IRQHandler(void)
 {
     DEV_SM_SensorHandler(0U, 2U);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_ANA_2]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_ANA_2]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -449,7 +411,7 @@ void TMPSNS_CORTEXA_1_IRQHandler(void)
     if (status == SM_ERR_SUCCESS)
     {
         DEV_SM_SensorHandler(1U, 1U);
-        IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_CORTEXA_1]);
+        IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_CORTEXA_1]);
     }
 }
 
@@ -466,7 +428,7 @@ void TMPSNS_CORTEXA_2_IRQHandler(void)
     if (status == SM_ERR_SUCCESS)
     {
         DEV_SM_SensorHandler(1U, 2U);
-        IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_CORTEXA_2]);
+        IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_TMPSNS_CORTEXA_2]);
     }
 }
 
@@ -476,7 +438,39 @@ void TMPSNS_CORTEXA_2_IRQHandler(void)
 void Reserved110_IRQHandler(void)
 {
     LMM_Handler();
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_BOARD_SWI]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_BOARD_SWI]);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Handler for ELE MU receive                                               */
+/*--------------------------------------------------------------------------*/
+void Reserved37_IRQHandler(void)
+{
+    /* Complete async ELE request */
+    ELE_MuIrqHandler();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Handler for SCMI scheduler SWI                                           */
+/*--------------------------------------------------------------------------*/
+void Reserved16_IRQHandler(void)
+{
+    /*
+     * Service one message per activation so MU handlers can latch new
+     * doorbells before the next scheduling decision.
+     */
+    bool more = RPC_SCMI_Schedule();
+
+    /* Run deferred work and expired timers between messages */
+    if (TIMER_WorkRun())
+    {
+        more = true;
+    }
+
+    if (more)
+    {
+        SWI_SchedTrigger();
+    }
 }
 
 /*--------------------------------------------------------------------------*/
@@ -518,7 +512,7 @@ void ELE_Group3_IRQHandler(const uint32_t *sp)
 void CM7_SYSRESETREQ_IRQHandler(void)
 {
     FaultHandler(DEV_SM_FAULT_M7_RESET);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_CM7_SYSRESETREQ]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_CM7_SYSRESETREQ]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -527,7 +521,7 @@ void CM7_SYSRESETREQ_IRQHandler(void)
 void CM7_LOCKUP_IRQHandler(void)
 {
     FaultHandler(DEV_SM_FAULT_M7_LOCKUP);
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_CM7_LOCKUP]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_CM7_LOCKUP]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -548,7 +542,7 @@ void MU1_B_IRQHandler(void)
 #ifdef SM_MB_MU1_CONFIG
     MB_MU_Handler(1U);
 #endif
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU1_B]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU1_B]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -569,7 +563,7 @@ void MU2_B_IRQHandler(void)
 #ifdef SM_MB_MU3_CONFIG
     MB_MU_Handler(3U);
 #endif
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU2_B]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU2_B]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -590,7 +584,7 @@ void MU3_B_IRQHandler(void)
 #ifdef SM_MB_MU5_CONFIG
     MB_MU_Handler(5U);
 #endif
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU3_B]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU3_B]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -611,7 +605,7 @@ void MU4_B_IRQHandler(void)
 #ifdef SM_MB_MU7_CONFIG
     MB_MU_Handler(7U);
 #endif
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU4_B]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU4_B]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -632,7 +626,7 @@ void MU5_B_IRQHandler(void)
 #ifdef SM_MB_MU9_CONFIG
     MB_MU_Handler(9U);
 #endif
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU5_B]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU5_B]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -653,7 +647,7 @@ void MU6_B_IRQHandler(void)
 #ifdef SM_MB_MU11_CONFIG
     MB_MU_Handler(11U);
 #endif
-    IrqPrioUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU6_B]);
+    IrqCntrUpdate(&s_irqPrioInfo[DEV_SM_IRQ_PRIO_IDX_MU6_B]);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -715,6 +709,51 @@ void GPC_SM_REQ_IRQHandler(void)
         PWR_LpHandshakeAck();
 #endif
     }
+
+    /* Check for CPU mode changes */
+    DEV_SM_SystemCpuEvent();
+}
+
+/*--------------------------------------------------------------------------*/
+/* System counter compare (tick timer) handler                              */
+/*--------------------------------------------------------------------------*/
+void Reserved88_IRQHandler(void)
+{
+    uint64_t timeMsec = DEV_SM_GetTimerMsec();
+    uint32_t msec;
+    uint32_t next;
+
+    /* Queue expired one-shot timers */
+    if (TIMER_Expire(DEV_SM_Usec64Get()))
+    {
+        SWI_SchedTrigger();
+    }
+
+    /*
+     * False Positive: the system counter is monotonic so the current
+     * time is never less than the time of the last tick.
+     */
+    // coverity[cert_int30_c_violation:FALSE]
+    uint64_t elapsed = timeMsec - s_tickMsec;
+
+    /* Elapsed time since the last tick */
+    msec = U64_U32(MIN(elapsed, U64(DEV_SM_TICK_IDLE)));
+    s_tickMsec = timeMsec;
+
+    /* Call system tick */
+    next = DEV_SM_SystemTick(msec);
+
+    /* Call memory tick */
+    next = MIN(next, DEV_SM_MemTick(msec));
+
+    /* Call sensor tick */
+    next = MIN(next, DEV_SM_SensorTick(msec));
+
+    /* Call board tick */
+    next = MIN(next, BRD_SM_TimerTick(msec));
+
+    /* Program timer for the earliest deadline */
+    TickSchedule(next);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -726,23 +765,80 @@ void SWI_Trigger(void)
     NVIC_SetPendingIRQ(BOARD_SWI_IRQn);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Trigger SCMI scheduler software interrupt                                */
+/*--------------------------------------------------------------------------*/
+void SWI_SchedTrigger(void)
+{
+    /* Trigger scheduler SWI handler */
+    NVIC_SetPendingIRQ(BOARD_SCHED_IRQn);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get time elapsed in msec                                                 */
 /*--------------------------------------------------------------------------*/
 uint64_t DEV_SM_GetTimerMsec(void)
 {
+    /*
+     * False Positive: the system counter is monotonic and the start
+     * value is captured from the same counter.
+     */
+    // coverity[cert_int30_c_violation:FALSE]
+    uint64_t ticks = SYSCTR_GetCounter64() - s_tickStart;
+
     /* Return milliseconds */
-    return s_smTimeMsec;
+    return FIXMATH_DivU64U16(SYSCTR_TICKS_TO_USEC64(ticks), 1000U);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start the tick timer                                                     */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_TickStart(void)
+{
+    /* Capture timebase */
+    s_tickStart = SYSCTR_GetCounter64();
+    s_tickMsec = 0ULL;
+
+    /* Schedule first tick */
+    TickSchedule(BOARD_TICK_PERIOD_MSEC);
+    NVIC_EnableIRQ(DEV_SM_TICK_IRQn);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Enable/disable the tick timer interrupt                                  */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_TickEnable(bool enable)
+{
+    if (enable)
+    {
+        /* Enable and reevaluate deadlines */
+        NVIC_EnableIRQ(DEV_SM_TICK_IRQn);
+        NVIC_SetPendingIRQ(DEV_SM_TICK_IRQn);
+    }
+    else
+    {
+        NVIC_DisableIRQ(DEV_SM_TICK_IRQn);
+        NVIC_ClearPendingIRQ(DEV_SM_TICK_IRQn);
+    }
 }
 
 /*--------------------------------------------------------------------------*/
-/* Update base priority for an IRQ supporting dynamic prioritization        */
+/* Request reevaluation of the tick deadlines                               */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_TickUpdate(void)
+{
+    /* Run the tick handler as soon as priority allows */
+    NVIC_SetPendingIRQ(DEV_SM_TICK_IRQn);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update base priority for an IRQ in the IRQ priority table                */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_IrqPrioBaseSet(IRQn_Type irq, uint32_t basePrio)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Map IRQ to entry in dynamic priority table */
+    /* Map IRQ to entry in IRQ priority table */
     irq_prio_info_t *pInfo = IrqPrioMap(irq);
 
     if (pInfo != NULL)
@@ -771,13 +867,13 @@ int32_t DEV_SM_IrqPrioBaseSet(IRQn_Type irq, uint32_t basePrio)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Get base priority for an IRQ supporting dynamic prioritization           */
+/* Get base priority for an IRQ in the IRQ priority table                   */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_IrqPrioBaseGet(IRQn_Type irq, uint32_t *basePrio)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Map IRQ to entry in dynamic priority table */
+    /* Map IRQ to entry in IRQ priority table */
     irq_prio_info_t const *pInfo = IrqPrioMap(irq);
 
     if (pInfo != NULL)
@@ -795,13 +891,13 @@ int32_t DEV_SM_IrqPrioBaseGet(IRQn_Type irq, uint32_t *basePrio)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Update counter for an IRQ supporting dynamic prioritization              */
+/* Update counter for an IRQ in the IRQ priority table                      */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_IrqPrioCntrSet(IRQn_Type irq, uint32_t irqCntr)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Map IRQ to entry in dynamic priority table */
+    /* Map IRQ to entry in IRQ priority table */
     irq_prio_info_t *pInfo = IrqPrioMap(irq);
 
     if (pInfo != NULL)
@@ -819,13 +915,13 @@ int32_t DEV_SM_IrqPrioCntrSet(IRQn_Type irq, uint32_t irqCntr)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Get counter for an IRQ supporting dynamic prioritization                 */
+/* Get counter for an IRQ in the IRQ priority table                         */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_IrqPrioCntrGet(IRQn_Type irq, uint32_t *irqCntr)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Map IRQ to entry in dynamic priority table */
+    /* Map IRQ to entry in IRQ priority table */
     irq_prio_info_t const *pInfo = IrqPrioMap(irq);
 
     if (pInfo != NULL)
@@ -843,7 +939,7 @@ int32_t DEV_SM_IrqPrioCntrGet(IRQn_Type irq, uint32_t *irqCntr)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Update dynamic priority of active IRQ                                    */
+/* Update counter of active IRQ                                             */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_IrqPrioUpdate(void)
 {
@@ -857,14 +953,14 @@ int32_t DEV_SM_IrqPrioUpdate(void)
     int32_t irq = (int32_t) vectActive;
     irq -= 16;
 
-    /* Map IRQ to entry in dynamic priority table */
+    /* Map IRQ to entry in IRQ priority table */
     // coverity[misra_c_2012_rule_10_5_violation]
     irq_prio_info_t *pInfo = IrqPrioMap((IRQn_Type) irq);
 
     if (pInfo != NULL)
     {
-        /* Adjust dynamic IRQ priority */
-        IrqPrioUpdate(pInfo);
+        /* Count IRQ occurrence */
+        IrqCntrUpdate(pInfo);
     }
     else
     {
@@ -949,7 +1045,33 @@ static void FaultHandler(uint32_t faultId)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Map IRQ to dynamic priority table entry                                  */
+/* Program the tick timer                                                   */
+/*--------------------------------------------------------------------------*/
+static void TickSchedule(uint32_t msec)
+{
+    /* Clamp to tick granularity and maximum period */
+    uint32_t period = MIN(MAX(msec, BOARD_TICK_PERIOD_MSEC),
+        DEV_SM_TICK_MAX_MSEC);
+
+    /*
+     * Deadlines are relative to the last tick so handler latency does
+     * not accumulate as drift.
+     */
+    uint64_t usec = (s_tickMsec + U64(period)) * 1000ULL;
+    uint64_t ticks = s_tickStart + SYSCTR_USEC_TO_TICKS64(usec);
+    uint64_t timer = TIMER_NextGet();
+
+    /* Wake earlier for a one-shot timer */
+    if (timer != TIMER_NONE)
+    {
+        ticks = MIN(ticks, SYSCTR_USEC_TO_TICKS64(timer));
+    }
+
+    SYSCTR_CompareSet(ticks);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Map IRQ to IRQ priority table entry                                      */
 /*--------------------------------------------------------------------------*/
 static irq_prio_info_t *IrqPrioMap(IRQn_Type irq)
 {
@@ -985,114 +1107,14 @@ static irq_prio_info_t *IrqPrioMap(IRQn_Type irq)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Boost dynamic priority of IRQ                                            */
+/* Update occurrence counter of IRQ                                         */
 /*--------------------------------------------------------------------------*/
-static void IrqPrioBoost(irq_prio_info_t const *pInfo, uint32_t relPrio)
-{
-    if (pInfo != NULL)
-    {
-        /* Check if dynamic priority is enabled for this IRQ */
-        if (pInfo->dynPrioEn)
-        {
-            /* Get current priority */
-            IRQn_Type irqId = pInfo->irqId;
-            uint32_t irqPrio = NVIC_GetPriority(irqId);
-
-            /* Check if priority at same relative level */
-            if (irqPrio == relPrio)
-            {
-                /* raise active priority */
-                irqPrio--;
-                NVIC_SetPriority(irqId, irqPrio);
-            }
-        }
-    }
-}
-
-/*--------------------------------------------------------------------------*/
-/* Adjust dynamic IRQ priority by raising priority of non-active IRQs       */
-/*--------------------------------------------------------------------------*/
-static void IrqPrioUpdateRelative(irq_prio_info_t const *pInfo,
-    uint32_t relPrio)
-{
-    if (pInfo != NULL)
-    {
-        uint32_t idx;
-
-#ifdef BOARD_NUM_IRQ_PRIO_IDX
-        /* Loop over board-defined table entries */
-        idx = 0U;
-        while (idx < BOARD_NUM_IRQ_PRIO_IDX)
-        {
-            /* Get table entry */
-            irq_prio_info_t const *pInfoRel = &g_brdIrqPrioInfo[idx];
-
-            /* Check if table entry is active IRQ */
-            if (pInfo != pInfoRel)
-            {
-                /* Boost priority of non-active IRQ */
-                IrqPrioBoost(pInfoRel, relPrio);
-            }
-
-            idx++;
-        }
-#endif
-
-        /* Loop over compulsory table entries */
-        idx = 0U;
-        while (idx < DEV_SM_NUM_IRQ_PRIO_IDX)
-        {
-            /* Get table entry */
-            irq_prio_info_t const *pInfoRel = &s_irqPrioInfo[idx];
-
-            /* Check if table entry is active IRQ */
-            if (pInfo != pInfoRel)
-            {
-                /* Boost priority of non-active IRQ */
-                IrqPrioBoost(pInfoRel, relPrio);
-            }
-
-            idx++;
-        }
-    }
-}
-
-/*--------------------------------------------------------------------------*/
-/* Update dynamic priority of IRQ using priority info table index           */
-/*--------------------------------------------------------------------------*/
-static void IrqPrioUpdate(irq_prio_info_t *pInfo)
+static void IrqCntrUpdate(irq_prio_info_t *pInfo)
 {
     if (pInfo != NULL)
     {
         /* Update IRQ counter */
         ++pInfo->irqCntr;
-
-        /* Get current priority */
-        IRQn_Type irqId = pInfo->irqId;
-        uint32_t irqPrio = NVIC_GetPriority(irqId);
-
-        /* Check for first dynamic priority update for this IRQ */
-        if (!pInfo->dynPrioEn)
-        {
-            /* Indicate IRQ participating in dynamic priority */
-            pInfo->dynPrioEn = true;
-
-            /* Capture base priority */
-            pInfo->basePrio = irqPrio;
-        }
-
-        /* Check if IRQ at base priority */
-        if (irqPrio == pInfo->basePrio)
-        {
-            /* Lower active priority */
-            irqPrio++;
-            NVIC_SetPriority(irqId, irqPrio);
-        }
-        /* Else lower relative IRQ priority */
-        else
-        {
-            IrqPrioUpdateRelative(pInfo, irqPrio);
-        }
     }
 }
 
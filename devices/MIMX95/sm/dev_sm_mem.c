@@ -187,6 +187,12 @@ int32_t DEV_SM_MemDdrRetentionEnter(void)
         {
             status = SM_ERR_HARDWARE_ERROR;
         }
+
+        /* Record retention entry timing */
+        struct ddr_timing timing;
+        DDR_GetRetentionTiming(&timing);
+        g_syslog.sysSleepRecord.ddrIdleUsec = timing.idleUsec;
+        g_syslog.sysSleepRecord.ddrLpUsec = timing.lpUsec;
     }
 
     if (status == SM_ERR_SUCCESS)
@@ -219,6 +225,7 @@ int32_t DEV_SM_MemDdrRetentionEnter(void)
 int32_t DEV_SM_MemDdrRetentionExit(void)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint64_t rstStart = DEV_SM_Usec64Get();
     const struct ddr_info* ddr = (struct ddr_info*) &__DdrInfo;
     uint8_t powerState = DEV_SM_POWER_STATE_OFF;
 
@@ -306,12 +313,22 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
 
     if (status == SM_ERR_SUCCESS)
     {
+        /* Record PHY reset and DRAM PLL timing */
+        g_syslog.sysSleepRecord.ddrRstUsec =
+            UINT64_L(DEV_SM_Usec64Get() - rstStart);
+
         /* Exit retention */
         if (!DDR_ExitRetention(ddr))
         {
             status = SM_ERR_HARDWARE_ERROR;
         }
 
+        /* Record retention exit timing */
+        struct ddr_timing timing;
+        DDR_GetRetentionTiming(&timing);
+        g_syslog.sysSleepRecord.ddrPhyUsec = timing.phyUsec;
+        g_syslog.sysSleepRecord.ddrCtrlUsec = timing.ddrcUsec;
+
         /* Restore DDRMIX block control */
         BLK_CTRL_DDRMIX->HWFFC_CTRL = s_ddrBlkCtrl.HWFFC_CTRL;
         BLK_CTRL_DDRMIX->DDRC_STOP_CTRL = s_ddrBlkCtrl.DDRC_STOP_CTRL;
@@ -339,16 +356,18 @@ int32_t DEV_SM_MemDdrRetentionExit(void)
 /*--------------------------------------------------------------------------*/
 /* Memory timer tick                                                        */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_MemTick(uint32_t msec)
+uint32_t DEV_SM_MemTick(uint32_t msec)
 {
+    uint32_t next = DEV_SM_TICK_IDLE;
+
 #ifdef USES_RX_REPLICA
     /* Tick DDR */
     /*
-     * False Positive: The msec value is 10
+     * False Positive: The msec value is clamped to 1000
      * and the base rolls to 0 at 1000.
      */
     // coverity[cert_int30_c_violation:FALSE]
-    s_ddrMseconds += msec;
+    s_ddrMseconds += MIN(msec, 1000U);
 
     /* Handle DDR periodic tick */
     if (s_ddrMseconds >= 1000U)
@@ -356,7 +375,13 @@ void DEV_SM_MemTick(uint32_t msec)
         s_ddrMseconds = 0U;
         DDR_RxReplicaWa(&s_rxClkDelay, 16U);
     }
+
+    /* Next DDR periodic tick */
+    next = 1000U - s_ddrMseconds;
 #endif
+
+    /* Return next deadline */
+    return next;
 }
 
 /*==========================================================================*/
@@ -42,6 +42,8 @@
 #include "dev_sm.h"
 #include "brd_sm.h"
 #include "fsl_fract_pll.h"
+#include "timer.h"
+#include "binlog.h"
 
 /* Local defines */
 
@@ -52,6 +54,7 @@
 #define DEV_SM_PERF_LAST            (DEV_SM_NUM_PERF - 1U)
 #define DEV_SM_A55_GPR_SEL_IDX      1U
 #define DEV_SM_A55_GPR_SEL_MASK     0x7FU
+#define DEV_SM_A55_POLL_USEC        10U
 
 /* SYSPLL PFD fixed-rate mappings */
 #define DEV_SM_PERF_PARENT_1000MHZ  DEV_SM_CLK_SYSPLL1_PFD0
@@ -128,6 +131,14 @@ typedef struct
 
 /* Local variables */
 
+/* A55 PLL relock in the background */
+static timer_work_t s_perfA55Timer;
+static uint32_t s_perfA55Level;
+static uint64_t s_perfA55Start;
+static bool s_perfA55Async = false;
+static bool s_perfA55Pending = false;
+static bool s_perfA55Retry = false;
+
 /* Current performance level per domain */
 static uint32_t s_perfLevelCurrent[DEV_SM_NUM_PERF] =
 {
@@ -1369,6 +1380,10 @@ static int32_t DEV_SM_PerfCamFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfDispFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfDramFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel);
+static int32_t DEV_SM_PerfA55PllSwitch(uint32_t perfLevel);
+static void DEV_SM_PerfA55Timer(uint32_t cookie);
+static void DEV_SM_PerfA55Sync(void);
+static void DEV_SM_PerfA55Done(bool locked);
 static int32_t DEV_SM_PerfFreqUpdate(uint32_t domainId, uint32_t perfLevel);
 static int32_t DEV_SM_PerfCurrentUpdate(uint32_t domainId, uint32_t perfLevel);
 static int32_t DEV_SM_PerfCurrentGet(uint32_t domainId, uint32_t * perfLevel);
@@ -1381,6 +1396,9 @@ int32_t DEV_SM_PerfInit(uint32_t bootPerfLevel, uint32_t runPerfLevel)
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Init A55 PLL relock timer */
+    TIMER_WorkInit(&s_perfA55Timer, DEV_SM_PerfA55Timer, 0U);
+
     /* Initialize fixed SoC BUS clocks not configured by ROM */
     (void) DEV_SM_PerfBusFreqSet(false);
 
@@ -1494,6 +1512,9 @@ int32_t DEV_SM_PerfInit(uint32_t bootPerfLevel, uint32_t runPerfLevel)
         }
     }
 
+    /* Later A55 PLL relocks complete in the background */
+    s_perfA55Async = true;
+
     /* Return status */
     return status;
 }
@@ -2412,6 +2433,9 @@ static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel)
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Finish any relock in progress */
+    DEV_SM_PerfA55Sync();
+
     if (perfLevel >= s_perfNumLevels[PS_VDD_ARM])
     {
         status = SM_ERR_OUT_OF_RANGE;
@@ -2424,6 +2448,7 @@ static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel)
     uint32_t selIdx = DEV_SM_A55_GPR_SEL_IDX;
     uint32_t selMask = DEV_SM_A55_GPR_SEL_MASK;
 
+    /* Glitch-free switch of cores to the root while the PLL changes */
     if (status == SM_ERR_SUCCESS)
     {
         if (!CCM_GprValSet(selIdx, selMask, 0U))
@@ -2436,39 +2461,51 @@ static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel)
         status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_A55PERIPH,
             &s_perfRootCfgA55Per[perfLevel]);
     }
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && (perfLevel > DEV_SM_PERF_LVL_PRK))
     {
-        if (perfLevel > DEV_SM_PERF_LVL_PRK)
+        // cppcheck-suppress arrayIndexOutOfBoundsCond
+        dev_sm_perf_pll_cfg_t const *pllCfg = &s_perfPllCfgA55[perfLevel];
+
+        /* VCO already at rate, only the DFS outputs change */
+        if (FRACTPLL_RateMatch(CLOCK_PLL_ARM, pllCfg->mfi, pllCfg->mfn,
+            pllCfg->odiv))
         {
-            status = DEV_SM_PerfPllFreqUpdate(CLOCK_PLL_ARM,
-                // cppcheck-suppress arrayIndexOutOfBoundsCond
-                &s_perfPllCfgA55[perfLevel]);
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 0U,
-                    &s_perfPfdCfgA55C[perfLevel]);
-            }
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 1U,
-                    &s_perfPfdCfgA55C[perfLevel]);
-            }
-            if (status == SM_ERR_SUCCESS)
+            status = DEV_SM_PerfA55PllSwitch(perfLevel);
+        }
+        else if (!FRACTPLL_StartRate(CLOCK_PLL_ARM, pllCfg->mfi,
+            pllCfg->mfn, pllCfg->odiv))
+        {
+            status = SM_ERR_HARDWARE_ERROR;
+        }
+        else if (s_perfA55Async)
+        {
+            /* Switch back from the timer once locked */
+            s_perfA55Level = perfLevel;
+            s_perfA55Start = DEV_SM_Usec64Get();
+            s_perfA55Pending = true;
+            s_perfA55Retry = false;
+            TIMER_Start(&s_perfA55Timer, DEV_SM_A55_POLL_USEC);
+        }
+        else
+        {
+            uint32_t pllLockUsec = 0U;
+            bool locked = FRACTPLL_RateLocked(CLOCK_PLL_ARM);
+
+            /* Wait for lock */
+            while (!locked && (pllLockUsec < ES_MAX_USEC_PLL_LOCK))
             {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 2U,
-                    &s_perfPfdCfgA55C[perfLevel]);
+                SystemTimeDelay(1U);
+                pllLockUsec++;
+                locked = FRACTPLL_RateLocked(CLOCK_PLL_ARM);
             }
-            if (status == SM_ERR_SUCCESS)
+
+            if (locked)
             {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 3U,
-                    &s_perfPfdCfgA55P[perfLevel]);
+                status = DEV_SM_PerfA55PllSwitch(perfLevel);
             }
-            if (status == SM_ERR_SUCCESS)
+            else
             {
-                if (!CCM_GprValSet(selIdx, selMask, selMask))
-                {
-                    status = SM_ERR_HARDWARE_ERROR;
-                }
+                status = SM_ERR_HARDWARE_ERROR;
             }
         }
     }
@@ -2477,6 +2514,132 @@ static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Switch A55 cores back to the locked ARM PLL                              */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PerfA55PllSwitch(uint32_t perfLevel)
+{
+    int32_t status;
+
+    status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 0U,
+        &s_perfPfdCfgA55C[perfLevel]);
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 1U,
+            &s_perfPfdCfgA55C[perfLevel]);
+    }
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 2U,
+            &s_perfPfdCfgA55C[perfLevel]);
+    }
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 3U,
+            &s_perfPfdCfgA55P[perfLevel]);
+    }
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (!CCM_GprValSet(DEV_SM_A55_GPR_SEL_IDX, DEV_SM_A55_GPR_SEL_MASK,
+            DEV_SM_A55_GPR_SEL_MASK))
+        {
+            status = SM_ERR_HARDWARE_ERROR;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Poll A55 PLL relock from timer                                           */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PerfA55Timer(uint32_t cookie)
+{
+    if (FRACTPLL_RateLocked(CLOCK_PLL_ARM))
+    {
+        DEV_SM_PerfA55Done(true);
+    }
+    else if ((DEV_SM_Usec64Get() - s_perfA55Start)
+        < ES_MAX_USEC_PLL_LOCK)
+    {
+        TIMER_Start(&s_perfA55Timer, DEV_SM_A55_POLL_USEC);
+    }
+    else if (!s_perfA55Retry)
+    {
+        dev_sm_perf_pll_cfg_t const *pllCfg =
+            &s_perfPllCfgA55[s_perfA55Level];
+
+        /* Lock timed out, restart the relock once */
+        s_perfA55Retry = true;
+        if (FRACTPLL_StartRate(CLOCK_PLL_ARM, pllCfg->mfi, pllCfg->mfn,
+            pllCfg->odiv))
+        {
+            s_perfA55Start = DEV_SM_Usec64Get();
+            TIMER_Start(&s_perfA55Timer, DEV_SM_A55_POLL_USEC);
+        }
+        else
+        {
+            DEV_SM_PerfA55Done(false);
+        }
+    }
+    else
+    {
+        DEV_SM_PerfA55Done(false);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete any A55 PLL relock in progress                                  */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PerfA55Sync(void)
+{
+    if (s_perfA55Pending)
+    {
+        bool locked = FRACTPLL_RateLocked(CLOCK_PLL_ARM);
+
+        /* Stop polling from the timer */
+        TIMER_Cancel(&s_perfA55Timer);
+
+        /* Wait for the rest of the lock time */
+        while (!locked && ((DEV_SM_Usec64Get() - s_perfA55Start)
+            < ES_MAX_USEC_PLL_LOCK))
+        {
+            SystemTimeDelay(1U);
+            locked = FRACTPLL_RateLocked(CLOCK_PLL_ARM);
+        }
+
+        DEV_SM_PerfA55Done(locked);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Finish an A55 PLL relock and update the current level                    */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PerfA55Done(bool locked)
+{
+    int32_t status = SM_ERR_HARDWARE_ERROR;
+    uint32_t perfLevel = s_perfA55Level;
+
+    s_perfA55Pending = false;
+
+    /* Switch cores back to the PLL */
+    if (locked)
+    {
+        status = DEV_SM_PerfA55PllSwitch(perfLevel);
+    }
+
+    if (status != SM_ERR_SUCCESS)
+    {
+        BINLOG2(BINLOG_ID_A55_RELOCK,
+            "A55 relock failed, level=%u, status=%d", perfLevel, status);
+
+        /* Cores remain on the root, same as parked */
+        (void) DEV_SM_PerfCurrentUpdate(DEV_SM_PERF_A55,
+            DEV_SM_PERF_LVL_PRK);
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Update frequency of performance level                                    */
 /*--------------------------------------------------------------------------*/
@@ -40,13 +40,61 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
+#include "timer.h"
 
 /* Local defines */
 
+/* Time to poll a power down before using the timeout fallback */
+#define DEV_SM_POWER_DOWN_USEC     100ULL
+
+/* Time to wait on a hardware sequence before failing the transition */
+#define DEV_SM_POWER_TIMEOUT_USEC  10000ULL
+
+/* Interval to poll in flight transitions */
+#define DEV_SM_POWER_POLL_USEC     10U
+
+/* Max MIX slices ramping at once if not limited by the board */
+#ifndef BOARD_PWR_MAX_INRUSH
+#define BOARD_PWR_MAX_INRUSH       1U
+#endif
+
+/* Power transition steps */
+#define DEV_SM_POWER_STEP_IDLE  0U  /* No transition */
+#define DEV_SM_POWER_STEP_WAIT  1U  /* Waiting on parent, child, or inrush */
+#define DEV_SM_POWER_STEP_RAMP  2U  /* Hardware sequence in flight */
+#define DEV_SM_POWER_STEP_POST  3U  /* Post-processing due */
+
 /* Local types */
 
+/* Split-phase power transition of a domain */
+typedef struct
+{
+    uint64_t startUsec;   /* Time the hardware sequence was requested */
+    int32_t status;       /* Status of the last transition */
+    uint8_t step;         /* Transition step */
+    uint8_t powerState;   /* Target power state */
+    uint8_t nextState;    /* Power state queued behind this transition */
+    bool next;            /* Next state queued */
+    bool report;          /* Report completion to the LMM */
+} dev_sm_power_trans_t;
+
 /* Local variables */
 
+static dev_sm_power_trans_t s_powerTrans[DEV_SM_NUM_POWER];
+static timer_work_t s_powerTimer;
+
+/* Local functions */
+
+static void DEV_SM_PowerTransRequest(uint32_t domainId, uint8_t powerState);
+static void DEV_SM_PowerTransStep(uint32_t domainId);
+static bool DEV_SM_PowerTransBlocked(uint32_t domainId);
+static bool DEV_SM_PowerTransTo(uint32_t domainId, uint8_t powerState);
+static void DEV_SM_PowerTransStart(uint32_t domainId);
+static void DEV_SM_PowerTransRamp(uint32_t domainId);
+static void DEV_SM_PowerTransDone(uint32_t domainId, int32_t status);
+static void DEV_SM_PowerTimer(uint32_t cookie);
+
 /*--------------------------------------------------------------------------*/
 /* Initialize CPU domains                                                   */
 /*--------------------------------------------------------------------------*/
@@ -64,6 +112,9 @@ int32_t DEV_SM_PowerInit(void)
         }
     }
 
+    /* Init transition poll timer */
+    TIMER_WorkInit(&s_powerTimer, DEV_SM_PowerTimer, 0U);
+
     /* Disable AutoAck of SM LP handshakes */
     BLK_CTRL_S_AONMIX->SM_LP_HANDSHAKE_STATUS =
         BLK_CTRL_S_AONMIX_SM_LP_HANDSHAKE_STATUS_AUTOACK(0U);
@@ -163,76 +214,162 @@ int32_t DEV_SM_PowerStateNameGet(uint32_t powerState, string *stateNameAddr,
 /* Set power domain state                                                   */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
+{
+    bool pending = false;
+
+    /* Start transition */
+    int32_t status = DEV_SM_PowerStateSetAsync(domainId, powerState,
+        &pending);
+
+    /* Advance transitions until this domain is done */
+    if (pending)
+    {
+        while (s_powerTrans[domainId].step != DEV_SM_POWER_STEP_IDLE)
+        {
+            (void) DEV_SM_PowerPoll();
+        }
+        status = s_powerTrans[domainId].status;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start setting power domain state                                         */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PowerStateSetAsync(uint32_t domainId, uint8_t powerState,
+    bool *pending)
 {
     int32_t status = SM_ERR_SUCCESS;
     bool pdDisabled = DEV_SM_FusePdDisabled(domainId);
 
+    *pending = false;
+
     if (pdDisabled || (domainId >= DEV_SM_NUM_POWER))
     {
         status = SM_ERR_NOT_FOUND;
     }
+    else if (powerState >= DEV_SM_NUM_POWER_STATE)
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
     else
     {
-        switch (powerState)
+        dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+        /* Try to start a new transition right away */
+        if (trans->step == DEV_SM_POWER_STEP_IDLE)
         {
-            case DEV_SM_POWER_STATE_ON:
-                if (PWR_IsParentPowered(domainId))
-                {
-                    /* Skip MIX-level transaction blocking on Rev A  */
-                    if (DEV_SM_SiVerGet() < DEV_SM_SIVER_B0)
-                    {
-                        if (SRC_MixSoftPowerUp(domainId))
-                        {
-                            status = DEV_SM_PowerUpPost(domainId);
-                        }
-                    }
-                    else
-                    {
-                        PWR_MixSsiBlockingSet(domainId, false);
-                        if (SRC_MixSoftPowerUp(domainId))
-                        {
-                            status = DEV_SM_PowerUpPost(domainId);
-
-                            if (status == SM_ERR_SUCCESS)
-                            {
-                                PWR_MixSsiBlockingUpdate(domainId);
-                            }
-                        }
-                    }
-                }
-                else
-                {
-                    status = SM_ERR_POWER;
-                }
-                break;
-            case DEV_SM_POWER_STATE_OFF:
-                if (!PWR_AnyChildPowered(domainId))
-                {
-                    /* Skip MIX-level transaction blocking on Rev A  */
-                    if (DEV_SM_SiVerGet() < DEV_SM_SIVER_B0)
-                    {
-                        if (DEV_SM_PowerDownPre(domainId) == SM_ERR_SUCCESS)
-                        {
-                            SRC_MixSoftPowerDown(domainId);
-                        }
-                    }
-                    else
-                    {
-                        PWR_MixSsiBlockingSet(domainId, false);
-                        if (DEV_SM_PowerDownPre(domainId) == SM_ERR_SUCCESS)
-                        {
-                            SRC_MixSoftPowerDown(domainId);
-                        }
-                    }
-                }
-                else
+            DEV_SM_PowerTransRequest(domainId, powerState);
+            DEV_SM_PowerTransStep(domainId);
+
+            status = trans->status;
+        }
+        else
+        {
+            DEV_SM_PowerTransRequest(domainId, powerState);
+        }
+
+        /* Report completion if still in flight */
+        if (trans->step != DEV_SM_POWER_STEP_IDLE)
+        {
+            status = SM_ERR_SUCCESS;
+            trans->report = true;
+            *pending = true;
+
+            /* Poll from a timer rather than spinning */
+            TIMER_Start(&s_powerTimer, DEV_SM_POWER_POLL_USEC);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Advance in flight power transitions                                      */
+/*--------------------------------------------------------------------------*/
+bool DEV_SM_PowerPoll(void)
+{
+    bool busy = false;
+
+    /* Step each domain in transition */
+    for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER; domainId++)
+    {
+        if (s_powerTrans[domainId].step != DEV_SM_POWER_STEP_IDLE)
+        {
+            DEV_SM_PowerTransStep(domainId);
+
+            if (s_powerTrans[domainId].step != DEV_SM_POWER_STEP_IDLE)
+            {
+                busy = true;
+            }
+        }
+    }
+
+    /* Return if still in flight */
+    return busy;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Power up a set of power domains                                          */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PowerUpBatch(uint32_t domainMask)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool busy = true;
+
+    /* Check domains */
+    for (uint32_t domainId = 0U; domainId < 32U; domainId++)
+    {
+        if (((domainMask & (1UL << domainId)) != 0U)
+            && ((domainId >= DEV_SM_NUM_POWER)
+            || DEV_SM_FusePdDisabled(domainId)))
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Request all before stepping so children wait on parents */
+        for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+            domainId++)
+        {
+            if ((domainMask & (1UL << domainId)) != 0U)
+            {
+                DEV_SM_PowerTransRequest(domainId, DEV_SM_POWER_STATE_ON);
+            }
+        }
+
+        /* Advance transitions until all requested domains are done */
+        while (busy)
+        {
+            (void) DEV_SM_PowerPoll();
+
+            busy = false;
+            for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+                domainId++)
+            {
+                if (((domainMask & (1UL << domainId)) != 0U)
+                    && (s_powerTrans[domainId].step
+                    != DEV_SM_POWER_STEP_IDLE))
                 {
-                    status = SM_ERR_POWER;
+                    busy = true;
                 }
-                break;
-            default:
-                status = SM_ERR_INVALID_PARAMETERS;
-                break;
+            }
+        }
+
+        /* Return first failure */
+        for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+            domainId++)
+        {
+            if ((status == SM_ERR_SUCCESS)
+                && ((domainMask & (1UL << domainId)) != 0U))
+            {
+                status = s_powerTrans[domainId].status;
+            }
         }
     }
 
@@ -312,3 +449,299 @@ int32_t DEV_SM_PowerRetMaskGet(uint32_t domainId, uint32_t *retMask)
     return status;
 }
 
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Request power transition of a domain                                     */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransRequest(uint32_t domainId, uint8_t powerState)
+{
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    switch (trans->step)
+    {
+        case DEV_SM_POWER_STEP_IDLE:
+            /* New transition, nothing to report yet */
+            trans->status = SM_ERR_SUCCESS;
+            trans->powerState = powerState;
+            trans->next = false;
+            trans->report = false;
+            trans->step = DEV_SM_POWER_STEP_WAIT;
+            break;
+        case DEV_SM_POWER_STEP_WAIT:
+            /* Not started, just retarget */
+            trans->powerState = powerState;
+            break;
+        default:
+            /* Queue behind the hardware sequence */
+            trans->nextState = powerState;
+            trans->next = (powerState != trans->powerState);
+            break;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Advance power transition of a domain by one step                         */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransStep(uint32_t domainId)
+{
+    int32_t status;
+
+    switch (s_powerTrans[domainId].step)
+    {
+        case DEV_SM_POWER_STEP_WAIT:
+            if (!DEV_SM_PowerTransBlocked(domainId))
+            {
+                DEV_SM_PowerTransStart(domainId);
+            }
+            break;
+        case DEV_SM_POWER_STEP_RAMP:
+            DEV_SM_PowerTransRamp(domainId);
+            break;
+        case DEV_SM_POWER_STEP_POST:
+            /* Post power up processing */
+            status = DEV_SM_PowerUpPost(domainId);
+
+            /* Restore MIX-level transaction blocking */
+            if ((status == SM_ERR_SUCCESS)
+                && (DEV_SM_SiVerGet() >= DEV_SM_SIVER_B0))
+            {
+                PWR_MixSsiBlockingUpdate(domainId);
+            }
+
+            DEV_SM_PowerTransDone(domainId, status);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if power transition must wait on another domain                    */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_PowerTransBlocked(uint32_t domainId)
+{
+    bool blocked = false;
+
+    if (s_powerTrans[domainId].powerState == DEV_SM_POWER_STATE_ON)
+    {
+        uint32_t parentId = PWR_ParentGet(domainId);
+        uint32_t numRamp = 0U;
+
+        /* Wait for parent powering up */
+        if ((parentId < DEV_SM_NUM_POWER)
+            && DEV_SM_PowerTransTo(parentId, DEV_SM_POWER_STATE_ON))
+        {
+            blocked = true;
+        }
+
+        /* Limit inrush current */
+        for (uint32_t id = 0U; id < DEV_SM_NUM_POWER; id++)
+        {
+            if ((s_powerTrans[id].step == DEV_SM_POWER_STEP_RAMP)
+                && (s_powerTrans[id].powerState == DEV_SM_POWER_STATE_ON))
+            {
+                numRamp++;
+            }
+        }
+        if (numRamp >= BOARD_PWR_MAX_INRUSH)
+        {
+            blocked = true;
+        }
+    }
+    else
+    {
+        /* Wait for children powering down */
+        for (uint32_t id = 0U; id < DEV_SM_NUM_POWER; id++)
+        {
+            if ((PWR_ParentGet(id) == domainId)
+                && DEV_SM_PowerTransTo(id, DEV_SM_POWER_STATE_OFF))
+            {
+                blocked = true;
+            }
+        }
+    }
+
+    /* Return result */
+    return blocked;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if a domain is in transition to a power state                      */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_PowerTransTo(uint32_t domainId, uint8_t powerState)
+{
+    const dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    /* Return result */
+    return (trans->step != DEV_SM_POWER_STEP_IDLE)
+        && ((trans->powerState == powerState)
+        || (trans->next && (trans->nextState == powerState)));
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start hardware sequence of power transition                              */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransStart(uint32_t domainId)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool started = false;
+
+    if (s_powerTrans[domainId].powerState == DEV_SM_POWER_STATE_ON)
+    {
+        if (PWR_IsParentPowered(domainId))
+        {
+            /* Skip MIX-level transaction blocking on Rev A  */
+            if (DEV_SM_SiVerGet() >= DEV_SM_SIVER_B0)
+            {
+                PWR_MixSsiBlockingSet(domainId, false);
+            }
+
+            /* Request power up */
+            started = SRC_MixSoftPowerUpStart(domainId);
+            if (!started)
+            {
+                SRC_MixSoftPowerUpFinish(domainId);
+            }
+        }
+        else
+        {
+            status = SM_ERR_POWER;
+        }
+    }
+    else
+    {
+        if (!PWR_AnyChildPowered(domainId))
+        {
+            /* Skip MIX-level transaction blocking on Rev A  */
+            if (DEV_SM_SiVerGet() >= DEV_SM_SIVER_B0)
+            {
+                PWR_MixSsiBlockingSet(domainId, false);
+            }
+
+            /* Request power down */
+            if (DEV_SM_PowerDownPre(domainId) == SM_ERR_SUCCESS)
+            {
+                started = SRC_MixSoftPowerDownStart(domainId);
+                if (!started)
+                {
+                    SRC_MixSoftPowerDownFinish(domainId, false);
+                }
+            }
+        }
+        else
+        {
+            status = SM_ERR_POWER;
+        }
+    }
+
+    if (started)
+    {
+        /* Poll hardware sequence */
+        s_powerTrans[domainId].startUsec = DEV_SM_Usec64Get();
+        s_powerTrans[domainId].step = DEV_SM_POWER_STEP_RAMP;
+    }
+    else
+    {
+        DEV_SM_PowerTransDone(domainId, status);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check hardware sequence of power transition                              */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransRamp(uint32_t domainId)
+{
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    /*
+     * False Positive: the start time is captured from the same
+     * monotonic counter before the current time.
+     */
+    // coverity[cert_int30_c_violation:FALSE]
+    uint64_t elapsed = DEV_SM_Usec64Get() - trans->startUsec;
+
+    if (trans->powerState == DEV_SM_POWER_STATE_ON)
+    {
+        if (SRC_MixIsPwrReady(domainId))
+        {
+            SRC_MixSoftPowerUpFinish(domainId);
+
+            /* Post-process on the next step */
+            trans->step = DEV_SM_POWER_STEP_POST;
+        }
+        else if (elapsed >= DEV_SM_POWER_TIMEOUT_USEC)
+        {
+            SRC_MixSoftPowerUpFinish(domainId);
+            DEV_SM_PowerTransDone(domainId, SM_ERR_HARDWARE_ERROR);
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+    }
+    else
+    {
+        /* Done, or forced done by the timeout fallback */
+        if (SRC_MixIsPwrDown(domainId)
+            || ((elapsed >= DEV_SM_POWER_DOWN_USEC)
+            && SRC_MixSoftPowerDownForce(domainId)))
+        {
+            SRC_MixSoftPowerDownFinish(domainId, true);
+            DEV_SM_PowerTransDone(domainId, SM_ERR_SUCCESS);
+        }
+        else if (elapsed >= DEV_SM_POWER_TIMEOUT_USEC)
+        {
+            /* Restore LP handshake without waiting */
+            SRC_MixSoftPowerDownFinish(domainId, false);
+            DEV_SM_PowerTransDone(domainId, SM_ERR_HARDWARE_ERROR);
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* End power transition of a domain                                         */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTransDone(uint32_t domainId, int32_t status)
+{
+    dev_sm_power_trans_t *trans = &s_powerTrans[domainId];
+
+    trans->status = status;
+
+    if (trans->next)
+    {
+        /* Start queued transition */
+        trans->powerState = trans->nextState;
+        trans->next = false;
+        trans->step = DEV_SM_POWER_STEP_WAIT;
+    }
+    else
+    {
+        /* Mark done */
+        trans->step = DEV_SM_POWER_STEP_IDLE;
+
+        /* Report completion */
+        if (trans->report)
+        {
+            trans->report = false;
+            LMM_PowerStateComplete(domainId, status);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Poll in flight power transitions from timer                              */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PowerTimer(uint32_t cookie)
+{
+    /* Rearm until complete */
+    if (DEV_SM_PowerPoll())
+    {
+        TIMER_Start(&s_powerTimer, DEV_SM_POWER_POLL_USEC);
+    }
+}
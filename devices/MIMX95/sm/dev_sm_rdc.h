@@ -76,6 +76,19 @@
 
 /* Functions */
 
+/*!
+ * Wait for the ELE to release an RDC.
+ *
+ * @param[in]     rdcId       Index of RDC, DEV_SM_NUM_RDC to wait for all
+ *
+ * DEV_SM_RdcInit() releases the RDCs one at a time in index order without
+ * waiting. This function polls the ELE until the release of \a rdcId is
+ * done. No further releases are attempted after one fails.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ */
+int32_t DEV_SM_RdcReleaseWait(uint32_t rdcId);
+
 /** @} */
 
 /* Include SM device API */
@@ -94,6 +94,7 @@ static bool s_tmpsnsOwn[DEV_SM_NUM_SENSOR];
 static bool s_tmpsnsEnb[DEV_SM_NUM_SENSOR];
 static uint8_t s_tmpsnsDir[DEV_SM_NUM_SENSOR];
 static uint32_t s_thresholdEnb[DEV_SM_NUM_SENSOR];
+static uint32_t s_thresholdArm[DEV_SM_NUM_SENSOR];
 static int16_t s_thresholdVal[DEV_SM_NUM_SENSOR][SM_NUM_THRESHOLDS];
 static uint8_t s_thresholdMode[DEV_SM_NUM_SENSOR][SM_NUM_THRESHOLDS];
 
@@ -185,6 +186,7 @@ int32_t DEV_SM_SensorConfigStart(uint32_t sensorId, bool secAccess)
 
         /* Init NS section of sensor */
         TMPSNS_InitNs(base, &config);
+        s_thresholdArm[sensorId] = 0U;
 
         /* Loop over thresholds */
         for (uint8_t threshold = 0U; threshold < SM_NUM_THRESHOLDS;
@@ -541,17 +543,22 @@ void DEV_SM_SensorHandler(uint32_t idx, uint8_t threshold)
 /*--------------------------------------------------------------------------*/
 /* Sensor timer tick                                                        */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_SensorTick(uint32_t msec)
+uint32_t DEV_SM_SensorTick(uint32_t msec)
 {
+    uint32_t next = DEV_SM_TICK_IDLE;
+
     /* Loop over sensors */
     for (uint32_t sensorId = 0U; sensorId < DEV_SM_NUM_SENSOR; sensorId++)
     {
-        /* Check if PD is on */
-        if (SRC_MixIsPwrReady(s_tmpsns[sensorId].pd))
+        uint32_t pend = s_thresholdEnb[sensorId]
+            & ~s_thresholdArm[sensorId];
+
+        /* Check if thresholds waiting to be enabled and PD is on */
+        if ((pend != 0U) && SRC_MixIsPwrReady(s_tmpsns[sensorId].pd))
         {
             TMPSNS_Type *base = s_tmpsnsBases[s_tmpsns[sensorId].idx];
             uint32_t filt = TMPSNS_GetFilterBusy(base);
-            uint32_t mask = s_thresholdEnb[sensorId] & ~filt;
+            uint32_t mask = pend & ~filt;
 
             /* Loop over thresholds */
             for (uint8_t threshold = 0U; threshold < SM_NUM_THRESHOLDS;
@@ -568,8 +575,18 @@ void DEV_SM_SensorTick(uint32_t msec)
                             << threshold);
                 }
             }
+            s_thresholdArm[sensorId] |= mask;
+
+            /* Retry next tick if filter busy */
+            if (mask != pend)
+            {
+                next = BOARD_TICK_PERIOD_MSEC;
+            }
         }
     }
+
+    /* Return next deadline */
+    return next;
 }
 
 /*==========================================================================*/
@@ -602,6 +619,7 @@ static int32_t DEV_SM_SensorThresholdSet(uint32_t sensorId, uint8_t threshold,
         if (eventControl == DEV_SM_SENSOR_TP_NONE)
         {
             s_thresholdEnb[sensorId] &= ~mask;
+            s_thresholdArm[sensorId] &= ~mask;
 
             /* Disable interrupt */
             TMPSNS_DisableInterrupts(base, ((uint32_t) kTMPSNS_Thr0IE)
@@ -647,6 +665,8 @@ static int32_t DEV_SM_SensorThresholdSet(uint32_t sensorId, uint8_t threshold,
 
                 /* Enable interrupt (delayed) */
                 s_thresholdEnb[sensorId] |= mask;
+                s_thresholdArm[sensorId] &= ~mask;
+                DEV_SM_TickUpdate();
             }
         }
     }
@@ -83,11 +83,15 @@
 /*!
  * Sensor timer tick.
  *
- * @param[in]     msec          Period in milliseconds
+ * @param[in]     msec          Elapsed time in milliseconds
  *
- * This function is called periodically by a timer.
+ * This function is called by the tick timer. It enables threshold
+ * interrupts deferred until the sensor filter is clear.
+ *
+ * @return Returns the time until service is next required in
+ *         milliseconds (::DEV_SM_TICK_IDLE = no deadline).
  */
-void DEV_SM_SensorTick(uint32_t msec);
+uint32_t DEV_SM_SensorTick(uint32_t msec);
 
 /** @} */
 
@@ -41,6 +41,7 @@
 #include "sm.h"
 #include "dev_sm.h"
 #include "lmm.h"
+#include "binlog.h"
 #include "fsl_fract_pll.h"
 #include "fsl_power.h"
 #include "fsl_reset.h"
@@ -50,8 +51,48 @@
 
 #define DEV_SM_NUM_SLEEP_ROOTS  3U
 
+/*! Period of fallback poll for CPU mode changes (msec) */
+#define DEV_SM_CPU_POLL_MSEC    100U
+
+/*! Number of tick period polls following a CPU event */
+#define DEV_SM_CPU_EVENT_POLLS  10U
+
+/*! Idle must exceed this multiple of sleep entry+exit latency */
+#define DEV_SM_SLEEP_BREAKEVEN  2U
+
+/*! Weight (shift) of new samples in sleep statistics averages */
+#define DEV_SM_SLEEP_AVG_SHIFT  2U
+
+/*! Update running average with a new sample */
+#define DEV_SM_SLEEP_AVG(AVG, X)  (((AVG) - ((AVG) >> DEV_SM_SLEEP_AVG_SHIFT)) \
+    + ((X) >> DEV_SM_SLEEP_AVG_SHIFT))
+
 /* Local types */
 
+/*!
+ * System sleep plan
+ *
+ * Sleep entry decisions derived from agent CPU configuration. Cached
+ * across system sleep cycles until invalidated.
+ */
+typedef struct
+{
+    /*! Saved GPC wake masks of agent CPUs */
+    uint32_t cpuWakeMask[CPU_NUM_IDX][GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
+
+    /*! System-level wake masks */
+    uint32_t sysWakeMask[GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
+
+    /*! NOCMIX LPM dependency */
+    uint32_t lpmSettingNoc;
+
+    /*! WAKEUPMIX LPM dependency */
+    uint32_t lpmSettingWakeup;
+
+    /*! Plan matches current CPU configuration */
+    bool valid;
+} dev_sm_sys_sleep_plan_t;
+
 #ifdef DEV_SM_MSG_PROF_CNT
 /*!
  * Message profile current buffer
@@ -69,6 +110,10 @@ typedef struct
 static uint32_t s_sysSleepMode = 0U;
 static uint32_t s_sysSleepFlags = 0U;
 static dev_sm_rst_rec_t s_shutdownRecord = { 0 };
+static uint32_t s_cpuEventPolls = 0U;
+static uint32_t s_sysSleepDepth = DEV_SM_SLEEP_DEPTH_SUSPEND;
+static uint64_t s_sysIdleUsec = 0ULL;
+static dev_sm_sys_sleep_plan_t s_sysSleepPlan = { 0 };
 #ifdef DEV_SM_MSG_PROF_CNT
 static dev_sm_sys_msg_cur_t s_curMsgRecord = { 0 };
 #endif
@@ -76,6 +121,11 @@ static dev_sm_sys_msg_cur_t s_curMsgRecord = { 0 };
 /* Local functions */
 
 static void DEV_SM_ClockSourceBypass(bool bypass, bool preserve);
+static void DEV_SM_SystemSleepPlanBuild(void);
+static uint32_t DEV_SM_SystemSleepDepthSelect(void);
+static void DEV_SM_SystemSleepStatUpdate(uint32_t depth, uint32_t wakeSource,
+    uint32_t idleUsec);
+static void DEV_SM_SystemSleepHistAdd(uint32_t *hist, uint32_t usec);
 
 /*--------------------------------------------------------------------------*/
 /* Initialize system functions                                              */
@@ -149,6 +199,9 @@ int32_t DEV_SM_SystemInit(void)
             CCM_LPCG_DIRECT_ON_MASK;
     }
 
+    /* No idle history, sleep governor starts with full SUSPEND */
+    g_syslog.sysSleepStat.predictUsec = UINT32_MAX;
+
     /* Power down DDRMIX if uninitialized by OEI */
     if (!CLOCK_SourceGetEnable(CLOCK_SRC_DRAMPLL_VCO))
     {
@@ -181,6 +234,9 @@ int32_t DEV_SM_SystemReset(void)
     // coverity[misra_c_2012_rule_14_3_violation]
     if (status == SM_ERR_SUCCESS)
     {
+        /* Send pending console output */
+        BOARD_DebugConsoleFlush();
+
         /* Request warm reset */
         RST_SystemRequestReset();
     }
@@ -209,6 +265,9 @@ int32_t DEV_SM_SystemStageReset(uint32_t stage, uint32_t container)
 
     if (status == SM_ERR_SUCCESS)
     {
+        /* Send pending console output */
+        BOARD_DebugConsoleFlush();
+
         /* Request warm reset */
         RST_SystemRequestReset();
     }
@@ -229,6 +288,9 @@ int32_t DEV_SM_SystemShutdown(void)
     // coverity[misra_c_2012_rule_14_3_violation]
     if (status == SM_ERR_SUCCESS)
     {
+        /* Send pending console output */
+        BOARD_DebugConsoleFlush();
+
         /* Request shutdown */
         PWR_SystemPowerDown();
     }
@@ -242,13 +304,11 @@ int32_t DEV_SM_SystemShutdown(void)
 /*--------------------------------------------------------------------------*/
 void DEV_SM_SystemShutdownRecSet(dev_sm_rst_rec_t shutdownRec)
 {
-#ifdef DEBUG
-    printf("DEBUG: DEV_SM_SystemShutdownRecSet: reason=%u errId=%u origin=LM%u valid=%d reset=%d\n",
-        shutdownRec.reason, shutdownRec.errId, shutdownRec.origin,
-        shutdownRec.valid, shutdownRec.reset);
-#endif
     int32_t status = SM_ERR_SUCCESS;
 
+    BINLOG3(BINLOG_ID_SHUTDOWN_REC, "shutdown reason=%u, errId=%u, LM%u",
+        shutdownRec.reason, shutdownRec.errId, shutdownRec.origin);
+
     SM_TEST_MODE_ERR(SM_TEST_MODE_DEV_LVL1, SM_ERR_TEST)
 
     // coverity[misra_c_2012_rule_14_3_violation]
@@ -441,8 +501,6 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
 
     int32_t status = SM_ERR_SUCCESS;
     uint32_t s_clkRootCtrl[DEV_SM_NUM_SLEEP_ROOTS];
-    uint32_t cpuWakeMask[CPU_NUM_IDX][GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
-    uint32_t sysWakeMask[GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
     uint32_t nvicISER[GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
 
     /* Capture start of sleep entry */
@@ -456,6 +514,16 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
     g_syslog.sysSleepRecord.sysSleepMode = s_sysSleepMode;
     g_syslog.sysSleepRecord.sysSleepFlags = s_sysSleepFlags;
 
+    /* Capture system sleep depth */
+    g_syslog.sysSleepRecord.sleepDepth = s_sysSleepDepth;
+    g_syslog.sysSleepRecord.sleepUsec = 0U;
+    g_syslog.sysSleepRecord.ddrIdleUsec = 0U;
+    g_syslog.sysSleepRecord.ddrLpUsec = 0U;
+    g_syslog.sysSleepRecord.ddrRstUsec = 0U;
+    g_syslog.sysSleepRecord.ddrPhyUsec = 0U;
+    g_syslog.sysSleepRecord.ddrCtrlUsec = 0U;
+    bool deepSleep = (s_sysSleepDepth == DEV_SM_SLEEP_DEPTH_SUSPEND);
+
     /* Capture power status of MIXes */
     g_syslog.sysSleepRecord.mixPwrStat = 0U;
     for (uint32_t mixIdx = 0U; mixIdx < PWR_NUM_MIX_SLICE; mixIdx++)
@@ -488,88 +556,26 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
         }
     }
 
-    /* Initialize wake masks */
-    for (uint32_t wakeIdx = 0;
-        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
-        wakeIdx++)
+    /* Rebuild sleep plan if CPU configuration changed */
+    if (!s_sysSleepPlan.valid)
     {
-        sysWakeMask[wakeIdx] = 0xFFFFFFFFU;
-
-        for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
-        {
-            cpuWakeMask[cpuIdx][wakeIdx] = 0xFFFFFFFFU;
-        }
+        DEV_SM_SystemSleepPlanBuild();
     }
 
-    /* Initialize NOC/WAKEUP MIX dependencies */
-    uint32_t lpmSettingNoc = CPU_PD_LPM_ON_NEVER;
-    uint32_t lpmSettingWakeup = CPU_PD_LPM_ON_NEVER;
+    /* NOC/WAKEUP MIX dependencies */
+    uint32_t lpmSettingNoc = s_sysSleepPlan.lpmSettingNoc;
+    uint32_t lpmSettingWakeup = s_sysSleepPlan.lpmSettingWakeup;
 
-    /* Scan CPUs, update GPC wake masks, assess NOC/WAKEUP MIX dependencies */
+    /* Mask GPC wakeups of agent CPUs */
     for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
     {
         if (cpuIdx != CPU_IDX_M33P)
         {
-            /* Check if sleep is forced for the CPU */
-            bool sleepForce;
-            if (CPU_SleepForceGet(cpuIdx, &sleepForce))
+            for (uint32_t wakeIdx = 0U;
+                wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                wakeIdx++)
             {
-                /* If sleep is not forced, manage GPC masks */
-                if (!sleepForce)
-                {
-                    /* IRQs enabled at NVIC level become GPC wake sources */
-                    for (uint32_t wakeIdx = 0;
-                        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
-                        wakeIdx++)
-                    {
-                        uint32_t wakeVal;
-                        if (CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal))
-                        {
-                            cpuWakeMask[cpuIdx][wakeIdx] = wakeVal;
-                            sysWakeMask[wakeIdx] &= wakeVal;
-                            (void) CPU_IrqWakeSet(cpuIdx, wakeIdx,
-                                0xFFFFFFFFU);
-                        }
-                    }
-
-                    /* Update NOCMIX dependency */
-                    uint32_t lpmSetting;
-                    if (SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_NOC, cpuIdx,
-                        &lpmSetting))
-                    {
-                        if (lpmSetting > lpmSettingNoc)
-                        {
-                            lpmSettingNoc = lpmSetting;
-                        }
-                    }
-
-                    /* Update WAKEUPMIX dependency */
-                    if (SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_WAKEUP, cpuIdx,
-                        &lpmSetting))
-                    {
-                        if (lpmSetting > lpmSettingWakeup)
-                        {
-                            lpmSettingWakeup = lpmSetting;
-                        }
-                    }
-                }
-                /* Disable GPC wakeups for CPUs forced to sleep */
-                else
-                {
-                    /* IRQs enabled at NVIC level become GPC wake sources */
-                    for (uint32_t wakeIdx = 0;
-                        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
-                        wakeIdx++)
-                    {
-                        uint32_t wakeVal;
-                        if (CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal))
-                        {
-                            cpuWakeMask[cpuIdx][wakeIdx] = wakeVal;
-                            (void) CPU_IrqWakeSet(cpuIdx, wakeIdx,
-                                0xFFFFFFFFU);
-                        }
-                    }
-                }
+                (void) CPU_IrqWakeSet(cpuIdx, wakeIdx, 0xFFFFFFFFU);
             }
         }
     }
@@ -604,23 +610,27 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             }
 
             bool ddrInRetention = false;
-            /* Attempt to place DDR into retention */
-            if (DEV_SM_MemDdrRetentionEnter() == SM_ERR_SUCCESS)
+            /* Attempt to place DDR into retention (full SUSPEND only) */
+            if (deepSleep)
             {
-                /* Set flag to indicate DDR retention is active */
-                ddrInRetention = true;
-
-                /* Power down DDRMIX */
-                if (DEV_SM_PowerStateSet(DEV_SM_PD_DDR, DEV_SM_POWER_STATE_OFF)
-                    == SM_ERR_SUCCESS)
+                if (DEV_SM_MemDdrRetentionEnter() == SM_ERR_SUCCESS)
                 {
-                    g_syslog.sysSleepRecord.mixPwrStat &=
-                        (~(1UL << PWR_MIX_SLICE_IDX_DDR));
+                    /* Set flag to indicate DDR retention is active */
+                    ddrInRetention = true;
+
+                    /* Power down DDRMIX */
+                    if (DEV_SM_PowerStateSet(DEV_SM_PD_DDR,
+                        DEV_SM_POWER_STATE_OFF) == SM_ERR_SUCCESS)
+                    {
+                        g_syslog.sysSleepRecord.mixPwrStat &=
+                            (~(1UL << PWR_MIX_SLICE_IDX_DDR));
+                    }
                 }
             }
 
             /* If NOCMIX powered down during SUSPEND, force power down */
-            if (lpmSettingNoc <= sleepMode)
+            bool nocMixOff = deepSleep && (lpmSettingNoc <= sleepMode);
+            if (nocMixOff)
             {
                 if (DEV_SM_PowerStateSet(DEV_SM_PD_NOC, DEV_SM_POWER_STATE_OFF)
                     == SM_ERR_SUCCESS)
@@ -641,7 +651,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             uint32_t savedWakeupMixPerf;
 
             /* If WAKEUPMIX powered down during SUSPEND, force power down */
-            if ((lpmSettingWakeup <= sleepMode) &&
+            if (deepSleep && (lpmSettingWakeup <= sleepMode) &&
                 ((CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk) == 0x0U))
             {
                 /* Keep WAKEUPMIX powered at parked level during LP compute */
@@ -679,6 +689,12 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             uint32_t lpHs2Ele = BLK_CTRL_S_AONMIX->LP_HANDSHAKE2_ELE;
             BLK_CTRL_S_AONMIX->LP_HANDSHAKE2_ELE = 0U;
 
+            /* Tick timer is not a wake source for full SUSPEND */
+            if (deepSleep)
+            {
+                DEV_SM_TickEnable(false);
+            }
+
             /* Configure SM GPC_CTRL and NVIC for system-level wake events */
             for (uint32_t wakeIdx = 0;
                 wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
@@ -692,7 +708,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
                 NVIC->ICPR[wakeIdx] = 0xFFFFFFFFU & maskVal;
 
                 /* Add system-level wake events */
-                maskVal &= sysWakeMask[wakeIdx];
+                maskVal &= s_sysSleepPlan.sysWakeMask[wakeIdx];
 
                 /* Update GPC wake mask */
                 (void) CPU_IrqWakeSet(CPU_IDX_M33P, wakeIdx, maskVal);
@@ -715,10 +731,10 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
                 perfLevelSleep = DEV_SM_PERF_LVL_ODV;
             }
 
-            /* System remains active during sleep based on performance level
-             * and OSC24M configuration.
+            /* System remains active during sleep based on sleep depth,
+             * performance level, and OSC24M configuration.
              */
-            bool activeSleep = (perfLevelSleep != DEV_SM_PERF_LVL_PRK) ||
+            bool activeSleep = !deepSleep || (perfLevelSleep != DEV_SM_PERF_LVL_PRK) ||
                 ((s_sysSleepFlags & DEV_SM_SSF_OSC24M_ACTIVE_MASK) != 0U) ||
                 lpComputeActive;
 
@@ -786,8 +802,12 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
                 }
             }
 
-            /* Check if sleep performance level allows SYSPLL disable */
-            if (perfLevelSleep == DEV_SM_PERF_LVL_PRK)
+            /* Check if sleep depth and performance level allow SYSPLL
+             * disable
+             */
+            bool sysPllOff = deepSleep &&
+                (perfLevelSleep == DEV_SM_PERF_LVL_PRK);
+            if (sysPllOff)
             {
                 /* Power down SYSPLL clock nodes */
                 uint32_t clkSrcIdx = CLOCK_SRC_SYSPLL1_PFD2_DIV2;
@@ -855,6 +875,15 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             /* Capture start of sleep exit */
             sleepExitStart = DEV_SM_Usec64Get();
 
+            /* Capture sleep residency */
+            uint64_t sleepStart = sleepEntryStart
+                + g_syslog.sysSleepRecord.sleepEntryUsec;
+            if (sleepExitStart >= sleepStart)
+            {
+                g_syslog.sysSleepRecord.sleepUsec =
+                    UINT64_L(sleepExitStart - sleepStart);
+            }
+
             /* Capture wake source */
             g_syslog.sysSleepRecord.wakeSource =
                 (SCB->ICSR & SCB_ICSR_VECTPENDING_Msk)
@@ -866,8 +895,8 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             /* Board-level sleep exit */
             BOARD_SystemSleepExit(s_sysSleepMode, s_sysSleepFlags);
 
-            /* Check if sleep performance level requires SYSPLL enable */
-            if (perfLevelSleep == DEV_SM_PERF_LVL_PRK)
+            /* Check if SYSPLL requires enable */
+            if (sysPllOff)
             {
                 /* Power up SYSPLL clock nodes */
                 uint32_t clkSrcIdx = CLOCK_SRC_SYSPLL1_VCO;
@@ -930,7 +959,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             }
 
             /* If NOCMIX powered down during SUSPEND, force power up */
-            if ((status == SM_ERR_SUCCESS) && (lpmSettingNoc <= sleepMode))
+            if ((status == SM_ERR_SUCCESS) && nocMixOff)
             {
                 status = DEV_SM_PowerStateSet(DEV_SM_PD_NOC,
                     DEV_SM_POWER_STATE_ON);
@@ -962,6 +991,12 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
                 NVIC->ISER[wakeIdx] = nvicISER[wakeIdx];
             }
 
+            /* Resume tick timer */
+            if (deepSleep)
+            {
+                DEV_SM_TickEnable(true);
+            }
+
             /* Enable sensor */
             (void) DEV_SM_SensorPowerUp(DEV_SM_SENSOR_TEMP_ANA);
 
@@ -999,7 +1034,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
                 wakeIdx++)
             {
                 (void) CPU_IrqWakeSet(cpuIdx, wakeIdx,
-                    cpuWakeMask[cpuIdx][wakeIdx]);
+                    s_sysSleepPlan.cpuWakeMask[cpuIdx][wakeIdx]);
             }
         }
     }
@@ -1037,7 +1072,39 @@ int32_t DEV_SM_SystemIdle(void)
         {
             if (sysSleepStat == CPU_SLEEP_MODE_SUSPEND)
             {
-                status = DEV_SM_SystemSleep(CPU_SLEEP_MODE_SUSPEND);
+                /* Select system sleep depth based on predicted idle */
+                s_sysSleepDepth = DEV_SM_SystemSleepDepthSelect();
+
+                if (s_sysSleepDepth != DEV_SM_SLEEP_DEPTH_WFI)
+                {
+                    status = DEV_SM_SystemSleep(CPU_SLEEP_MODE_SUSPEND);
+
+                    /* Update sleep statistics */
+                    DEV_SM_SystemSleepStatUpdate(s_sysSleepDepth,
+                        g_syslog.sysSleepRecord.wakeSource,
+                        g_syslog.sysSleepRecord.sleepUsec);
+                }
+                /* Short idle predicted, stay in RUN mode and enter WFI */
+                else
+                {
+                    uint64_t idleStart = DEV_SM_Usec64Get();
+
+                    (void) CPU_SleepModeSet(CPU_IDX_M33P, CPU_SLEEP_MODE_RUN);
+                    __DSB();
+                    // coverity[misra_c_2012_rule_1_2_violation]
+                    __WFI();
+                    __ISB();
+
+                    /* Update sleep statistics */
+                    DEV_SM_SystemSleepStatUpdate(DEV_SM_SLEEP_DEPTH_WFI,
+                        (SCB->ICSR & SCB_ICSR_VECTPENDING_Msk)
+                        >> SCB_ICSR_VECTPENDING_Pos,
+                        UINT64_L(MIN(DEV_SM_Usec64Get() - idleStart,
+                        U64(UINT32_MAX))));
+                }
+
+                /* Restore default depth */
+                s_sysSleepDepth = DEV_SM_SLEEP_DEPTH_SUSPEND;
             }
             /* Otherwise stay in RUN mode and enter WFI */
             else
@@ -1068,15 +1135,273 @@ int32_t DEV_SM_SystemIdle(void)
 /*--------------------------------------------------------------------------*/
 /* System timer tick                                                        */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_SystemTick(uint32_t msec)
+uint32_t DEV_SM_SystemTick(uint32_t msec)
 {
+    uint32_t next = DEV_SM_CPU_POLL_MSEC;
+
     /* Poll for CPU state changes */
     LMM_SystemCpuModeChanged(DEV_SM_CPU_M7P);
     LMM_SystemCpuModeChanged(DEV_SM_CPU_A55P);
+
+    /* Poll at the tick period for a short time after a CPU event */
+    if (s_cpuEventPolls > 0U)
+    {
+        s_cpuEventPolls--;
+        next = BOARD_TICK_PERIOD_MSEC;
+    }
+
+    /* Return next deadline */
+    return next;
+}
+
+/*--------------------------------------------------------------------------*/
+/* CPU event notification                                                   */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_SystemCpuEvent(void)
+{
+    /* Poll CPU modes now and for the next few tick periods */
+    s_cpuEventPolls = DEV_SM_CPU_EVENT_POLLS;
+    DEV_SM_TickUpdate();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Invalidate system sleep plan                                             */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_SystemSleepPlanInvalidate(void)
+{
+    s_sysSleepPlan.valid = false;
 }
 
 /*==========================================================================*/
 
+/*--------------------------------------------------------------------------*/
+/* Select system sleep depth                                                */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_SystemSleepDepthSelect(void)
+{
+    const dev_sm_sys_sleep_stat_t *stat = &g_syslog.sysSleepStat;
+    uint32_t depth = DEV_SM_SLEEP_DEPTH_SUSPEND;
+
+    /* Check if system sleep mode flag allows sleep governor */
+    if ((s_sysSleepFlags & DEV_SM_SSF_GOV_INACTIVE_MASK) == 0U)
+    {
+        /* Current idle period may already exceed prediction */
+        uint32_t predictUsec = MAX(stat->predictUsec,
+            UINT64_L(MIN(s_sysIdleUsec, U64(UINT32_MAX))));
+
+        /* Idle cannot extend beyond the next RTC alarm */
+        predictUsec = MIN(predictUsec, DEV_SM_BbmRtcAlarmUsecGet());
+
+        /* Find deepest depth whose entry/exit cost is recovered */
+        bool found = false;
+        while (!found && (depth > DEV_SM_SLEEP_DEPTH_WFI))
+        {
+            const dev_sm_sys_sleep_depth_stat_t *depthStat =
+                &stat->depth[depth];
+            uint64_t costUsec = (U64(depthStat->entryUsec)
+                + U64(depthStat->exitUsec)) * U64(DEV_SM_SLEEP_BREAKEVEN);
+
+            if (U64(predictUsec) >= costUsec)
+            {
+                found = true;
+            }
+            else
+            {
+                depth--;
+            }
+        }
+    }
+
+    /* Return depth */
+    return depth;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update system sleep statistics                                           */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SystemSleepStatUpdate(uint32_t depth, uint32_t wakeSource,
+    uint32_t idleUsec)
+{
+    dev_sm_sys_sleep_stat_t *stat = &g_syslog.sysSleepStat;
+
+    /* Check if system idled */
+    if (wakeSource != 0U)
+    {
+        dev_sm_sys_sleep_depth_stat_t *depthStat = &stat->depth[depth];
+
+        /* Check the value doesn't wrap */
+        if (depthStat->cnt < UINT32_MAX)
+        {
+            depthStat->cnt++;
+        }
+
+        /* Track entry/exit latency of system sleep */
+        if (depth != DEV_SM_SLEEP_DEPTH_WFI)
+        {
+            uint32_t entryUsec = g_syslog.sysSleepRecord.sleepEntryUsec;
+            uint32_t exitUsec = g_syslog.sysSleepRecord.sleepExitUsec;
+
+            /* Seed averages with first sample */
+            if (depthStat->cnt == 1U)
+            {
+                depthStat->entryUsec = entryUsec;
+                depthStat->exitUsec = exitUsec;
+            }
+            else
+            {
+                depthStat->entryUsec = DEV_SM_SLEEP_AVG(depthStat->entryUsec,
+                    entryUsec);
+                depthStat->exitUsec = DEV_SM_SLEEP_AVG(depthStat->exitUsec,
+                    exitUsec);
+            }
+
+            /* Update histograms */
+            DEV_SM_SystemSleepHistAdd(depthStat->entryHist, entryUsec);
+            DEV_SM_SystemSleepHistAdd(depthStat->exitHist, exitUsec);
+        }
+
+        /* Accumulate idle time */
+        s_sysIdleUsec += U64(idleUsec);
+
+        /* Tick timer wakes do not end the idle period */
+        if (wakeSource != (((uint32_t) DEV_SM_TICK_IRQn) + 16U))
+        {
+            uint32_t sampleUsec = UINT64_L(MIN(s_sysIdleUsec,
+                U64(UINT32_MAX)));
+
+            /* Update idle prediction, seeded with first sample */
+            if (stat->predictUsec == UINT32_MAX)
+            {
+                stat->predictUsec = sampleUsec;
+            }
+            else
+            {
+                stat->predictUsec = DEV_SM_SLEEP_AVG(stat->predictUsec,
+                    sampleUsec);
+            }
+
+            /* Start new idle period */
+            stat->idleUsec = sampleUsec;
+            s_sysIdleUsec = 0ULL;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Add sample to latency histogram                                          */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SystemSleepHistAdd(uint32_t *hist, uint32_t usec)
+{
+    uint32_t bin = 0U;
+    uint32_t limit = 16U;
+
+    /* Find bin, bins are powers of 4 */
+    while ((bin < (DEV_SM_NUM_SLEEP_HIST - 1U)) && (usec >= limit))
+    {
+        bin++;
+        limit <<= 2U;
+    }
+
+    /* Check the value doesn't wrap */
+    if (hist[bin] < UINT32_MAX)
+    {
+        hist[bin]++;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Build system sleep plan                                                  */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SystemSleepPlanBuild(void)
+{
+    dev_sm_sys_sleep_plan_t *plan = &s_sysSleepPlan;
+
+    /* Initialize wake masks */
+    for (uint32_t wakeIdx = 0;
+        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+        wakeIdx++)
+    {
+        plan->sysWakeMask[wakeIdx] = 0xFFFFFFFFU;
+
+        for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
+        {
+            plan->cpuWakeMask[cpuIdx][wakeIdx] = 0xFFFFFFFFU;
+        }
+    }
+
+    /* Initialize NOC/WAKEUP MIX dependencies */
+    plan->lpmSettingNoc = CPU_PD_LPM_ON_NEVER;
+    plan->lpmSettingWakeup = CPU_PD_LPM_ON_NEVER;
+
+    /* Scan CPUs, save GPC wake masks, assess NOC/WAKEUP MIX dependencies */
+    for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
+    {
+        if (cpuIdx != CPU_IDX_M33P)
+        {
+            /* Check if sleep is forced for the CPU */
+            bool sleepForce;
+            if (CPU_SleepForceGet(cpuIdx, &sleepForce))
+            {
+                /* If sleep is not forced, manage GPC masks */
+                if (!sleepForce)
+                {
+                    /* IRQs enabled at NVIC level become GPC wake sources */
+                    for (uint32_t wakeIdx = 0;
+                        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                        wakeIdx++)
+                    {
+                        uint32_t wakeVal;
+                        if (CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal))
+                        {
+                            plan->cpuWakeMask[cpuIdx][wakeIdx] = wakeVal;
+                            plan->sysWakeMask[wakeIdx] &= wakeVal;
+                        }
+                    }
+
+                    /* Update NOCMIX dependency */
+                    uint32_t lpmSetting;
+                    if (SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_NOC, cpuIdx,
+                        &lpmSetting))
+                    {
+                        if (lpmSetting > plan->lpmSettingNoc)
+                        {
+                            plan->lpmSettingNoc = lpmSetting;
+                        }
+                    }
+
+                    /* Update WAKEUPMIX dependency */
+                    if (SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_WAKEUP, cpuIdx,
+                        &lpmSetting))
+                    {
+                        if (lpmSetting > plan->lpmSettingWakeup)
+                        {
+                            plan->lpmSettingWakeup = lpmSetting;
+                        }
+                    }
+                }
+                /* CPUs forced to sleep are not system wake sources */
+                else
+                {
+                    /* Save GPC wake masks for restore */
+                    for (uint32_t wakeIdx = 0;
+                        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                        wakeIdx++)
+                    {
+                        uint32_t wakeVal;
+                        if (CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal))
+                        {
+                            plan->cpuWakeMask[cpuIdx][wakeIdx] = wakeVal;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* Plan valid until CPU configuration changes */
+    plan->valid = true;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Configure bypass for clock sources                                       */
 /*--------------------------------------------------------------------------*/
@@ -1115,7 +1440,7 @@ static void DEV_SM_ClockSourceBypass(bool bypass, bool preserve)
 /*--------------------------------------------------------------------------*/
 /* Message profile start notification                                       */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_SystemMsgProfStart(uint32_t mu)
+void DEV_SM_SystemMsgProfStart(uint32_t scmiChannel)
 {
     /* Capture timestamp of message start */
     s_curMsgRecord.msgStartUsec = DEV_SM_Usec64Get();
@@ -1137,7 +1462,7 @@ void DEV_SM_SystemMsgProfDescribe(uint32_t scmiChannel, uint32_t chanType,
 /*--------------------------------------------------------------------------*/
 /* Message profile end notification                                         */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_SystemMsgProfEnd(uint32_t mu)
+void DEV_SM_SystemMsgProfEnd(uint32_t scmiChannel)
 {
     /* Capture timestamp of message end */
     s_curMsgRecord.msgEndUsec = DEV_SM_Usec64Get();
@@ -190,10 +190,10 @@ int32_t DEV_SM_PowerDownPre(uint32_t domainId)
 static void DEV_SM_Tick(union sigval timer_data)
 {
     /* Call system tick */
-    DEV_SM_SystemTick(1000U);
+    (void) DEV_SM_SystemTick(1000U);
 
     /* Call board tick */
-    BRD_SM_TimerTick(1000U);
+    (void) BRD_SM_TimerTick(1000U);
 
     /* Tick BBM */
     DEV_SM_BbmHandler();
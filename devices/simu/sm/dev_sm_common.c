@@ -41,6 +41,8 @@
 #include "sm.h"
 #include "dev_sm.h"
 #include "lmm.h"
+#include "rpc_scmi.h"
+#include "timer.h"
 #include <sys/time.h>
 
 /* Local defines */
@@ -49,6 +51,9 @@
 
 /* Local variables */
 
+static bool s_schedHold = false;
+static bool s_schedLatched = false;
+
 /* Global variables */
 
 dev_sm_syslog_t g_syslog;
@@ -221,6 +226,59 @@ void SWI_Trigger(void)
     LMM_Handler();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Trigger SCMI scheduler software interrupt                                */
+/*--------------------------------------------------------------------------*/
+void SWI_SchedTrigger(void)
+{
+    static bool s_schedActive = false;
+
+    /* Latch if held, else run scheduler unless running (nested ring) */
+    if (s_schedHold)
+    {
+        s_schedLatched = true;
+    }
+    else if (!s_schedActive)
+    {
+        bool more = true;
+
+        /* Also advance power transitions and run deferred work */
+        s_schedActive = true;
+        while (more)
+        {
+            more = RPC_SCMI_Schedule();
+            if (DEV_SM_PowerPoll())
+            {
+                more = true;
+            }
+            if (TIMER_WorkRun())
+            {
+                more = true;
+            }
+        }
+        s_schedActive = false;
+    }
+    else
+    {
+        ; /* Intentional empty else */
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Hold SCMI scheduler software interrupt                                   */
+/*--------------------------------------------------------------------------*/
+void SWI_SchedHold(bool hold)
+{
+    s_schedHold = hold;
+
+    /* Run latched trigger on release */
+    if (!hold && s_schedLatched)
+    {
+        s_schedLatched = false;
+        SWI_SchedTrigger();
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get length of a string                                                   */
 /*--------------------------------------------------------------------------*/
@@ -111,6 +111,22 @@ extern dev_sm_syslog_t g_syslog;
  */
 void SWI_Trigger(void);
 
+/*!
+ * Trigger SCMI scheduler software interrupt.
+ */
+void SWI_SchedTrigger(void);
+
+/*!
+ * Hold SCMI scheduler software interrupt.
+ *
+ * @param[in]     hold      True to hold, false to release
+ *
+ * Models a masked interrupt. While held, triggers are latched. Releasing
+ * runs the scheduler if a trigger was latched. Used to dispatch several
+ * doorbells before the scheduler ranks them.
+ */
+void SWI_SchedHold(bool hold);
+
 /** @} */
 
 /* Include SM device API */
@@ -70,6 +70,22 @@ int32_t DEV_SM_FuseInfoGet(uint32_t fuseWord, uint32_t *addr)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Init fuses                                                               */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_FuseInit(void)
+{
+}
+
+/*--------------------------------------------------------------------------*/
+/* Write a fuse word                                                        */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_FuseWrite(uint32_t fuseWord, uint32_t fuseVal)
+{
+    /* Return result */
+    return SM_ERR_NOT_SUPPORTED;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Read a fuse field                                                        */
 /*--------------------------------------------------------------------------*/
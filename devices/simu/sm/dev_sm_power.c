@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -48,6 +49,15 @@
 /* Local variables */
 
 static uint8_t s_powerState[DEV_SM_NUM_POWER];
+static bool s_powerBusy[DEV_SM_NUM_POWER];
+static uint8_t s_powerBusyState[DEV_SM_NUM_POWER];
+static bool s_powerNext[DEV_SM_NUM_POWER];
+static uint8_t s_powerNextState[DEV_SM_NUM_POWER];
+static bool s_powerPollHold = false;
+
+/* Local functions */
+
+static int32_t DEV_SM_PowerTransComplete(uint32_t domainId);
 
 /*--------------------------------------------------------------------------*/
 /* Return power domain name                                                 */
@@ -128,31 +138,126 @@ int32_t DEV_SM_PowerStateNameGet(uint32_t powerState, string *stateNameAddr,
 /* Set power domain state                                                   */
 /*--------------------------------------------------------------------------*/
 int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
+{
+    bool pending = false;
+
+    /* Start transition */
+    int32_t status = DEV_SM_PowerStateSetAsync(domainId, powerState,
+        &pending);
+
+    /* Complete this domain, even if polling is held */
+    if (pending)
+    {
+        status = DEV_SM_PowerTransComplete(domainId);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start setting power domain state                                         */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PowerStateSetAsync(uint32_t domainId, uint8_t powerState,
+    bool *pending)
 {
     int32_t status = SM_ERR_SUCCESS;
     bool pdDisabled = DEV_SM_FusePdDisabled(domainId);
 
+    *pending = false;
+
     if (pdDisabled || (domainId >= DEV_SM_NUM_POWER))
     {
         status = SM_ERR_NOT_FOUND;
     }
+    /* Transition already in flight for this domain? */
+    else if (s_powerBusy[domainId])
+    {
+        /* Queue behind it, other domains are independent */
+        s_powerNextState[domainId] = powerState;
+        s_powerNext[domainId] = (powerState != s_powerBusyState[domainId]);
+        *pending = true;
+    }
     else
     {
-        /* Handle post power on loads */
+        /* Model power up as in flight until the next poll */
         if ((s_powerState[domainId] == DEV_SM_POWER_STATE_OFF)
             && (powerState != DEV_SM_POWER_STATE_OFF))
         {
-            status = DEV_SM_PowerUpPost(domainId);
+            s_powerBusyState[domainId] = powerState;
+            s_powerBusy[domainId] = true;
+            *pending = true;
+        }
+        else
+        {
+            /* Handle pre power down tasks */
+            if ((s_powerState[domainId] != DEV_SM_POWER_STATE_OFF)
+                && (powerState == DEV_SM_POWER_STATE_OFF))
+            {
+                status = DEV_SM_PowerDownPre(domainId);
+            }
+
+            s_powerState[domainId] = powerState;
         }
+    }
+
+    /* Return status */
+    return status;
+}
 
-        /* Handle pre power down tasks */
-        if ((s_powerState[domainId] != DEV_SM_POWER_STATE_OFF)
-            && (powerState == DEV_SM_POWER_STATE_OFF))
+/*--------------------------------------------------------------------------*/
+/* Advance in flight power transitions                                      */
+/*--------------------------------------------------------------------------*/
+bool DEV_SM_PowerPoll(void)
+{
+    bool busy = false;
+
+    /* Complete in flight transitions unless held */
+    if (!s_powerPollHold)
+    {
+        for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER;
+            domainId++)
         {
-            status = DEV_SM_PowerDownPre(domainId);
+            if (s_powerBusy[domainId])
+            {
+                (void) DEV_SM_PowerTransComplete(domainId);
+            }
         }
+    }
+
+    /* Return if polling should continue */
+    return busy;
+}
 
-        s_powerState[domainId] = powerState;
+/*--------------------------------------------------------------------------*/
+/* Hold power transitions in flight                                         */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_PowerPollHold(bool hold)
+{
+    s_powerPollHold = hold;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Power up a set of power domains                                          */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PowerUpBatch(uint32_t domainMask)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domains */
+    if ((domainMask >> DEV_SM_NUM_POWER) != 0U)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* No parents, power up in domain order */
+    for (uint32_t domainId = 0U; domainId < DEV_SM_NUM_POWER; domainId++)
+    {
+        if ((status == SM_ERR_SUCCESS)
+            && ((domainMask & (1UL << domainId)) != 0U))
+        {
+            status = DEV_SM_PowerStateSet(domainId, DEV_SM_POWER_STATE_ON);
+        }
     }
 
     /* Return status */
@@ -219,3 +324,33 @@ int32_t DEV_SM_PowerRetMaskGet(uint32_t domainId, uint32_t *retMask)
     return status;
 }
 
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Complete in flight power transition of a domain                          */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PowerTransComplete(uint32_t domainId)
+{
+    /* Handle post power on loads */
+    int32_t status = DEV_SM_PowerUpPost(domainId);
+
+    /* Mark done */
+    s_powerState[domainId] = s_powerBusyState[domainId];
+    s_powerBusy[domainId] = false;
+
+    /* Apply queued request */
+    if (s_powerNext[domainId])
+    {
+        bool pending = false;
+
+        s_powerNext[domainId] = false;
+        status = DEV_SM_PowerStateSetAsync(domainId,
+            s_powerNextState[domainId], &pending);
+    }
+
+    /* Report completion */
+    LMM_PowerStateComplete(domainId, status);
+
+    /* Return status */
+    return status;
+}
@@ -86,6 +86,16 @@
 
 /* Functions */
 
+/*!
+ * Hold power transitions in flight.
+ *
+ * @param[in]     hold      True to hold, false to release
+ *
+ * While held, DEV_SM_PowerPoll() does not complete a transition started
+ * by DEV_SM_PowerStateSetAsync(). Used to test deferred responses.
+ */
+void DEV_SM_PowerPollHold(bool hold);
+
 /** @} */
 
 /* Include SM device API */
@@ -276,7 +276,7 @@ int32_t DEV_SM_SystemIdle(void)
 /*--------------------------------------------------------------------------*/
 /* System timer tick                                                        */
 /*--------------------------------------------------------------------------*/
-void DEV_SM_SystemTick(uint32_t msec)
+uint32_t DEV_SM_SystemTick(uint32_t msec)
 {
     /* Poll for CPU state changes */
     LMM_SystemCpuModeChanged(DEV_SM_CPU_0);
@@ -288,5 +288,8 @@ void DEV_SM_SystemTick(uint32_t msec)
     LMM_SystemCpuModeChanged(DEV_SM_CPU_6);
     LMM_SystemCpuModeChanged(DEV_SM_CPU_7);
     LMM_SystemCpuModeChanged(DEV_SM_CPU_8);
+
+    /* Poll again next period */
+    return msec;
 }
 
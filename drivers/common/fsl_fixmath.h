@@ -0,0 +1,145 @@
+/*
+ * Copyright 2025 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FSL_FIXMATH_H
+#define FSL_FIXMATH_H
+
+#include <stdint.h>
+#include "fsl_def.h"
+
+/*!
+ * @addtogroup ksdk_common
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! Reciprocal of 3 as a 0.65 fixed-point value (exact for all 64-bit) */
+#define FIXMATH_RECIP3_Q65  0xAAAAAAAAAAAAAAABULL
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*!
+ * Return the upper 64 bits of a 64x64-bit multiply
+ *
+ * @param[in]   a   Multiplicand
+ * @param[in]   b   Multiplier
+ *
+ * Built from 32x32-bit multiplies, which are single instructions on
+ * the M33 (64-bit division is a library call).
+ *
+ * @return High 64 bits of the 128-bit product.
+ */
+static inline uint64_t FIXMATH_MulHi64(uint64_t a, uint64_t b)
+{
+    uint64_t aLo = a & 0xFFFFFFFFULL;
+    uint64_t aHi = a >> 32U;
+    uint64_t bLo = b & 0xFFFFFFFFULL;
+    uint64_t bHi = b >> 32U;
+    uint64_t p0 = aLo * bLo;
+    uint64_t p1 = aLo * bHi;
+    uint64_t p2 = aHi * bLo;
+    uint64_t p3 = aHi * bHi;
+    uint64_t mid = (p0 >> 32U) + (p1 & 0xFFFFFFFFULL)
+        + (p2 & 0xFFFFFFFFULL);
+
+    return p3 + (p1 >> 32U) + (p2 >> 32U) + (mid >> 32U);
+}
+
+/*!
+ * Divide a 64-bit value by 24
+ *
+ * @param[in]   n   Dividend
+ *
+ * Reciprocal multiply, n / 24 = ((n * (2^65 / 3)) >> 65) >> 3.
+ *
+ * @return Return n / 24 (same as integer division).
+ */
+static inline uint64_t FIXMATH_Div24(uint64_t n)
+{
+    return FIXMATH_MulHi64(n, FIXMATH_RECIP3_Q65) >> 4U;
+}
+
+/*!
+ * Divide a 64-bit value by a 16-bit divisor
+ *
+ * @param[in]   n   Dividend
+ * @param[in]   d   Divisor (1 to 0xFFFF)
+ *
+ * Long division in 32/16-bit digits so only 32-bit hardware divides
+ * are used. Covers clock root, PLL, DFS and MFD dividers.
+ *
+ * @return Return n / d (same as integer division).
+ */
+static inline uint64_t FIXMATH_DivU64U16(uint64_t n, uint32_t d)
+{
+    uint32_t hi = (uint32_t) (n >> 32U);
+    uint32_t lo = U64_U32(n);
+    uint64_t q;
+
+    if (hi == 0U)
+    {
+        /* Single hardware divide */
+        q = (uint64_t) (lo / d);
+    }
+    else
+    {
+        uint32_t qHi = hi / d;
+        uint32_t r = hi % d;
+
+        /* Remainder < d < 2^16 so each digit fits 32 bits */
+        uint32_t mid = (r << 16U) | (lo >> 16U);
+        uint32_t qMid = mid / d;
+        r = mid % d;
+
+        uint32_t low = (r << 16U) | (lo & 0xFFFFU);
+        uint32_t qLo = low / d;
+
+        q = (((uint64_t) qHi) << 32U) | (((uint64_t) qMid) << 16U)
+            | ((uint64_t) qLo);
+    }
+
+    return q;
+}
+
+/*!
+ * Divide two 64-bit values
+ *
+ * @param[in]   n   Dividend
+ * @param[in]   d   Divisor (non-zero)
+ *
+ * Uses FIXMATH_DivU64U16() for small divisors and a 32-bit divide when
+ * both fit. Only falls back to a 64-bit divide for large operands.
+ *
+ * @return Return n / d (same as integer division).
+ */
+static inline uint64_t FIXMATH_DivU64(uint64_t n, uint64_t d)
+{
+    uint64_t q;
+
+    if (d <= 0xFFFFULL)
+    {
+        q = FIXMATH_DivU64U16(n, U64_U32(d));
+    }
+    else if (n <= 0xFFFFFFFFULL)
+    {
+        q = (d > n) ? 0ULL : ((uint64_t) (U64_U32(n) / U64_U32(d)));
+    }
+    else
+    {
+        q = n / d;
+    }
+
+    return q;
+}
+
+/** @} */
+
+#endif /* FSL_FIXMATH_H */
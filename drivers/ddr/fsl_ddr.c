@@ -48,6 +48,9 @@
 /* Local Variables */
 
 static bool s_srFastWakeEn = false;
+static struct ddr_timing s_retTiming = { 0 };
+static const struct ddr_info *s_pstateCtx = NULL;
+static bool s_pstateSkip = false;
 
 /* Local Functions */
 
@@ -57,6 +60,8 @@ static bool DDR_MrWrite(uint32_t mrRank, uint32_t mrAddr, uint32_t mrData);
 static bool DDR_PhyInit(const struct ddr_info *ddrp);
 static bool DDR_CheckDfiInitComplete(void);
 static bool DDR_DdrcInit(const struct ddr_info *ddrp);
+static bool DDR_PstateSkip(const struct ddr_info *ddrp);
+static uint32_t DDR_UsecSince(uint64_t start);
 
 /*--------------------------------------------------------------------------*/
 /* DDR Enter Retention                                                      */
@@ -64,6 +69,7 @@ static bool DDR_DdrcInit(const struct ddr_info *ddrp);
 bool DDR_EnterRetention(const struct ddr_info *ddrp)
 {
     bool rc;
+    uint64_t phaseStart = SYSCTR_GetUsec64();
 
     if (ddrp != NULL)
     {
@@ -100,6 +106,10 @@ bool DDR_EnterRetention(const struct ddr_info *ddrp)
         /* Polling for DDRDSR_2[IDLE] & ECC complete to be set */
         rc  = DDR_CheckDdrcIdle(waitFlag);
 
+        /* Capture idle wait time */
+        s_retTiming.idleUsec = DDR_UsecSince(phaseStart);
+        phaseStart = SYSCTR_GetUsec64();
+
         if (rc != false)
         {
             /* MEM HALT */
@@ -173,6 +183,9 @@ bool DDR_EnterRetention(const struct ddr_info *ddrp)
                 }
             }
         }
+
+        /* Capture self-refresh/LP3 entry time */
+        s_retTiming.lpUsec = DDR_UsecSince(phaseStart);
     }
     else
     {
@@ -189,20 +202,38 @@ bool DDR_EnterRetention(const struct ddr_info *ddrp)
 bool DDR_ExitRetention(const struct ddr_info *ddrp)
 {
     bool rc;
+    uint64_t phaseStart = SYSCTR_GetUsec64();
+
+    s_retTiming.ddrcUsec = 0U;
 
     /* Reload the DDRPHY config */
     rc = DDR_PhyInit(ddrp);
 
+    /* Capture PHY restore time */
+    s_retTiming.phyUsec = DDR_UsecSince(phaseStart);
+    phaseStart = SYSCTR_GetUsec64();
+
     if (rc != false)
     {
         /* Reload the ddrc config */
         rc = DDR_DdrcInit(ddrp);
+
+        /* Capture DDRC restore time */
+        s_retTiming.ddrcUsec = DDR_UsecSince(phaseStart);
     }
 
     /* Return status */
     return rc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get DDR retention timing                                                 */
+/*--------------------------------------------------------------------------*/
+void DDR_GetRetentionTiming(struct ddr_timing *timing)
+{
+    *timing = s_retTiming;
+}
+
 /*--------------------------------------------------------------------------*/
 /* DDR PHY address remap to 32-bit addressing                               */
 /*--------------------------------------------------------------------------*/
@@ -445,8 +476,8 @@ static bool DDR_DdrcInit(const struct ddr_info *ddrp)
             }
         }
 
-        /* Check pstate */
-        if (ddrp->pstate != NULL)
+        /* Check pstate, skip if it only repeats the DDRC config */
+        if ((ddrp->pstate != NULL) && !DDR_PstateSkip(ddrp))
         {
             ddrc_cfg = ddrp->pstate[0].cfg;
             for (i = 0;  i < ddrp->pstate[0].cfg_num; i++)
@@ -576,3 +607,70 @@ bool DDR_GetDRAMInfo(const struct ddr_info *ddrp, struct dram_info *info)
     return rc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check if pstate 0 restore is redundant                                   */
+/*--------------------------------------------------------------------------*/
+static bool DDR_PstateSkip(const struct ddr_info *ddrp)
+{
+    /* Evaluate once per saved DDR config */
+    if (ddrp != s_pstateCtx)
+    {
+        const struct ddrc *ddrc_cfg = ddrp->ddrc_cfg;
+        const struct ddrc *pstate_cfg = ddrp->pstate[0].cfg;
+        bool skip = true;
+
+        /* Each pstate 0 write must match the final DDRC config value */
+        for (uint32_t i = 0U; skip && (i < ddrp->pstate[0].cfg_num); i++)
+        {
+            uint32_t reg = pstate_cfg[i].reg;
+
+            /* Registers modified during restore are always written */
+            if ((((reg ^ (uint32_t)(&DDRC->DDR_MTCR)) & 0xFFFFFU) == 0U)
+                || (((reg ^ (uint32_t)(&DDRC->DDR_SDRAM_CFG)) & 0xFFFFFU)
+                == 0U)
+                || (((reg ^ (uint32_t)(&DDRC->DDR_SDRAM_CFG_2)) & 0xFFFFFU)
+                == 0U))
+            {
+                skip = false;
+            }
+            else
+            {
+                bool match = false;
+
+                /* Last write in the DDRC config determines the value */
+                for (uint32_t j = 0U; j < ddrp->ddrc_cfg_num; j++)
+                {
+                    if (((ddrc_cfg[j].reg ^ reg) & 0xFFFFFU) == 0U)
+                    {
+                        match = (ddrc_cfg[j].val == pstate_cfg[i].val);
+                    }
+                }
+                skip = match;
+            }
+        }
+
+        s_pstateSkip = skip;
+        s_pstateCtx = ddrp;
+    }
+
+    /* Return result */
+    return s_pstateSkip;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get elapsed time in usec                                                 */
+/*--------------------------------------------------------------------------*/
+static uint32_t DDR_UsecSince(uint64_t start)
+{
+    uint64_t now = SYSCTR_GetUsec64();
+    uint32_t usec = 0U;
+
+    /* Check the value doesn't wrap */
+    if (now >= start)
+    {
+        usec = (uint32_t) MIN(now - start, (uint64_t) UINT32_MAX);
+    }
+
+    /* Return elapsed time */
+    return usec;
+}
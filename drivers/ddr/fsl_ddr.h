@@ -97,6 +97,18 @@ struct ddr_info {
     uint32_t ZQCalCodePD;
 };
 
+/*! DDR retention phase timing (usec). */
+struct ddr_timing {
+    /*! entry, wait for DDRC idle */
+    uint32_t idleUsec;
+    /*! entry, self-refresh and LP3 sequence */
+    uint32_t lpUsec;
+    /*! exit, PHY CSR restore and ZQ calibration */
+    uint32_t phyUsec;
+    /*! exit, DDRC restore and DFI init */
+    uint32_t ddrcUsec;
+};
+
 /*! DRAM info. */
 struct dram_info {
     /*! total number of regions */
@@ -151,6 +163,16 @@ bool DDR_EnterRetention(const struct ddr_info *ddrp);
  */
 bool DDR_ExitRetention(const struct ddr_info *ddrp);
 
+/*!
+ * Get DRAM retention timing
+ *
+ * Returns the duration of each phase of the last retention entry and
+ * exit.
+ *
+ * @param[out]    timing    Phase timing.
+ */
+void DDR_GetRetentionTiming(struct ddr_timing *timing);
+
 /*!
  * DDR PHY address mapper
  *
@@ -48,6 +48,8 @@
 #define ELE_MSG_MIN_SIZE        3U
 #define ELE_MSG_MAX_SIZE        23U
 
+#define ELE_QUEUE_LEN           16U
+
 /* Local Types */
 
 typedef enum
@@ -122,10 +124,21 @@ typedef union
 // coverity[misra_c_2012_rule_19_2_violation]
 } ele_mu_min_t;
 
+typedef struct
+{
+    ele_mu_min_t msg;
+    ele_cb_t cb;
+    uint32_t cookie;
+} ele_req_t;
+
 /* Local Functions */
 
+static int32_t ELE_Submit(const ele_mu_min_t *msg, ele_cmd_type_t cmd,
+    uint8_t size, ele_cb_t cb, uint32_t cookie);
+static void ELE_QueueService(void);
 static void ELE_Call(ele_mu_msg_t *msg, ele_cmd_type_t cmd,
     uint8_t size);
+static int32_t ELE_RespCheck(const ele_mu_msg_t *msg, ele_cmd_type_t cmd);
 static void ELE_MuTx(ele_mu_msg_t *msg);
 static void ELE_MuRx(ele_mu_msg_t *msg, uint8_t maxLen,
     ele_cmd_type_t cmd);
@@ -139,6 +152,15 @@ static bool s_aborted = false;
 static uint32_t s_eleErrno = 0U;
 static MU_Type *s_eleMuBase = NULL;
 
+/* Async request queue, head is in flight when s_eleQueueBusy */
+static ele_req_t s_eleQueue[ELE_QUEUE_LEN];
+static volatile uint32_t s_eleQueueHead = 0U;
+static volatile uint32_t s_eleQueueCnt = 0U;
+static volatile bool s_eleQueueBusy = false;
+static volatile bool s_eleQueueActive = false;
+// coverity[misra_c_2012_rule_19_2_violation]
+static ele_mu_msg_t s_msgAsync;
+
 /* Global variable */
 
 int32_t g_eleStatus = SM_ERR_SUCCESS;
@@ -187,6 +209,21 @@ void ELE_RdcRelease(uint8_t rdcId)
 #endif
 }
 
+/*--------------------------------------------------------------------------*/
+/* Queue release of RDC to calling core                                     */
+/*--------------------------------------------------------------------------*/
+int32_t ELE_RdcReleaseAsync(uint8_t rdcId, ele_cb_t cb, uint32_t cookie)
+{
+    ele_mu_min_t msg = { 0 };
+
+    /* Fill in parameters */
+    msg.word[1] = 1U;
+    msg.word[1] |= ((uint32_t) rdcId) << 8U;
+
+    /* Queue request */
+    return ELE_Submit(&msg, ELE_RELEASE_RDC_REQ, 2U, cb, cookie);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get ELE FW status                                                        */
 /*--------------------------------------------------------------------------*/
@@ -615,6 +652,34 @@ bool ELE_IsAborted(void)
     return s_aborted;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Wait for queued ELE requests                                             */
+/*--------------------------------------------------------------------------*/
+void ELE_Flush(void)
+{
+    /* Poll in case called with the ELE MU IRQ masked */
+    while (s_eleQueueCnt != 0U)
+    {
+        ELE_QueueService();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Service queued ELE requests                                              */
+/*--------------------------------------------------------------------------*/
+void ELE_Poll(void)
+{
+    ELE_QueueService();
+}
+
+/*--------------------------------------------------------------------------*/
+/* ELE MU IRQ handler                                                       */
+/*--------------------------------------------------------------------------*/
+void ELE_MuIrqHandler(void)
+{
+    ELE_QueueService();
+}
+
 /*--------------------------------------------------------------------------*/
 /* Parse ELE response                                                       */
 /*--------------------------------------------------------------------------*/
@@ -722,6 +787,143 @@ int32_t ELE_Ind2Err(ele_msg_ind_t ind)
 
 /*==========================================================================*/
 
+/*--------------------------------------------------------------------------*/
+/* Queue async ELE request                                                  */
+/*--------------------------------------------------------------------------*/
+static int32_t ELE_Submit(const ele_mu_min_t *msg, ele_cmd_type_t cmd,
+    uint8_t size, ele_cb_t cb, uint32_t cookie)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t primask = DisableGlobalIRQ();
+
+    /* Check for abort state */
+    if (s_aborted)
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+    else if (s_eleQueueCnt >= ELE_QUEUE_LEN)
+    {
+        status = SM_ERR_BUSY;
+    }
+    else
+    {
+        ele_req_t *req = &s_eleQueue[(s_eleQueueHead + s_eleQueueCnt)
+            % ELE_QUEUE_LEN];
+
+        /* Copy request */
+        req->msg = *msg;
+        req->msg.hdr.tag = ELE_MSG_TAG;
+        req->msg.hdr.cmd = cmd;
+        req->msg.hdr.size = size;
+        req->msg.hdr.ver = ELE_MSG_VER;
+        req->cb = cb;
+        req->cookie = cookie;
+        s_eleQueueCnt++;
+    }
+
+    EnableGlobalIRQ(primask);
+
+    /* Start if idle */
+    if (status == SM_ERR_SUCCESS)
+    {
+        ELE_QueueService();
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete in-flight ELE request and start the next                        */
+/*--------------------------------------------------------------------------*/
+static void ELE_QueueService(void)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    /* Only one context services the queue, a nested call leaves new
+     * requests to it
+     */
+    bool run = !s_eleQueueActive;
+    s_eleQueueActive = true;
+
+    EnableGlobalIRQ(primask);
+
+    if (run)
+    {
+        /* Keep the ELE MU IRQ from preempting the service */
+        MU_DisableInterrupts(s_eleMuBase,
+            (uint32_t) kMU_Rx0FullInterruptEnable);
+    }
+
+    while (run)
+    {
+        /* Response to in-flight request or aborted? */
+        if ((s_eleQueueCnt != 0U) && (s_aborted || (s_eleQueueBusy
+            && ((MU_GetStatusFlags(s_eleMuBase)
+            & ((uint32_t) kMU_Rx0FullFlag)) != 0U))))
+        {
+            const ele_req_t *req = &s_eleQueue[s_eleQueueHead];
+            ele_cmd_type_t cmd = req->msg.hdr.cmd;
+            ele_cb_t cb = req->cb;
+            uint32_t cookie = req->cookie;
+            int32_t status = SM_ERR_NOT_SUPPORTED;
+
+            if (!s_aborted)
+            {
+                /* Receive response */
+                s_msgAsync.word[1] = 0U;
+                ELE_MuRx(&s_msgAsync, ELE_MSG_MAX_SIZE, cmd);
+                status = ELE_RespCheck(&s_msgAsync, cmd);
+
+                /* Translate error */
+                ELE_ErrXlate(&status, s_msgAsync.word[1]);
+            }
+
+            /* Pop request */
+            primask = DisableGlobalIRQ();
+            s_eleQueueHead = (s_eleQueueHead + 1U) % ELE_QUEUE_LEN;
+            s_eleQueueCnt--;
+            s_eleQueueBusy = false;
+            EnableGlobalIRQ(primask);
+
+            /* Notify requester */
+            if (cb != NULL)
+            {
+                cb(cookie, status);
+            }
+        }
+        /* Send next request */
+        else if (!s_eleQueueBusy && (s_eleQueueCnt != 0U))
+        {
+            const ele_req_t *req = &s_eleQueue[s_eleQueueHead];
+
+            s_msgAsync.hdr = req->msg.hdr;
+            for (uint32_t idx = 1U; idx < ELE_MSG_MIN_SIZE; idx++)
+            {
+                s_msgAsync.word[idx] = req->msg.word[idx];
+            }
+
+            ELE_MuTx(&s_msgAsync);
+            s_eleQueueBusy = true;
+        }
+        else
+        {
+            /* Done unless a request was queued meanwhile */
+            primask = DisableGlobalIRQ();
+            run = (s_eleQueueCnt != 0U) && (s_aborted || !s_eleQueueBusy);
+            s_eleQueueActive = run;
+            EnableGlobalIRQ(primask);
+
+            /* Interrupt only while a request is in flight */
+            if (!run && s_eleQueueBusy)
+            {
+                MU_EnableInterrupts(s_eleMuBase,
+                    (uint32_t) kMU_Rx0FullInterruptEnable);
+            }
+        }
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Call ELE function                                                        */
 /*--------------------------------------------------------------------------*/
@@ -738,6 +940,9 @@ static void ELE_Call(ele_mu_msg_t *msg, ele_cmd_type_t cmd, uint8_t size)
 
     if (status == SM_ERR_SUCCESS)
     {
+        /* Wait for queued requests to complete */
+        ELE_Flush();
+
         /* Setup message */
         msg->hdr.tag = ELE_MSG_TAG;
         msg->hdr.cmd = cmd;
@@ -752,31 +957,46 @@ static void ELE_Call(ele_mu_msg_t *msg, ele_cmd_type_t cmd, uint8_t size)
         ELE_MuRx(msg, ELE_MSG_MAX_SIZE, cmd);
 
         /* Check response */
-        if (msg->hdr.tag != ELE_MSG_TAG_RESP)
-        {
-            status = SM_ERR_PROTOCOL_ERROR;
-        }
-        else if ((msg->hdr.cmd != cmd) && (msg->hdr.cmd != ELE_ABORT))
-        {
-            status = SM_ERR_PROTOCOL_ERROR;
-        }
-        else if (msg->hdr.size == 0U)
-        {
-            status = SM_ERR_PROTOCOL_ERROR;
-        }
-        else if (msg->hdr.ver != ELE_MSG_VER)
-        {
-            status = SM_ERR_PROTOCOL_ERROR;
-        }
-        else
-        {
-            ; /* Intentional empty else */
-        }
+        status = ELE_RespCheck(msg, cmd);
     }
 
     g_eleStatus = status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check ELE response header                                                */
+/*--------------------------------------------------------------------------*/
+// coverity[misra_c_2012_rule_19_2_violation]
+static int32_t ELE_RespCheck(const ele_mu_msg_t *msg, ele_cmd_type_t cmd)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check response */
+    if (msg->hdr.tag != ELE_MSG_TAG_RESP)
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+    else if ((msg->hdr.cmd != cmd) && (msg->hdr.cmd != ELE_ABORT))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+    else if (msg->hdr.size == 0U)
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+    else if (msg->hdr.ver != ELE_MSG_VER)
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+    else
+    {
+        ; /* Intentional empty else */
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Send MU message to ELE                                                   */
 /*--------------------------------------------------------------------------*/
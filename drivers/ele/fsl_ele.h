@@ -167,6 +167,14 @@ typedef struct
     uint32_t reserved[8];    /*!< Reserved */
 } ele_info_t;
 
+/*!
+ * Async request completion callback.
+ *
+ * @param[in]     cookie      Cookie passed when the request was queued
+ * @param[in]     status      Translated status of the request
+ */
+typedef void (*ele_cb_t)(uint32_t cookie, int32_t status);
+
 /* Functions */
 
 /*!
@@ -198,6 +206,26 @@ void ELE_Ping(void);
  */
 void ELE_RdcRelease(uint8_t rdcId);
 
+/*!
+ * Queue release of RDC.
+ *
+ * @param[in]     rdcId       RDC to release
+ * @param[in]     cb          Completion callback (can be NULL)
+ * @param[in]     cookie      Value passed to the callback
+ *
+ * This function queues an RDC release request and returns without
+ * waiting for the ELE. Queued requests are sent back-to-back from the
+ * ELE MU interrupt and \a cb is called from that context when the
+ * request completes. See ELE_RdcRelease().
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if the ELE is aborted.
+ * - ::SM_ERR_BUSY: if the request queue is full.
+ */
+int32_t ELE_RdcReleaseAsync(uint8_t rdcId, ele_cb_t cb, uint32_t cookie);
+
 /*!
  * Get ELE FW status.
  *
@@ -357,6 +385,34 @@ void ELE_Abort(void);
  */
 bool ELE_IsAborted(void);
 
+/*!
+ * Wait for queued ELE requests.
+ *
+ * This function waits until all queued async requests have completed
+ * and their callbacks have been called. It polls the ELE MU so can be
+ * called with the ELE MU interrupt masked. Synchronous ELE calls flush
+ * the queue before sending.
+ */
+void ELE_Flush(void);
+
+/*!
+ * Service queued ELE requests.
+ *
+ * This function completes the in-flight async request if its response
+ * has arrived and sends the next queued request. It does not wait, so
+ * it can be used to poll for a specific request with the ELE MU
+ * interrupt masked.
+ */
+void ELE_Poll(void);
+
+/*!
+ * Handle ELE MU interrupt.
+ *
+ * This function completes the in-flight async request and sends the
+ * next queued request. Called from the ELE MU receive interrupt.
+ */
+void ELE_MuIrqHandler(void);
+
 /*!
  * Translate ELE response word.
  *
@@ -37,6 +37,8 @@
 /* Local Variables */
 
 static SYS_CTR_CONTROL_Type *const s_sysctrBases[] = SYS_CTR_CONTROL_BASE_PTRS;
+static SYS_CTR_COMPARE_Type *const s_sysctrCmpBases[] =
+    SYS_CTR_COMPARE_BASE_PTRS;
 
 /*--------------------------------------------------------------------------*/
 /* Initialize and enable SYSCTR                                             */
@@ -160,3 +162,18 @@ void SYSCTR_FreqMode(bool bLowFreq, bool bWaitAck)
         }
     }
 }
+
+/*--------------------------------------------------------------------------*/
+/* Program SYSCTR compare frame 0                                           */
+/*--------------------------------------------------------------------------*/
+void SYSCTR_CompareSet(uint64_t ticks)
+{
+    /* Disable compare while updating the 64-bit value */
+    s_sysctrCmpBases[0]->CMPCR0 = 0U;
+
+    s_sysctrCmpBases[0]->CMPCVL0 = (uint32_t) (ticks & 0xFFFFFFFFULL);
+    s_sysctrCmpBases[0]->CMPCVH0 = (uint32_t) (ticks >> 32U);
+
+    /* Enable compare with interrupt unmasked */
+    s_sysctrCmpBases[0]->CMPCR0 = SYS_CTR_COMPARE_CMPCR0_EN(1U);
+}
@@ -39,6 +39,7 @@
 
 /* Includes */
 #include "fsl_common.h"
+#include "fsl_fixmath.h"
 
 /* SYSCTR counts at a rate of 24 MHz (1/24 usec period).  Conversions
    to/from usec can be calculated using the following:
@@ -53,8 +54,8 @@
 /*! Convert microseconds to ticks */
 #define SYSCTR_USEC_TO_TICKS(usec)      ((usec) * 24U)
 
-/*! Convert ticks to microseconds (64-bit) */
-#define SYSCTR_TICKS_TO_USEC64(ticks)   (((uint64_t) (ticks)) / 24ULL)
+/*! Convert ticks to microseconds (64-bit, reciprocal multiply) */
+#define SYSCTR_TICKS_TO_USEC64(ticks)   FIXMATH_Div24((uint64_t) (ticks))
 
 /*! Convert microseconds to ticks (64-bit) */
 #define SYSCTR_USEC_TO_TICKS64(usec)    (((uint64_t) (usec)) * 24ULL)
@@ -122,6 +123,15 @@ void SYSCTR_TimeDelay(uint32_t usec);
  */
 void SYSCTR_FreqMode(bool bLowFreq, bool bWaitAck);
 
+/*!
+ * This function programs compare frame 0 to assert its interrupt when
+ * the system counter reaches the indicated value. Programming a new
+ * value deasserts a pending compare interrupt.
+ *
+ * @param[in]     ticks       Absolute 64-bit counter value to compare
+ */
+void SYSCTR_CompareSet(uint64_t ticks);
+
 /** @} */
 
 #endif /* DRV_SYSCTR_H */
@@ -41,6 +41,7 @@
 #include "sm.h"
 #include "brd_sm.h"
 #include "lmm.h"
+#include "binlog.h"
 #ifdef RUN_TEST
 #include "test.h"
 #endif
@@ -96,6 +97,9 @@ int main(int argc, const char * const argv[])
     /* Store boot start time */
     g_bootTime[SM_BT_START] = DEV_SM_Usec64Get();
 
+    /* Init binary log */
+    BINLOG_Init();
+
 #ifdef INC_LIBC
     /* Configure stdio for no buffering */
     (void) setvbuf(stdin, NULL, _IONBF, 0);
@@ -249,6 +253,8 @@ void SM_Error(int32_t status)
         pc = 0U;
 #endif
 
+        BINLOG2(BINLOG_ID_SM_ERR, "SM error %d, pc=0x%08X", status, pc);
+
 #ifdef USES_FUSA
         /* Report to FuSa */
         LMM_FuSaAssertionFailure(status);
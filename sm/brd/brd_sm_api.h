@@ -90,11 +90,14 @@ void BRD_SM_Exit(int32_t status, uint32_t pc);
 /*!
  * Board timer tick.
  *
- * @param[in]     msec          Period in milliseconds
+ * @param[in]     msec          Elapsed time in milliseconds
  *
- * This function is called periodically by a timer.
+ * This function is called by the tick timer.
+ *
+ * @return Returns the time until service is next required in
+ *         milliseconds (::DEV_SM_TICK_IDLE = no deadline).
  */
-void BRD_SM_TimerTick(uint32_t msec);
+uint32_t BRD_SM_TimerTick(uint32_t msec);
 
 /*!
  * Board custom function. Called from the debug monitor.
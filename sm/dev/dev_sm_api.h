@@ -190,6 +190,16 @@
 #define SM_POWERSTATESET        DEV_SM_PowerStateSet
 #endif
 
+#ifndef SM_POWERSTATESETASYNC
+/*! Redirector (device/board) to start setting a power domain state */
+#define SM_POWERSTATESETASYNC   DEV_SM_PowerStateSetAsync
+#endif
+
+#ifndef SM_POWERUPBATCH
+/*! Redirector (device/board) to power up a set of power domains */
+#define SM_POWERUPBATCH         DEV_SM_PowerUpBatch
+#endif
+
 #ifndef SM_POWERSTATEGET
 /*! Redirector (device/board) to get a power domain's state */
 #define SM_POWERSTATEGET        DEV_SM_PowerStateGet
@@ -70,11 +70,39 @@
  */
 int32_t DEV_SM_FuseInfoGet(uint32_t fuseWord, uint32_t *addr);
 
+/*!
+ * Init fuses.
+ *
+ * Reads all fuse fields used by the SM into a snapshot and caches the
+ * power domain and CPU disable state. Must be called before any other
+ * fuse function, so the board calls it before configuring clocks.
+ */
+void DEV_SM_FuseInit(void);
+
+/*!
+ * Write a fuse word.
+ *
+ * @param[in]     fuseWord  Index of word
+ * @param[in]     fuseVal   Value to write
+ *
+ * All fuse writes must use this function as it also updates the fuse
+ * snapshot.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND: if fuseWord is not valid.
+ * - ::SM_ERR_NOT_SUPPORTED: if fuses cannot be written.
+ */
+int32_t DEV_SM_FuseWrite(uint32_t fuseWord, uint32_t fuseVal);
+
 /*!
  * Get fuse state.
  *
  * @param[in]     fuseId      Id of fuse to read
  *
+ * Returns the value from the fuse snapshot. See DEV_SM_FuseInit().
+ *
  * @return Returns the fuse value.
  */
 uint32_t DEV_SM_FuseGet(uint32_t fuseId);
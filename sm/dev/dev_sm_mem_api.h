@@ -122,11 +122,14 @@ int32_t DEV_SM_MemDdrRetentionExit(void);
 /*!
  * Memory timer tick.
  *
- * @param[in]     msec          Period in milliseconds
+ * @param[in]     msec          Elapsed time in milliseconds
  *
- * This function is called periodically by a timer.
+ * This function is called by the tick timer.
+ *
+ * @return Returns the time until service is next required in
+ *         milliseconds (::DEV_SM_TICK_IDLE = no deadline).
  */
-void DEV_SM_MemTick(uint32_t msec);
+uint32_t DEV_SM_MemTick(uint32_t msec);
 
 #endif /* DEV_SM_MEM_API_H */
 
@@ -117,6 +117,63 @@ int32_t DEV_SM_PowerStateNameGet(uint32_t powerState, string *stateNameAddr,
  */
 int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState);
 
+/*!
+ * Start setting a device power domain state.
+ *
+ * @param[in]     domainId    Power domain to set
+ * @param[in]     powerState  Requested power state
+ * @param[out]    pending     Return true if the transition is in flight
+ *
+ * This function starts a split-phase power state change. Each domain has
+ * its own transition. If the transition cannot finish right away (waiting
+ * on a parent, child, or inrush limit, or the hardware sequence has to
+ * run), \a pending is set to true and the transition is advanced by
+ * DEV_SM_PowerPoll(). On completion LMM_PowerStateComplete() reports the
+ * result. A request for a domain already in transition is queued behind
+ * it and reported with it. If \a pending is false then the transition (if
+ * any) has already completed and the status is final.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a domainId is out of range
+ * - ::SM_ERR_POWER if the parent is off or a child is on
+ */
+int32_t DEV_SM_PowerStateSetAsync(uint32_t domainId, uint8_t powerState,
+    bool *pending);
+
+/*!
+ * Advance in flight power transitions.
+ *
+ * Advances each in flight transition by one step: start it once no longer
+ * blocked, check the hardware sequence, or run the post-processing. Never
+ * waits on the hardware; a sequence that does not finish in time fails
+ * with ::SM_ERR_HARDWARE_ERROR. Called from a one-shot timer (see
+ * TIMER_Start()) while a transition is in flight.
+ *
+ * @return Returns true if a transition is still in flight.
+ */
+bool DEV_SM_PowerPoll(void);
+
+/*!
+ * Power up a set of device power domains.
+ *
+ * @param[in]     domainMask  Mask of power domains to turn on
+ *
+ * This function powers up several domains together. All are requested
+ * first and then advanced with DEV_SM_PowerPoll() until done. Up to
+ * BOARD_PWR_MAX_INRUSH slices ramp at once and children are not started
+ * while their parent is still powering up. Returns once all are done.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if a domain in \a domainMask is out of range
+ * - ::SM_ERR_POWER if the parent of a domain cannot be powered
+ * - ::SM_ERR_HARDWARE_ERROR if a power up does not complete
+ */
+int32_t DEV_SM_PowerUpBatch(uint32_t domainMask);
+
 /*!
  * Get device power domain state.
  *
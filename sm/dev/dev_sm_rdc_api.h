@@ -61,7 +61,8 @@
  * Initialize the RDC.
  *
  * This function initializes the RDC (e.g. TRDC, XRDC). This include asking
- * for control of these from the ELE.
+ * for control of these from the ELE. The ELE requests may complete after
+ * return; DEV_SM_RdcLoad() waits for the RDC it loads.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  */
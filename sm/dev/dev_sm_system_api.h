@@ -59,6 +59,9 @@
 /*! System sleep flags */
 #define DEV_SM_SLEEP_FLAGS(x)  (((x) & 0xFFFFU) >> 0U)
 
+/*! Tick deadline indicating no service required */
+#define DEV_SM_TICK_IDLE  0xFFFFFFFFU
+
 /* Types */
 
 /*!
@@ -236,19 +239,24 @@ int32_t DEV_SM_SystemIdle(void);
 /*!
  * System timer tick.
  *
- * @param[in]     msec          Period in milliseconds
+ * @param[in]     msec          Elapsed time in milliseconds
+ *
+ * This function is called by the tick timer. The timer is not periodic,
+ * it is programmed for the earliest deadline returned by the tick
+ * functions.
  *
- * This function is called periodically by a timer.
+ * @return Returns the time until service is next required in
+ *         milliseconds (::DEV_SM_TICK_IDLE = no deadline).
  */
-void DEV_SM_SystemTick(uint32_t msec);
+uint32_t DEV_SM_SystemTick(uint32_t msec);
 
 #ifdef DEV_SM_MSG_PROF_CNT
 /*!
  * Message profile start notification.
  *
- * @param[in]   mu              MU instance for the message
+ * @param[in]   scmiChannel     SCMI channel for the message
  */
-void DEV_SM_SystemMsgProfStart(uint32_t mu);
+void DEV_SM_SystemMsgProfStart(uint32_t scmiChannel);
 
 /*!
  * Message profile describe notification.
@@ -264,10 +272,10 @@ void DEV_SM_SystemMsgProfDescribe(uint32_t scmiChannel, uint32_t chanType,
 /*!
  * Message profile end notification.
  *
- * @param[in]   mu              MU instance for the message
+ * @param[in]   scmiChannel     SCMI channel for the message
  *
  */
-void DEV_SM_SystemMsgProfEnd(uint32_t mu);
+void DEV_SM_SystemMsgProfEnd(uint32_t scmiChannel);
 #endif
 
 #endif /* DEV_SM_SYSTEM_API_H */
@@ -90,6 +90,7 @@
 #define LMM_TRIGGER_FUSA_SEENV  0x6U  /*!< FuSa S-EENV event */
 #define LMM_TRIGGER_FUSA_FAULT  0x7U  /*!< FuSa fault event */
 #define LMM_TRIGGER_CTRL        0x8U  /*!< Control event */
+#define LMM_TRIGGER_POWER       0x9U  /*!< Power transition complete */
 /** @} */
 
 /* Types */
@@ -90,6 +90,14 @@
 #define LMM_AUTO_BOTH    0x3U  /*!< Always boot from button & alarm */
 /** @} */
 
+/*!
+ * @name LM warm reset policies
+ */
+/** @{ */
+#define LMM_WARM_NONE  0x0U  /*!< Warm reset runs the full stop program */
+#define LMM_WARM_PD    0x1U  /*!< Keep power domains on over warm reset */
+/** @} */
+
 /* Types */
 
 /*!
@@ -102,12 +110,14 @@ typedef struct
     uint32_t start;                    /*!< Start index */
     uint32_t stop;                     /*!< Stop index */
     uint32_t rtime;                    /*!< Relative start time */
+    uint32_t deadline;                 /*!< Graceful op deadline (mS) */
     string name;                       /*!< Name of LM */
     uint8_t rpcType;                   /*!< RPC type */
     uint8_t rpcInst;                   /*!< RPC instance */
     uint8_t safeType;                  /*!< Safety classification */
     uint8_t group;                     /*!< LMM group */
     uint8_t autoBoot;                  /*!< LMM auto boot */
+    uint8_t warm;                      /*!< Warm reset policy */
     uint8_t boot[SM_LM_NUM_MSEL];      /*!< Boot order of LM */
     uint8_t bootSkip[SM_LM_NUM_MSEL];  /*!< Skip boot if no image */
 } lmm_config_t;
@@ -127,6 +137,19 @@ typedef struct
     uint8_t numArg;             /*!< Argument count */
 } lmm_startstop_t;
 
+/*!
+ * LMM start/stop program structure
+ *
+ * A program is the list of start or stop entries of one LM for one mSel.
+ * See @ref CONFIG_STRUCT for more info.
+ */
+typedef struct
+{
+    uint32_t cpuMask;           /*!< Mask of CPU commands */
+    uint16_t first;             /*!< First index into step array */
+    uint16_t num;               /*!< Number of steps */
+} lmm_prog_t;
+
 /*!
  * LMM fault structure
  *
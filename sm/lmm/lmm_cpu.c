@@ -42,6 +42,7 @@
 #include "sm.h"
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "binlog.h"
 
 /* Local defines */
 
@@ -167,9 +168,8 @@ int32_t LMM_CpuStart(uint32_t lmId, uint32_t cpuId)
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_cpu: LMM_CpuStart() started LM%u CPU%u, status=0x%X\n", lmId, cpuId, status);
-#endif
+    BINLOG3(BINLOG_ID_CPU_START, "LM%u CPU%u start, status=%d", lmId, cpuId,
+        status);
 
     /* Return status */
     return status;
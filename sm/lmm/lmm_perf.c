@@ -49,6 +49,8 @@
 
 /* Local variables */
 
+static uint32_t s_perfLevel[SM_NUM_PERF][SM_NUM_LM];
+
 /*--------------------------------------------------------------------------*/
 /* Return performance domain name                                           */
 /*--------------------------------------------------------------------------*/
@@ -134,7 +136,6 @@ int32_t LMM_PerfLevelSet(uint32_t lmId, uint32_t domainId,
 
     if (status == SM_ERR_SUCCESS)
     {
-        static uint32_t s_perfLevel[SM_NUM_PERF][SM_NUM_LM];
         uint8_t newPerfLevel = 0U;
 
         /* Record new level */
@@ -167,3 +168,25 @@ int32_t LMM_PerfLevelGet(uint32_t lmId, uint32_t domainId,
     return SM_PERFLEVELGET(domainId, performanceLevel);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get performance level voted by an LM                                     */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_PerfLevelVoteGet(uint32_t lmId, uint32_t domainId,
+    uint32_t *performanceLevel)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check parameters */
+    if ((lmId >= SM_NUM_LM) || (domainId >= SM_NUM_PERF))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+    else
+    {
+        *performanceLevel = s_perfLevel[domainId][lmId];
+    }
+
+    /* Return status */
+    return status;
+}
+
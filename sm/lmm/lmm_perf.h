@@ -180,6 +180,25 @@ int32_t LMM_PerfLevelSet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_PerfLevelGet(uint32_t lmId, uint32_t domainId,
     uint32_t *performanceLevel);
 
+/*!
+ * Get the performance level voted by an LM.
+ *
+ * @param[in]   lmId              LM call is for
+ * @param[in]   domainId          Identifier for the domain
+ * @param[out]  performanceLevel  Pointer to return the level
+ *
+ * This function returns the level last recorded for \a lmId by
+ * LMM_PerfLevelSet(), not the aggregated level of the domain.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the level was returned successfully.
+ * - ::SM_ERR_INVALID_PARAMETERS if \a lmId or \a domainId out of range
+ */
+int32_t LMM_PerfLevelVoteGet(uint32_t lmId, uint32_t domainId,
+    uint32_t *performanceLevel);
+
 #endif /* LMM_PERF_H */
 
 /** @} */
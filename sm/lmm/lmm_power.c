@@ -51,6 +51,11 @@
 
 static uint8_t s_powerState[SM_NUM_POWER][SM_NUM_LM];
 
+/* Local functions */
+
+static int32_t LMM_PowerStateAggregate(uint32_t lmId, uint32_t domainId,
+    uint8_t powerState, uint8_t *newPowerState);
+
 /*--------------------------------------------------------------------------*/
 /* Return power domain name                                                 */
 /*--------------------------------------------------------------------------*/
@@ -76,6 +81,55 @@ int32_t LMM_PowerStateNameGet(uint32_t lmId, uint32_t powerState,
 /*--------------------------------------------------------------------------*/
 int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
     uint8_t powerState)
+{
+    uint8_t newPowerState = 0U;
+
+    /* Record and aggregate */
+    int32_t status = LMM_PowerStateAggregate(lmId, domainId, powerState,
+        &newPowerState);
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Inform device of power state, device will check if changed */
+        status = SM_POWERSTATESET(domainId, newPowerState);
+    }
+
+    SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start setting power domain state                                         */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_PowerStateSetAsync(uint32_t lmId, uint32_t domainId,
+    uint8_t powerState, bool *pending)
+{
+    uint8_t newPowerState = 0U;
+
+    /* Record and aggregate */
+    int32_t status = LMM_PowerStateAggregate(lmId, domainId, powerState,
+        &newPowerState);
+
+    *pending = false;
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Inform device of power state, device will check if changed */
+        status = SM_POWERSTATESETASYNC(domainId, newPowerState, pending);
+    }
+
+    SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Power up a set of power domains                                          */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_PowerUpBatch(uint32_t lmId, uint32_t domainMask)
 {
     int32_t status = SM_ERR_SUCCESS;
 
@@ -85,27 +139,33 @@ int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
         status = SM_ERR_INVALID_PARAMETERS;
     }
 
-    /* Check parameters */
-    if ((status == SM_ERR_SUCCESS) && (domainId >= SM_NUM_POWER))
+    /* Check domains */
+    for (uint32_t domainId = SM_NUM_POWER; domainId < 32U; domainId++)
     {
-        status = SM_ERR_NOT_FOUND;
+        if ((status == SM_ERR_SUCCESS)
+            && ((domainMask & (1UL << domainId)) != 0U))
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
     }
 
     if (status == SM_ERR_SUCCESS)
     {
-        uint8_t newPowerState = 0U;
-
-        /* Record new state */
-        s_powerState[domainId][lmId] = (uint8_t) (powerState & 0xFFU);
+        /* Inform device, device will skip domains already on */
+        status = SM_POWERUPBATCH(domainMask);
+    }
 
-        /* Aggregate power state */
-        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+    /* Record and aggregate each domain once powered up */
+    for (uint32_t domainId = 0U; domainId < 32U; domainId++)
+    {
+        if ((status == SM_ERR_SUCCESS)
+            && ((domainMask & (1UL << domainId)) != 0U))
         {
-            newPowerState = MAX(newPowerState, s_powerState[domainId][lm]);
-        }
+            uint8_t newPowerState = 0U;
 
-        /* Inform device of power state, device will check if changed */
-        status = SM_POWERSTATESET(domainId, newPowerState);
+            status = LMM_PowerStateAggregate(lmId, domainId,
+                DEV_SM_POWER_STATE_ON, &newPowerState);
+        }
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -133,3 +193,62 @@ int32_t LMM_PowerStateGet(uint32_t lmId, uint32_t domainId,
     return SM_POWERSTATEGET(domainId, powerState);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report power transition completion                                       */
+/*--------------------------------------------------------------------------*/
+void LMM_PowerStateComplete(uint32_t domainId, int32_t status)
+{
+    /* Dispatch for all LM */
+    for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+    {
+        lmm_rpc_trigger_t trigger =
+        {
+            .event = LMM_TRIGGER_POWER,
+            .parm[0] = domainId,
+            .parm[1] = (uint32_t) status
+        };
+
+        (void) LMM_RpcNotificationTrigger(dstLm, &trigger);
+    }
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Record LM power state and return the aggregate                           */
+/*--------------------------------------------------------------------------*/
+static int32_t LMM_PowerStateAggregate(uint32_t lmId, uint32_t domainId,
+    uint8_t powerState, uint8_t *newPowerState)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check parameters */
+    if (lmId >= SM_NUM_LM)
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Check parameters */
+    if ((status == SM_ERR_SUCCESS) && (domainId >= SM_NUM_POWER))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Record new state */
+        s_powerState[domainId][lmId] = (uint8_t) (powerState & 0xFFU);
+
+        /* Aggregate power state */
+        *newPowerState = 0U;
+        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+        {
+            *newPowerState = MAX(*newPowerState,
+                s_powerState[domainId][lm]);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
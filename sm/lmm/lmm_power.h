@@ -125,6 +125,51 @@ int32_t LMM_PowerStateNameGet(uint32_t lmId, uint32_t powerState,
 int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
     uint8_t powerState);
 
+/*!
+ * Start setting an LM power domain state.
+ *
+ * @param[in]     lmId        LM requesting the operation
+ * @param[in]     domainId    Identifier for the power domain
+ * @param[in]     powerState  Requested power state
+ * @param[out]    pending     Return true if the transition is in flight
+ *
+ * This function is the same as LMM_PowerStateSet() except the device
+ * transition is split-phase (see ::SM_POWERSTATESETASYNC). If \a pending
+ * is returned true then completion is later reported to all LMs via an
+ * ::LMM_TRIGGER_POWER RPC trigger.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the power state is set or in flight.
+ * - ::SM_ERR_INVALID_PARAMETERS if \a lmId out of range
+ * - ::SM_ERR_NOT_FOUND if \a domainId out of range
+ * - others returned by ::SM_POWERSTATESETASYNC
+ */
+int32_t LMM_PowerStateSetAsync(uint32_t lmId, uint32_t domainId,
+    uint8_t powerState, bool *pending);
+
+/*!
+ * Power up a set of LM power domains.
+ *
+ * @param[in]     lmId        LM requesting the operation
+ * @param[in]     domainMask  Mask of power domains to turn on
+ *
+ * This function is the same as calling LMM_PowerStateSet() with
+ * DEV_SM_POWER_STATE_ON for each domain in \a domainMask, except the
+ * device ramps independent domains together (see ::SM_POWERUPBATCH).
+ * The ON state of the LM is only recorded if the device call succeeds.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the power states are set.
+ * - ::SM_ERR_INVALID_PARAMETERS if \a lmId out of range
+ * - ::SM_ERR_NOT_FOUND if a domain in \a domainMask is out of range
+ * - others returned by ::SM_POWERUPBATCH
+ */
+int32_t LMM_PowerUpBatch(uint32_t lmId, uint32_t domainMask);
+
 /*!
  * Reset an LM power domain state.
  *
@@ -156,6 +201,17 @@ void LMM_PowerStateReset(uint32_t lmId, uint32_t domainId);
 int32_t LMM_PowerStateGet(uint32_t lmId, uint32_t domainId,
     uint8_t *powerState);
 
+/*!
+ * Report power transition completion.
+ *
+ * This function reports completion of a split-phase power transition to
+ * the LMM. It is forwarded to the RPC of all LMs.
+ *
+ * @param[in]  domainId   Power domain that completed
+ * @param[in]  status     Status of the transition
+ */
+void LMM_PowerStateComplete(uint32_t domainId, int32_t status);
+
 #endif /* LMM_POWER_H */
 
 /** @} */
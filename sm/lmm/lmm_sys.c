@@ -42,11 +42,36 @@
 #include "sm.h"
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "binlog.h"
+#include "timer.h"
+#include "fsl_fixmath.h"
 
 /* Local defines */
 
+/* Max graceful deadline in mS */
+#define LMM_DEADLINE_MAX  (UINT32_MAX / 1000U)
+
 /* Local types */
 
+/* Graceful operation deadline */
+typedef struct
+{
+    /* Deadline timer */
+    timer_work_t timer;
+    /* Record to store if forced */
+    lmm_rst_rec_t rec;
+    /* Pending operation (LMM_TRIGGER_PARM_*) */
+    uint32_t event;
+    /* Requesting LM */
+    uint32_t lmId;
+    /* Requesting agent */
+    uint32_t agentId;
+    /* Deadline in mS */
+    uint32_t msec;
+    /* Number of expired deadlines */
+    uint32_t overruns;
+} lmm_deadline_t;
+
 /* Local variables */
 
 static uint32_t s_modeSel = 0U;
@@ -55,6 +80,7 @@ static int32_t s_lmError[SM_NUM_LM];
 static lmm_rst_rec_t s_lmBootReason[SM_NUM_LM];
 static lmm_rst_rec_t s_lmShutdownReason[SM_NUM_LM];
 static uint32_t s_cpuLm[SM_NUM_CPU];
+static lmm_deadline_t s_lmDeadline[SM_NUM_LM + 1U];
 
 /* Global variables */
 
@@ -67,6 +93,24 @@ static const lmm_startstop_t s_lmmStop[SM_LM_NUM_STOP] =
 {
     SM_LM_STOP_DATA
 };
+static const uint16_t s_lmmStartStep[SM_LM_NUM_START] =
+{
+    SM_LM_START_STEP_DATA
+};
+static const uint16_t s_lmmStopStep[SM_LM_NUM_STOP] =
+{
+    SM_LM_STOP_STEP_DATA
+};
+static const lmm_prog_t s_lmmStartProg[SM_NUM_LM][SM_LM_NUM_MSEL] =
+{
+    SM_LM_START_PROG_DATA
+};
+static const lmm_prog_t s_lmmStopProg[SM_NUM_LM][SM_LM_NUM_MSEL] =
+{
+    SM_LM_STOP_PROG_DATA
+};
+static uint32_t s_lmmStartUsec[SM_LM_NUM_START];
+static uint32_t s_lmmStopUsec[SM_LM_NUM_STOP];
 
 /* Local functions */
 
@@ -74,10 +118,17 @@ static int32_t LMM_DoBoot(lmm_rpc_trigger_t *trigger,
     const lmm_rst_rec_t *bootRec);
 static int32_t LMM_DoShutdown(lmm_rpc_trigger_t *trigger,
     const lmm_rst_rec_t *shutdownRec);
-static int32_t LM_ProcessStart(uint32_t lmId, uint32_t start, bool cpu);
-static int32_t LM_ProcessStop(uint32_t lmId, uint32_t stop);
+static void LMM_DeadlineStart(uint32_t idx, uint32_t msec, uint32_t event,
+    uint32_t lmId, uint32_t agentId, const lmm_rst_rec_t *rec);
+static void LMM_DeadlineExpire(uint32_t cookie);
+static int32_t LM_ProcessStart(uint32_t lmId, bool cpu);
+static int32_t LM_ProcessStop(uint32_t lmId, bool keepPd);
+static int32_t LM_ProcessVectors(uint32_t lmId, uint32_t cpuMask);
+static uint32_t LM_UsecSince(uint64_t *usec);
 static int32_t LM_ClockStart(uint32_t lmId, uint32_t rsrc, uint32_t numArg,
     const uint64_t *arg);
+static bool LM_PerfSame(uint32_t lmId, uint32_t rsrc, uint32_t level);
+static bool LM_VoltSame(uint32_t lmId, uint32_t rsrc, uint8_t voltMode);
 
 /*--------------------------------------------------------------------------*/
 /* Init LMM system                                                          */
@@ -100,6 +151,12 @@ int32_t LMM_SystemInit(void)
         s_lmShutdownReason[lmId] = shutdownRec;
     }
 
+    /* Init graceful deadlines, last is for the system */
+    for (uint32_t idx = 0U; idx <= SM_NUM_LM; idx++)
+    {
+        TIMER_WorkInit(&s_lmDeadline[idx].timer, LMM_DeadlineExpire, idx);
+    }
+
     /* Return status */
     return status;
 }
@@ -116,17 +173,22 @@ int32_t LMM_SystemModeSelSet(uint32_t mSel)
     {
         s_modeSel = mSel;
 
-        /* Loop over stop list to map CPUs to LM */
-        for (uint32_t idx = 0U; idx < SM_LM_NUM_STOP; idx++)
+        /* Loop over stop programs to map CPUs to LM */
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
         {
-            if ((s_lmmStop[idx].mSel == s_modeSel)
-                && (s_lmmStop[idx].ss == LMM_SS_CPU))
+            uint32_t cpuMask = s_lmmStopProg[lmId][s_modeSel].cpuMask;
+
+            for (uint32_t cpuId = 0U; cpuId < MIN(SM_NUM_CPU, 32U);
+                cpuId++)
             {
-                s_cpuLm[s_lmmStop[idx].rsrc] = s_lmmStop[idx].lmId;
+                if ((cpuMask & (1UL << cpuId)) != 0U)
+                {
+                    s_cpuLm[cpuId] = lmId;
 #ifdef DEBUG
-                printf("DEBUG: lmm/lmm_sys: LMM_SystemModeSelSet() cpuLmIdx(rsrc)=%d mapped to LM%d\n",
-                    s_lmmStop[idx].rsrc, s_lmmStop[idx].lmId);
+                    printf("DEBUG: lmm/lmm_sys: LMM_SystemModeSelSet() cpuLmIdx(rsrc)=%d mapped to LM%d\n",
+                        cpuId, lmId);
 #endif
+                }
             }
         }
     }
@@ -197,6 +259,9 @@ int32_t LMM_SystemShutdown(uint32_t lmId, uint32_t agentId,
     {
         lmm_rst_rec_t newShutdownRec = *shutdownRec;
 
+        /* Forced request supersedes a graceful one */
+        TIMER_Cancel(&s_lmDeadline[SM_NUM_LM].timer);
+
         /* Update record */
         if (newShutdownRec.reason == g_swReason.reason)
         {
@@ -217,6 +282,20 @@ int32_t LMM_SystemShutdown(uint32_t lmId, uint32_t agentId,
         /* Request system shutdown */
         status = SM_SYSTEMSHUTDOWN();
     }
+    else
+    {
+        uint32_t msec = 0U;
+
+        /* Wait for the slowest LM */
+        for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+        {
+            msec = MAX(msec, g_lmmConfig[dstLm].deadline);
+        }
+
+        /* Force shutdown if not done by the deadline */
+        LMM_DeadlineStart(SM_NUM_LM, msec, LMM_TRIGGER_PARM_SHUTDOWN, lmId,
+            agentId, shutdownRec);
+    }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
@@ -260,6 +339,9 @@ int32_t LMM_SystemReset(uint32_t lmId, uint32_t agentId, bool graceful,
     {
         lmm_rst_rec_t newResetRec = *resetRec;
 
+        /* Forced request supersedes a graceful one */
+        TIMER_Cancel(&s_lmDeadline[SM_NUM_LM].timer);
+
         /* Update record */
         if (newResetRec.reason == g_swReason.reason)
         {
@@ -281,6 +363,20 @@ int32_t LMM_SystemReset(uint32_t lmId, uint32_t agentId, bool graceful,
         /* Request system reset */
         status = SM_SYSTEMRESET();
     }
+    else
+    {
+        uint32_t msec = 0U;
+
+        /* Wait for the slowest LM */
+        for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+        {
+            msec = MAX(msec, g_lmmConfig[dstLm].deadline);
+        }
+
+        /* Force reset if not done by the deadline */
+        LMM_DeadlineStart(SM_NUM_LM, msec, LMM_TRIGGER_PARM_RESET, lmId,
+            agentId, resetRec);
+    }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
@@ -475,24 +571,15 @@ int32_t LM_SystemLmStatus(uint32_t lmId, uint32_t stateLm, uint32_t *state,
 int32_t LMM_SystemLmCheck(uint32_t bootLm)
 {
     int32_t status = SM_ERR_SUCCESS;
-    uint32_t idx = g_lmmConfig[bootLm].start - 1U;
+    uint32_t cpuMask = s_lmmStartProg[bootLm][s_modeSel].cpuMask;
 
-    /* Loop over start list */
-    while (idx < SM_LM_NUM_START)
+    /* Loop over CPUs started for this mSel */
+    for (uint32_t cpuId = 0U; cpuId < MIN(SM_NUM_CPU, 32U); cpuId++)
     {
-        const lmm_startstop_t *ptr = &s_lmmStart[idx];
-
-        /* End for this LM */
-        if (ptr->lmId != bootLm)
-        {
-            break;
-        }
-
-        /* CPU command for this mSel? */
-        if ((ptr->mSel == s_modeSel) && (ptr->ss == LMM_SS_CPU))
+        if ((cpuMask & (1UL << cpuId)) != 0U)
         {
             /* Check vector */
-            status = LMM_CpuBootCheck(ptr->lmId, ptr->rsrc);
+            status = LMM_CpuBootCheck(bootLm, cpuId);
 
             /* Translate and exit */
             if (status != SM_ERR_SUCCESS)
@@ -501,9 +588,6 @@ int32_t LMM_SystemLmCheck(uint32_t bootLm)
                 break;
             }
         }
-
-        /* Next entry */
-        idx++;
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -518,31 +602,12 @@ int32_t LMM_SystemLmCheck(uint32_t bootLm)
 bool LM_CpuCheck(uint32_t lmId, uint32_t cpuId)
 {
     bool rtn = false;
-    uint32_t idx = g_lmmConfig[lmId].start - 1U;
 
-    /* Loop over start list to check for CPU */
-    while ((!rtn) && (idx < SM_LM_NUM_START))
+    /* Check start program for CPU */
+    if (cpuId < 32U)
     {
-        const lmm_startstop_t *ptr = &s_lmmStart[idx];
-
-        /* End for this LM? */
-        if (ptr->lmId != lmId)
-        {
-            break;
-        }
-
-        /* For this mode? */
-        if (ptr->mSel == s_modeSel)
-        {
-            /* Process start command */
-            if ((ptr->ss == LMM_SS_CPU) && (ptr->rsrc == cpuId))
-            {
-                rtn = true;
-            }
-        }
-
-        /* Next entry */
-        idx++;
+        rtn = ((s_lmmStartProg[lmId][s_modeSel].cpuMask
+            & (1UL << cpuId)) != 0U);
     }
 
     /* Return state */
@@ -559,11 +624,7 @@ int32_t LMM_SystemLmPowerOn(uint32_t lmId, uint32_t agentId, uint32_t pwrLm)
     if (s_lmState[pwrLm] == LMM_STATE_LM_OFF)
     {
         /* Start resources minus CPU starts */
-        if (g_lmmConfig[pwrLm].start != 0U)
-        {
-            status = LM_ProcessStart(pwrLm,
-                g_lmmConfig[pwrLm].start - 1U, false);
-        }
+        status = LM_ProcessStart(pwrLm, false);
 
         if (status == SM_ERR_SUCCESS)
         {
@@ -577,9 +638,8 @@ int32_t LMM_SystemLmPowerOn(uint32_t lmId, uint32_t agentId, uint32_t pwrLm)
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LMM_SystemLmPowerOn() powered on LM%d, agentId=0x%X, status=0x%X\n", pwrLm, agentId, status);
-#endif
+    BINLOG3(BINLOG_ID_LM_POWER_ON, "LM%u power on, agent=%u, status=%d",
+        pwrLm, agentId, status);
 
     /* Return status */
     return status;
@@ -616,9 +676,8 @@ int32_t LMM_SystemLmBoot(uint32_t lmId, uint32_t agentId, uint32_t bootLm,
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LMM_SystemLmBoot() booted LM%d, agentId=0x%X, status=0x%X\n", bootLm, agentId, status);
-#endif
+    BINLOG3(BINLOG_ID_LM_BOOT, "LM%u boot, agent=%u, status=%d",
+        bootLm, agentId, status);
 
     /* Return status */
     return status;
@@ -666,13 +725,18 @@ int32_t LMM_SystemLmShutdown(uint32_t lmId, uint32_t agentId,
 
             status = LMM_DoShutdown(&trigger, shutdownRec);
         }
+        else
+        {
+            /* Force shutdown if not done by the deadline */
+            LMM_DeadlineStart(shutdownLm, g_lmmConfig[shutdownLm].deadline,
+                trigger.parm[0], lmId, agentId, shutdownRec);
+        }
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LMM_SystemLmShutdown() shutdown LM%d, agentId=0x%X, status=0x%X\n", shutdownLm, agentId, status);
-#endif
+    BINLOG3(BINLOG_ID_LM_SHUTDOWN, "LM%u shutdown, agent=%u, status=%d",
+        shutdownLm, agentId, status);
 
     /* Return status */
     return status;
@@ -731,12 +795,20 @@ int32_t LMM_SystemLmReset(uint32_t lmId, uint32_t agentId, uint32_t resetLm,
                 status = LMM_DoBoot(&trigger, resetRec);
             }
         }
+        else if (s_lmState[resetLm] != LMM_STATE_LM_OFF)
+        {
+            /* Force reset if not done by the deadline */
+            LMM_DeadlineStart(resetLm, g_lmmConfig[resetLm].deadline,
+                trigger.parm[0], lmId, agentId, resetRec);
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
     }
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LMM_SystemLmReset() reset LM%d, agentId=0x%X, warm=%d, graceful=%d, status=0x%X\n",
-        resetLm, agentId, warm ? 1 : 0, graceful ? 1 : 0, status);
-#endif
+    BINLOG3(BINLOG_ID_LM_RESET, "LM%u reset, warm|gful<<1=%u, status=%d",
+        resetLm, (warm ? 1U : 0U) | (graceful ? 2U : 0U), status);
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
@@ -774,9 +846,8 @@ int32_t LMM_SystemLmSuspend(uint32_t lmId, uint32_t agentId,
         (void) LMM_RpcNotificationTrigger(suspendLm, &trigger);
     }
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LMM_SystemLmSuspend() suspend LM%d, agentId=0x%X, status=0x%X\n", suspendLm, agentId, status);
-#endif
+    BINLOG3(BINLOG_ID_LM_SUSPEND, "LM%u suspend, agent=%u, status=%d",
+        suspendLm, agentId, status);
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
@@ -811,9 +882,8 @@ int32_t LMM_SystemLmWake(uint32_t lmId, uint32_t agentId, uint32_t wakeLm)
         (void) LMM_RpcNotificationTrigger(wakeLm, &trigger);
     }
 
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LMM_SystemLmWake() wake LM%d, agentId=0x%X, status=0x%X\n", wakeLm, agentId, status);
-#endif
+    BINLOG3(BINLOG_ID_LM_WAKE, "LM%u wake, agent=%u, status=%d",
+        wakeLm, agentId, status);
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
 
@@ -853,6 +923,91 @@ int32_t LM_SystemLmReason(uint32_t lmId, uint32_t reasonLm,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get LM graceful deadline state                                           */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_SystemLmDeadlineGet(uint32_t lmId, uint32_t *remaining,
+    uint32_t *overruns)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check LM */
+    if (lmId < SM_NUM_LM)
+    {
+        const lmm_deadline_t *dl = &s_lmDeadline[lmId];
+
+        *remaining = 0U;
+        *overruns = dl->overruns;
+
+        /* Pending? */
+        if (dl->timer.state != TIMER_STATE_IDLE)
+        {
+            uint64_t usec = DEV_SM_Usec64Get();
+
+            /* Round up so pending is never 0 */
+            if (dl->timer.deadline > usec)
+            {
+                *remaining = (uint32_t) FIXMATH_DivU64U16(
+                    dl->timer.deadline - usec + 999ULL, 1000U);
+            }
+        }
+    }
+    else
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get LM start/stop program step                                           */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_SystemLmStepGet(uint32_t lmId, bool start, uint32_t step,
+    const lmm_startstop_t **ss, uint32_t *usec)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check LM */
+    if (lmId < SM_NUM_LM)
+    {
+        const lmm_prog_t *prog = start ? &s_lmmStartProg[lmId][s_modeSel]
+            : &s_lmmStopProg[lmId][s_modeSel];
+
+        /* Check step */
+        if (step < prog->num)
+        {
+            uint32_t idx;
+
+            /* Return step and time */
+            if (start)
+            {
+                idx = s_lmmStartStep[U32(prog->first) + step];
+                *ss = &s_lmmStart[idx];
+                *usec = s_lmmStartUsec[idx];
+            }
+            else
+            {
+                idx = s_lmmStopStep[U32(prog->first) + step];
+                *ss = &s_lmmStop[idx];
+                *usec = s_lmmStopUsec[idx];
+            }
+        }
+        else
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+    }
+    else
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Report a change in CPU run mode                                          */
 /*--------------------------------------------------------------------------*/
@@ -1068,11 +1223,7 @@ static int32_t LMM_DoBoot(lmm_rpc_trigger_t *trigger,
         || (s_lmState[bootLm] == LMM_STATE_LM_POWERED))
     {
         /* Start resources */
-        if (g_lmmConfig[bootLm].start != 0U)
-        {
-            status = LM_ProcessStart(bootLm,
-                g_lmmConfig[bootLm].start - 1U, true);
-        }
+        status = LM_ProcessStart(bootLm, true);
 
         if (status == SM_ERR_SUCCESS)
         {
@@ -1121,12 +1272,12 @@ static int32_t LMM_DoShutdown(lmm_rpc_trigger_t *trigger,
 
     if (s_lmState[shutdownLm] != LMM_STATE_LM_OFF)
     {
+        /* Keep power domains on for a warm reset? */
+        bool keepPd = (trigger->parm[0] == LMM_TRIGGER_PARM_LM_WARM_RESET)
+            && (g_lmmConfig[shutdownLm].warm == LMM_WARM_PD);
+
         /* Stop resources */
-        if (g_lmmConfig[shutdownLm].stop != 0U)
-        {
-            status = LM_ProcessStop(shutdownLm,
-                g_lmmConfig[shutdownLm].stop - 1U);
-        }
+        status = LM_ProcessStop(shutdownLm, keepPd);
 
         /* Reset the RPC configuration */
         if (status == SM_ERR_SUCCESS)
@@ -1151,6 +1302,9 @@ static int32_t LMM_DoShutdown(lmm_rpc_trigger_t *trigger,
             s_lmState[shutdownLm] = LMM_STATE_LM_OFF;
             s_lmBootReason[shutdownLm].valid = false;
 
+            /* Graceful operation done */
+            TIMER_Cancel(&s_lmDeadline[shutdownLm].timer);
+
             /* Record shutdown reason */
             s_lmShutdownReason[shutdownLm] = *shutdownRec;
             if (shutdownRec->reason == g_swReason.reason)
@@ -1171,68 +1325,137 @@ static int32_t LMM_DoShutdown(lmm_rpc_trigger_t *trigger,
 }
 
 /*--------------------------------------------------------------------------*/
-/* Process start list                                                       */
+/* Start graceful deadline                                                  */
 /*--------------------------------------------------------------------------*/
-static int32_t LM_ProcessStart(uint32_t lmId, uint32_t start, bool cpu)
+static void LMM_DeadlineStart(uint32_t idx, uint32_t msec, uint32_t event,
+    uint32_t lmId, uint32_t agentId, const lmm_rst_rec_t *rec)
 {
-    int32_t status = SM_ERR_SUCCESS;
-    uint32_t idx = start;
-
-#ifdef DEBUG
-    printf("DEBUG: lmm/lmm_sys: LM_ProcessStart() starting LM%d, startIdx=%u iscpu=%d\n", lmId, start, cpu ? 1 : 0);
-#endif
-
-    /* Loop over start list to load reset vectors */
-    while ((status == SM_ERR_SUCCESS) && (idx < SM_LM_NUM_START))
+    /* Deadline configured? */
+    if (msec != 0U)
     {
-        const lmm_startstop_t *ptr = &s_lmmStart[idx];
+        lmm_deadline_t *dl = &s_lmDeadline[idx];
 
-        /* End for this LM? */
-        if (ptr->lmId != lmId)
-        {
-            break;
-        }
+        /* Save forced operation */
+        dl->rec = *rec;
+        dl->event = event;
+        dl->lmId = lmId;
+        dl->agentId = agentId;
 
-        /* For this mode? */
-        if (ptr->mSel == s_modeSel)
+        /* Repeated requests do not extend the deadline */
+        if (dl->timer.state == TIMER_STATE_IDLE)
         {
-            /* Process start command */
-            if (ptr->ss == LMM_SS_CPU)
-            {
-                status = LMM_CpuResetVectorReset(ptr->lmId, ptr->rsrc,
-                    true);
-            }
+            dl->msec = MIN(msec, LMM_DEADLINE_MAX);
+            TIMER_Start(&dl->timer, dl->msec * 1000U);
         }
+    }
+}
 
-        /* Next entry */
-        idx++;
+/*--------------------------------------------------------------------------*/
+/* Graceful deadline expired                                                */
+/*--------------------------------------------------------------------------*/
+static void LMM_DeadlineExpire(uint32_t cookie)
+{
+    lmm_deadline_t *dl = &s_lmDeadline[cookie];
+    lmm_rst_rec_t rec = dl->rec;
+
+    /* Record overrun */
+    dl->overruns++;
+    rec.extLen = 1U;
+    rec.extInfo[0] = dl->msec;
+
+    BINLOG3(BINLOG_ID_LM_DEADLINE, "LM%u deadline, event=0x%08X, mS=%u",
+        cookie, dl->event, dl->msec);
+
+    /* Force operation */
+    switch (dl->event)
+    {
+        case LMM_TRIGGER_PARM_LM_SHUTDOWN:
+            (void) LMM_SystemLmShutdown(dl->lmId, dl->agentId, cookie,
+                false, &rec);
+            break;
+        case LMM_TRIGGER_PARM_LM_COLD_RESET:
+            (void) LMM_SystemLmReset(dl->lmId, dl->agentId, cookie,
+                false, false, &rec);
+            break;
+        case LMM_TRIGGER_PARM_LM_WARM_RESET:
+            (void) LMM_SystemLmReset(dl->lmId, dl->agentId, cookie,
+                true, false, &rec);
+            break;
+        case LMM_TRIGGER_PARM_SHUTDOWN:
+            (void) LMM_SystemShutdown(dl->lmId, dl->agentId, false, &rec);
+            break;
+        case LMM_TRIGGER_PARM_RESET:
+            (void) LMM_SystemReset(dl->lmId, dl->agentId, false, &rec);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
     }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Run start program                                                        */
+/*--------------------------------------------------------------------------*/
+static int32_t LM_ProcessStart(uint32_t lmId, bool cpu)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    const lmm_prog_t *prog = &s_lmmStartProg[lmId][s_modeSel];
+    uint32_t pdMask = 0U;
+    uint32_t pdIdx = 0U;
+    uint64_t usec;
 
-    /* Loop over start list */
-    idx = start;
-    while ((status == SM_ERR_SUCCESS) && (idx < SM_LM_NUM_START))
+    if (prog->num != 0U)
     {
+        BINLOG3(BINLOG_ID_LM_START, "LM%u start, idx=%u, cpu=%u", lmId,
+            s_lmmStartStep[prog->first], cpu ? 1U : 0U);
+
+        /* Load reset vectors */
+        status = LM_ProcessVectors(lmId, prog->cpuMask);
+    }
+
+    /* Loop over program steps */
+    usec = DEV_SM_Usec64Get();
+    for (uint32_t step = prog->first; (status == SM_ERR_SUCCESS)
+        && (step < (U32(prog->first) + U32(prog->num))); step++)
+    {
+        uint32_t idx = s_lmmStartStep[step];
         const lmm_startstop_t *ptr = &s_lmmStart[idx];
 
-        /* End for this LM? */
-        if (ptr->lmId != lmId)
+        /* Power up collected domains before any other command */
+        if ((ptr->ss != LMM_SS_PD) && (pdMask != 0U))
         {
-            break;
+            status = LMM_PowerUpBatch(lmId, pdMask);
+            pdMask = 0U;
+
+            /* Charge to the last domain step */
+            s_lmmStartUsec[pdIdx] += LM_UsecSince(&usec);
         }
 
-        /* For this mode? */
-        if (ptr->mSel == s_modeSel)
+        if (status == SM_ERR_SUCCESS)
         {
             /* Process start command */
             switch (ptr->ss)
             {
                 case LMM_SS_PD:
-                    status = LMM_PowerStateSet(ptr->lmId, ptr->rsrc,
-                        DEV_SM_POWER_STATE_ON);
+                    /* Collect consecutive domains to ramp together */
+                    if (ptr->rsrc < 32U)
+                    {
+                        pdMask |= 1UL << ptr->rsrc;
+                        pdIdx = idx;
+                    }
+                    else
+                    {
+                        status = LMM_PowerStateSet(ptr->lmId, ptr->rsrc,
+                            DEV_SM_POWER_STATE_ON);
+                    }
                     break;
                 case LMM_SS_PERF:
-                    status = LMM_PerfLevelSet(ptr->lmId, ptr->rsrc,
-                        U64_U32(ptr->arg[0]), true);
+                    if (!LM_PerfSame(ptr->lmId, ptr->rsrc,
+                        U64_U32(ptr->arg[0])))
+                    {
+                        status = LMM_PerfLevelSet(ptr->lmId, ptr->rsrc,
+                            U64_U32(ptr->arg[0]), true);
+                    }
                     break;
                 case LMM_SS_CLK:
                     status = LM_ClockStart(ptr->lmId, ptr->rsrc,
@@ -1245,8 +1468,12 @@ static int32_t LM_ProcessStart(uint32_t lmId, uint32_t start, bool cpu)
                     }
                     break;
                 case LMM_SS_VOLT:
-                    status = LMM_VoltageModeSet(ptr->lmId, ptr->rsrc,
-                        U64_U8(ptr->arg[0]));
+                    if (!LM_VoltSame(ptr->lmId, ptr->rsrc,
+                        U64_U8(ptr->arg[0])))
+                    {
+                        status = LMM_VoltageModeSet(ptr->lmId, ptr->rsrc,
+                            U64_U8(ptr->arg[0]));
+                    }
                     break;
                 case LMM_SS_RST:
                     {
@@ -1275,10 +1502,19 @@ static int32_t LM_ProcessStart(uint32_t lmId, uint32_t start, bool cpu)
                     status = SM_ERR_NOT_SUPPORTED;
                     break;
             }
+
+            /* Record step time */
+            s_lmmStartUsec[idx] = LM_UsecSince(&usec);
         }
+    }
+
+    /* Power up any remaining collected domains */
+    if ((status == SM_ERR_SUCCESS) && (pdMask != 0U))
+    {
+        status = LMM_PowerUpBatch(lmId, pdMask);
 
-        /* Next entry */
-        idx++;
+        /* Charge to the last domain step */
+        s_lmmStartUsec[pdIdx] += LM_UsecSince(&usec);
     }
 
     /* Return status */
@@ -1286,112 +1522,124 @@ static int32_t LM_ProcessStart(uint32_t lmId, uint32_t start, bool cpu)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Process stop list                                                        */
+/* Run stop program                                                         */
 /*--------------------------------------------------------------------------*/
-static int32_t LM_ProcessStop(uint32_t lmId, uint32_t stop)
+static int32_t LM_ProcessStop(uint32_t lmId, bool keepPd)
 {
     int32_t status = SM_ERR_SUCCESS;
-    uint32_t idx = stop;
+    const lmm_prog_t *prog = &s_lmmStopProg[lmId][s_modeSel];
+    uint64_t usec;
+
+    /* Load reset vectors */
+    (void) LM_ProcessVectors(lmId, prog->cpuMask);
 
-    /* Loop over stop list to load reset vectors */
-    while (idx < SM_LM_NUM_STOP)
+    /* Loop over program steps */
+    usec = DEV_SM_Usec64Get();
+    for (uint32_t step = prog->first; (status == SM_ERR_SUCCESS)
+        && (step < (U32(prog->first) + U32(prog->num))); step++)
     {
+        uint32_t idx = s_lmmStopStep[step];
         const lmm_startstop_t *ptr = &s_lmmStop[idx];
 
-        /* End for this LM? */
-        if (ptr->lmId != lmId)
+        /* Process stop command */
+        switch (ptr->ss)
         {
-            break;
-        }
+            case LMM_SS_PD:
+                if (!keepPd)
+                {
+                    (void) LMM_PowerStateSet(ptr->lmId, ptr->rsrc,
+                        DEV_SM_POWER_STATE_OFF);
+                }
+                break;
+            case LMM_SS_PERF:
+                (void) LMM_PerfLevelSet(ptr->lmId, ptr->rsrc,
+                    U64_U32(ptr->arg[0]), true);
+                break;
+            case LMM_SS_CLK:
+                (void) LMM_ClockEnable(ptr->lmId, ptr->rsrc, false);
+                break;
+            case LMM_SS_CPU:
+                (void) LMM_CpuStop(ptr->lmId, ptr->rsrc);
+                break;
+            case LMM_SS_VOLT:
+                (void) LMM_VoltageModeSet(ptr->lmId, ptr->rsrc,
+                    U64_U8(ptr->arg[0]));
+                break;
+            case LMM_SS_RST:
+                {
+                    bool assertNegate = ((ptr->arg[0] & 0x1U) != 0U);
+                    bool toggle = ((ptr->arg[0] & 0x2U) != 0U);
 
-        /* For this mode? */
-        if (ptr->mSel == s_modeSel)
-        {
-            /* Process stop command */
-            if (ptr->ss == LMM_SS_CPU)
-            {
-                (void) LMM_CpuResetVectorReset(ptr->lmId, ptr->rsrc,
-                    true);
-            }
+                    (void) LMM_ResetDomain(ptr->lmId, ptr->rsrc,
+                        UINT64_L(ptr->arg[1]), toggle, assertNegate);
+                }
+                break;
+            case LMM_SS_CTRL:
+                {
+                    uint32_t val[LMM_MAX_ARG];
+
+                    /* Copy array */
+                    for (uint32_t etr = 0U; etr < LMM_MAX_ARG; etr++)
+                    {
+                        val[etr] = UINT64_L(ptr->arg[etr]);
+                    }
+
+                    status = LMM_MiscControlSet(ptr->lmId, ptr->rsrc,
+                        (uint32_t) ptr->numArg, val);
+                }
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
         }
 
-        /* Next entry */
-        idx++;
+        /* Record step time */
+        s_lmmStopUsec[idx] = LM_UsecSince(&usec);
     }
 
-    /* Loop over stop list */
-    idx = stop;
-    while ((status == SM_ERR_SUCCESS) && (idx < SM_LM_NUM_STOP))
-    {
-        const lmm_startstop_t *ptr = &s_lmmStop[idx];
+    /* Return status */
+    return status;
+}
 
-        /* End for this LM? */
-        if (ptr->lmId != lmId)
-        {
-            break;
-        }
+/*--------------------------------------------------------------------------*/
+/* Load reset vectors of program CPUs                                       */
+/*--------------------------------------------------------------------------*/
+static int32_t LM_ProcessVectors(uint32_t lmId, uint32_t cpuMask)
+{
+    int32_t status = SM_ERR_SUCCESS;
 
-        /* For this mode? */
-        if (ptr->mSel == s_modeSel)
+    /* Loop over CPUs, return first error */
+    for (uint32_t cpuId = 0U; cpuId < MIN(SM_NUM_CPU, 32U); cpuId++)
+    {
+        if ((cpuMask & (1UL << cpuId)) != 0U)
         {
-            /* Process stop command */
-            switch (ptr->ss)
-            {
-                case LMM_SS_PD:
-                    (void) LMM_PowerStateSet(ptr->lmId, ptr->rsrc,
-                        DEV_SM_POWER_STATE_OFF);
-                    break;
-                case LMM_SS_PERF:
-                    (void) LMM_PerfLevelSet(ptr->lmId, ptr->rsrc,
-                        U64_U32(ptr->arg[0]), true);
-                    break;
-                case LMM_SS_CLK:
-                    (void) LMM_ClockEnable(ptr->lmId, ptr->rsrc, false);
-                    break;
-                case LMM_SS_CPU:
-                    (void) LMM_CpuStop(ptr->lmId, ptr->rsrc);
-                    break;
-                case LMM_SS_VOLT:
-                    (void) LMM_VoltageModeSet(ptr->lmId, ptr->rsrc,
-                        U64_U8(ptr->arg[0]));
-                    break;
-                case LMM_SS_RST:
-                    {
-                        bool assertNegate = ((ptr->arg[0] & 0x1U) != 0U);
-                        bool toggle = ((ptr->arg[0] & 0x2U) != 0U);
-
-                        (void) LMM_ResetDomain(ptr->lmId, ptr->rsrc,
-                            UINT64_L(ptr->arg[1]), toggle, assertNegate);
-                    }
-                    break;
-                case LMM_SS_CTRL:
-                    {
-                        uint32_t val[LMM_MAX_ARG];
+            int32_t cpuStatus = LMM_CpuResetVectorReset(lmId, cpuId, true);
 
-                        /* Copy array */
-                        for (uint32_t etr = 0U; etr < LMM_MAX_ARG; etr++)
-                        {
-                            val[etr] = UINT64_L(ptr->arg[etr]);
-                        }
-
-                        status = LMM_MiscControlSet(ptr->lmId, ptr->rsrc,
-                            (uint32_t) ptr->numArg, val);
-                    }
-                    break;
-                default:
-                    status = SM_ERR_NOT_SUPPORTED;
-                    break;
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = cpuStatus;
             }
         }
-
-        /* Next entry */
-        idx++;
     }
 
     /* Return status */
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Return usec since the last call and update the time                      */
+/*--------------------------------------------------------------------------*/
+static uint32_t LM_UsecSince(uint64_t *usec)
+{
+    uint64_t now = DEV_SM_Usec64Get();
+    uint32_t delta = (uint32_t) (now - *usec);
+
+    *usec = now;
+
+    /* Return elapsed time */
+    return delta;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Start clock                                                              */
 /*--------------------------------------------------------------------------*/
@@ -1415,6 +1663,30 @@ static int32_t LM_ClockStart(uint32_t lmId, uint32_t rsrc, uint32_t numArg,
         }
     }
 
+    /* Skip parent already set */
+    if (parent < SM_NUM_CLOCK)
+    {
+        uint32_t curParent;
+
+        if ((LMM_ClockParentGet(lmId, rsrc, &curParent) == SM_ERR_SUCCESS)
+            && (curParent == parent))
+        {
+            parent = SM_NUM_CLOCK;
+        }
+    }
+
+    /* Skip rate already set, only valid if parent not changing */
+    if ((rate != 0ULL) && (parent >= SM_NUM_CLOCK))
+    {
+        uint64_t curRate;
+
+        if ((LMM_ClockRateGet(lmId, rsrc, &curRate) == SM_ERR_SUCCESS)
+            && (curRate == rate))
+        {
+            rate = 0ULL;
+        }
+    }
+
     /* Turn clock off if we will be changing */
     if ((parent < SM_NUM_CLOCK) || (rate != 0ULL))
     {
@@ -1445,3 +1717,33 @@ static int32_t LM_ClockStart(uint32_t lmId, uint32_t rsrc, uint32_t numArg,
     return status;
 }
 
+
+/*--------------------------------------------------------------------------*/
+/* Check if a perf level start step would not change anything               */
+/*--------------------------------------------------------------------------*/
+static bool LM_PerfSame(uint32_t lmId, uint32_t rsrc, uint32_t level)
+{
+    uint32_t vote = 0U;
+    uint32_t curLevel = 0U;
+
+    /* Same if already voted by the LM and set in the device */
+    return (LMM_PerfLevelVoteGet(lmId, rsrc, &vote) == SM_ERR_SUCCESS)
+        && (vote == level)
+        && (LMM_PerfLevelGet(lmId, rsrc, &curLevel) == SM_ERR_SUCCESS)
+        && (curLevel == level);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if a voltage mode start step would not change anything             */
+/*--------------------------------------------------------------------------*/
+static bool LM_VoltSame(uint32_t lmId, uint32_t rsrc, uint8_t voltMode)
+{
+    uint8_t vote = 0U;
+    uint8_t curMode = 0U;
+
+    /* Same if already voted by the LM and set in the device */
+    return (LMM_VoltageModeVoteGet(lmId, rsrc, &vote) == SM_ERR_SUCCESS)
+        && (vote == voltMode)
+        && (LMM_VoltageModeGet(lmId, rsrc, &curMode) == SM_ERR_SUCCESS)
+        && (curMode == voltMode);
+}
@@ -51,6 +51,8 @@
 
 #include "sm.h"
 #include "dev_sm_api.h"
+#include "config_lmm.h"
+#include "lmm_config.h"
 
 /* Defines */
 
@@ -190,6 +192,10 @@ int32_t LMM_SystemRstComp(const lmm_rst_rec_t *resetRec);
  * notifications, saves the shutdown record, and shuts down
  * the system.
  *
+ * A graceful request only notifies the LMs. If not done by the largest
+ * configured LM deadline, the shutdown is forced and the record stored
+ * with extLen = 1 and extInfo[0] = the deadline in mS.
+ *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
  * Return errors (see @ref STATUS "SM error codes"):
@@ -209,6 +215,9 @@ int32_t LMM_SystemShutdown(uint32_t lmId, uint32_t agentId,
  * Function to do a full system reset. Sends all the required
  * notifications, saves the reset record, and resets the system.
  *
+ * A graceful request is bounded by the LM deadlines the same way as
+ * LMM_SystemShutdown().
+ *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
  * Return errors (see @ref STATUS "SM error codes"):
@@ -440,6 +449,10 @@ int32_t LMM_SystemLmBoot(uint32_t lmId, uint32_t agentId, uint32_t bootLm,
  * sequence. If an error occurs, the LM state will not transition and the
  * error saved.
  *
+ * A graceful request only notifies the LM. If the LM has a configured
+ * deadline and is not shut down by then, the shutdown is forced. The
+ * stored record then has extLen = 1 and extInfo[0] = the deadline in mS.
+ *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  */
 int32_t LMM_SystemLmShutdown(uint32_t lmId, uint32_t agentId,
@@ -460,6 +473,9 @@ int32_t LMM_SystemLmShutdown(uint32_t lmId, uint32_t agentId,
  * stop and start sequence. If an error occurs, the LM state will not
  * transition and the error saved.
  *
+ * A graceful request is bounded by the LM deadline the same way as
+ * LMM_SystemLmShutdown().
+ *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  */
 int32_t LMM_SystemLmReset(uint32_t lmId, uint32_t agentId, uint32_t resetLm,
@@ -514,6 +530,42 @@ int32_t LMM_SystemLmWake(uint32_t lmId, uint32_t agentId, uint32_t wakeLm);
 int32_t LM_SystemLmReason(uint32_t lmId, uint32_t reasonLm,
     lmm_rst_rec_t *bootRec, lmm_rst_rec_t *shutdownRec);
 
+/*!
+ * Returns the graceful deadline state of an LM.
+ *
+ * @param[in]     lmId       LM to get state of
+ * @param[out]    remaining  Time left on a pending graceful operation
+ *                           in mS (0 = none pending)
+ * @param[out]    overruns   Number of graceful operations forced
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a lmId is invalid
+ */
+int32_t LMM_SystemLmDeadlineGet(uint32_t lmId, uint32_t *remaining,
+    uint32_t *overruns);
+
+/*!
+ * Returns a step of the start or stop program of an LM.
+ *
+ * @param[in]     lmId   LM to get step for
+ * @param[in]     start  True for start program, false for stop
+ * @param[in]     step   Step index in program for the current mSel
+ * @param[out]    ss     Pointer to return the start/stop entry
+ * @param[out]    usec   Time the step last took to execute in uS
+ *
+ * A program holds the start or stop entries of an LM for one mSel. The
+ * time of a batched power up is charged to its last power step.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a lmId or \a step is invalid
+ */
+int32_t LMM_SystemLmStepGet(uint32_t lmId, bool start, uint32_t step,
+    const lmm_startstop_t **ss, uint32_t *usec);
+
 /*!
  * Report a run mode change for a CPU.
  *
@@ -49,6 +49,8 @@
 
 /* Local variables */
 
+static uint8_t s_voltMode[SM_NUM_VOLT][SM_NUM_LM];
+
 /*--------------------------------------------------------------------------*/
 /* Init LMM voltage management                                              */
 /*--------------------------------------------------------------------------*/
@@ -111,7 +113,6 @@ int32_t LMM_VoltageModeSet(uint32_t lmId, uint32_t domainId,
 
     if (status == SM_ERR_SUCCESS)
     {
-        static uint8_t s_voltMode[SM_NUM_VOLT][SM_NUM_LM];
         uint8_t newVoltMode = DEV_SM_VOLT_MODE_OFF;
 
         /* Record new state */
@@ -143,6 +144,28 @@ int32_t LMM_VoltageModeGet(uint32_t lmId, uint32_t domainId,
     return SM_VOLTAGEMODEGET(domainId, voltMode);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get voltage mode voted by an LM                                          */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_VoltageModeVoteGet(uint32_t lmId, uint32_t domainId,
+    uint8_t *voltMode)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check parameters */
+    if ((lmId >= SM_NUM_LM) || (domainId >= SM_NUM_VOLT))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+    else
+    {
+        *voltMode = s_voltMode[domainId][lmId];
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set voltage level                                                        */
 /*--------------------------------------------------------------------------*/
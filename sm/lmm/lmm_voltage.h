@@ -172,6 +172,25 @@ int32_t LMM_VoltageModeSet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_VoltageModeGet(uint32_t lmId, uint32_t domainId,
     uint8_t *voltMode);
 
+/*!
+ * Get the voltage mode voted by an LM.
+ *
+ * @param[in]     lmId          LM requesting the operation
+ * @param[in]     domainId      Identifier for the voltage domain
+ * @param[out]    voltMode      Pointer to return the voltage mode
+ *
+ * This function returns the mode last recorded for \a lmId by
+ * LMM_VoltageModeSet(), not the aggregated mode of the domain.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the voltage mode is returned successfully.
+ * - ::SM_ERR_INVALID_PARAMETERS: if the parameters are invalid.
+ */
+int32_t LMM_VoltageModeVoteGet(uint32_t lmId, uint32_t domainId,
+    uint8_t *voltMode);
+
 /*!
  * Set an LM voltage level.
  *
@@ -38,6 +38,7 @@
 
 /* Includes */
 
+#include <sched.h>
 #include "sm.h"
 #include "mb_loopback.h"
 #include "config_mb_loopback.h"
@@ -51,8 +52,13 @@ static bool s_abortState[SM_NUM_MB_LOOPBACK];
 
 /* Local variables */
 
+static bool s_defer = false;
+static uint32_t s_pending[SM_NUM_MB_LOOPBACK];
+
 /* Local functions */
 
+static void MB_LOOPBACK_Dispatch(uint8_t inst, uint8_t db);
+
 /*--------------------------------------------------------------------------*/
 /* MB Init                                                                  */
 /*--------------------------------------------------------------------------*/
@@ -95,22 +101,25 @@ int32_t MB_LOOPBACK_DoorbellRing(uint8_t inst, uint8_t db)
         status = SM_ERR_OUT_OF_RANGE;
     }
 
-    /* Directly call service */
     if (status == SM_ERR_SUCCESS)
     {
-        static const mb_lb_config_t s_mbLbConfig[SM_NUM_MB_LOOPBACK] =
+        if (s_defer)
         {
-            SM_MB_LOOPBACK_CONFIG_DATA
-        };
-
-        /* Switch to allow easy addition of other transport protocols */
-        // coverity[misra_c_2012_rule_16_1_violation]
-        // coverity[misra_c_2012_rule_16_6_violation]
-        switch (s_mbLbConfig[inst].xportType[db])
+            /* Mark pending for MB_LOOPBACK_Service() */
+            (void) __atomic_fetch_or(&s_pending[inst], 1UL << db,
+                __ATOMIC_SEQ_CST);
+
+            /* Give up the CPU until the service thread takes it */
+            while ((__atomic_load_n(&s_pending[inst], __ATOMIC_SEQ_CST)
+                & (1UL << db)) != 0U)
+            {
+                (void) sched_yield();
+            }
+        }
+        else
         {
-            default:
-                RPC_SMT_Dispatch(s_mbLbConfig[inst].xportChannel[db]);
-                break;
+            /* Directly call service */
+            MB_LOOPBACK_Dispatch(inst, db);
         }
     }
 
@@ -118,6 +127,44 @@ int32_t MB_LOOPBACK_DoorbellRing(uint8_t inst, uint8_t db)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Defer doorbell service                                                   */
+/*--------------------------------------------------------------------------*/
+void MB_LOOPBACK_DeferSet(bool defer)
+{
+    /* Save defer mode */
+    __atomic_store_n(&s_defer, defer, __ATOMIC_SEQ_CST);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Service pending doorbells                                                */
+/*--------------------------------------------------------------------------*/
+uint32_t MB_LOOPBACK_Service(void)
+{
+    uint32_t num = 0U;
+
+    /* Loop over instances */
+    for (uint8_t inst = 0U; inst < SM_NUM_MB_LOOPBACK; inst++)
+    {
+        /* Grab and clear pending doorbells */
+        uint32_t pending = __atomic_exchange_n(&s_pending[inst], 0U,
+            __ATOMIC_SEQ_CST);
+
+        /* Dispatch each pending doorbell */
+        for (uint8_t db = 0U; db < SM_NUM_MB_LB_DB; db++)
+        {
+            if ((pending & (1UL << db)) != 0U)
+            {
+                MB_LOOPBACK_Dispatch(inst, db);
+                num++;
+            }
+        }
+    }
+
+    /* Return number serviced */
+    return num;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set abort status                                                         */
 /*--------------------------------------------------------------------------*/
@@ -176,3 +223,26 @@ int32_t MB_LOOPBACK_IsAborted(uint8_t inst, uint8_t db)
     return status;
 }
 
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch doorbell                                                        */
+/*--------------------------------------------------------------------------*/
+static void MB_LOOPBACK_Dispatch(uint8_t inst, uint8_t db)
+{
+    static const mb_lb_config_t s_mbLbConfig[SM_NUM_MB_LOOPBACK] =
+    {
+        SM_MB_LOOPBACK_CONFIG_DATA
+    };
+
+    /* Switch to allow easy addition of other transport protocols */
+    // coverity[misra_c_2012_rule_16_1_violation]
+    // coverity[misra_c_2012_rule_16_6_violation]
+    switch (s_mbLbConfig[inst].xportType[db])
+    {
+        default:
+            RPC_SMT_Dispatch(s_mbLbConfig[inst].xportChannel[db]);
+            break;
+    }
+}
+
@@ -92,12 +92,35 @@ uint32_t *MB_LOOPBACK_SmaGet(uint8_t inst, uint8_t db);
  * @param[in]     inst        Instance to ring
  * @param[in]     db          Doorbell
  *
- * Directly calls the dispatch for the doorbell.
+ * Directly calls the dispatch for the doorbell. If deferred mode is
+ * enabled, the doorbell is instead marked pending and dispatched by the
+ * next call to MB_LOOPBACK_Service().
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  */
 int32_t MB_LOOPBACK_DoorbellRing(uint8_t inst, uint8_t db);
 
+/*!
+ * Set deferred doorbell mode.
+ *
+ * @param[in]     defer       True to defer doorbell dispatch
+ *
+ * Deferred mode allows clients in other host threads to ring doorbells
+ * while a single thread runs the SM and calls MB_LOOPBACK_Service().
+ * Pending state is updated atomically. A deferred ring yields until the
+ * doorbell is serviced so must not be called from the service thread.
+ */
+void MB_LOOPBACK_DeferSet(bool defer);
+
+/*!
+ * Service pending doorbells.
+ *
+ * Dispatches all doorbells marked pending in deferred mode.
+ *
+ * @return Returns the number of doorbells dispatched.
+ */
+uint32_t MB_LOOPBACK_Service(void);
+
 /*!
  * Set abort status.
  *
@@ -48,6 +48,11 @@
 
 /* Local defines */
 
+/*! Mask of all doorbell (GI) status flags */
+#define MB_MU_DB_MASK \
+    ((uint32_t) kMU_GenInt0Flag | (uint32_t) kMU_GenInt1Flag \
+    | (uint32_t) kMU_GenInt2Flag | (uint32_t) kMU_GenInt3Flag)
+
 /* Local types */
 
 /* Local variables */
@@ -59,6 +64,14 @@ static const mb_mu_config_t s_mbMuConfig[SM_NUM_MB_MU] =
 
 static MU_Type *const s_muBases[] = MU_BASE_PTRS;
 
+/* MU to MB instance map (instance + 1, 0 = not a mailbox) */
+static const uint8_t s_mbMuMap[ARRAY_SIZE(s_muBases)] =
+{
+    SM_MB_MU_MAP_DATA
+};
+
+static mb_mu_stats_t s_mbMuStats[SM_NUM_MB_MU];
+
 /* Local functions */
 
 /*--------------------------------------------------------------------------*/
@@ -227,6 +240,27 @@ int32_t MB_MU_IsAborted(uint8_t inst, uint8_t db)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get mailbox statistics                                                   */
+/*--------------------------------------------------------------------------*/
+int32_t MB_MU_StatsGet(uint8_t inst, mb_mu_stats_t *stats)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check instance */
+    if (inst < SM_NUM_MB_MU)
+    {
+        *stats = s_mbMuStats[inst];
+    }
+    else
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Common MU IRQ handler                                                    */
 /*--------------------------------------------------------------------------*/
@@ -234,12 +268,6 @@ void MB_MU_Handler(uint32_t mu)
 {
     MU_Type *base = s_muBases[mu];
     uint32_t flags;
-    uint32_t mb;
-
-#ifdef DEV_SM_MSG_PROF_CNT
-    /* Start profile for this message */
-    DEV_SM_SystemMsgProfStart(mu);
-#endif
 
     /* Get interrupt status flags */
     flags = MU_GetStatusFlags(base);
@@ -247,11 +275,16 @@ void MB_MU_Handler(uint32_t mu)
     /* Clear interrupts */
     MU_ClearStatusFlags(base, flags);
 
-    /* Find mailbox */
-    for (mb = 0U; mb < SM_NUM_MB_MU; mb++)
+    /* Mailbox on this MU? */
+    if (s_mbMuMap[mu] != 0U)
     {
-        /* MU found? */
-        if (s_mbMuConfig[mb].mu == mu)
+        uint32_t mb = ((uint32_t) s_mbMuMap[mu]) - 1U;
+        uint32_t numDb = 0U;
+
+        flags &= MB_MU_DB_MASK;
+
+        /* Drain doorbells until none pending */
+        while (flags != 0U)
         {
             /* Loop over pending GI */
             for (uint32_t gi = 0U; gi < SM_NUM_MB_MU_DB; gi++)
@@ -271,14 +304,18 @@ void MB_MU_Handler(uint32_t mu)
                             ; /* Intentional empty default */
                             break;
                     }
+                    numDb++;
                 }
             }
+
+            /* Re-sample doorbells rung while dispatching */
+            flags = MU_GetStatusFlags(base) & MB_MU_DB_MASK;
+            MU_ClearStatusFlags(base, flags);
         }
-    }
 
-#ifdef DEV_SM_MSG_PROF_CNT
-    /* Complete profile for this message */
-    DEV_SM_SystemMsgProfEnd(mu);
-#endif
+        /* Update statistics */
+        s_mbMuStats[mb].numIrq++;
+        s_mbMuStats[mb].numDb += numDb;
+        s_mbMuStats[mb].maxDb = MAX(s_mbMuStats[mb].maxDb, numDb);
+    }
 }
-
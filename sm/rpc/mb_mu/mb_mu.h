@@ -56,6 +56,16 @@
 
 /* Types */
 
+/*!
+ * Mailbox statistics
+ */
+typedef struct
+{
+    uint32_t numIrq;    /*!< Number of IRQs handled */
+    uint32_t numDb;     /*!< Number of doorbells handled */
+    uint32_t maxDb;     /*!< Max doorbells handled in one IRQ */
+} mb_mu_stats_t;
+
 /* Functions */
 
 /*!
@@ -127,6 +137,21 @@ bool MB_MU_DoorbellState(uint8_t inst, uint8_t db);
  */
 int32_t MB_MU_IsAborted(uint8_t inst, uint8_t db);
 
+/*!
+ * Get mailbox statistics.
+ *
+ * @param[in]     inst        Instance
+ * @param[out]    stats       Return pointer to the statistics
+ *
+ * Returns the number of IRQs and doorbells handled for the instance.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_OUT_OF_RANGE: if \a inst is invalid.
+ */
+int32_t MB_MU_StatsGet(uint8_t inst, mb_mu_stats_t *stats);
+
 /*!
  * Handle MU interrupt.
  *
@@ -134,8 +159,9 @@ int32_t MB_MU_IsAborted(uint8_t inst, uint8_t db);
  *
  * This function processes an MU interrupt. The \a mu parameter specifies the
  * index into the SDK base pointer array as defined by MU_BASE_PTRS. This
- * function reads and clears all pending interrupts. It calls the linked
- * transport function.
+ * function reads and clears all pending interrupts and calls the linked
+ * transport function for each pending doorbell. The doorbell status is
+ * re-sampled and drained until no doorbell is pending before returning.
  */
 void MB_MU_Handler(uint32_t mu);
 
@@ -44,11 +44,22 @@
 #include "config_scmi.h"
 #include "rpc_scmi_internal.h"
 #include "lmm.h"
+#include "binlog.h"
 
 /* Local defines */
 
 #define SCMI_NUM_Q  2U
 
+#ifndef SM_SCMI_SCHED_WINDOW_USEC
+/* Scheduler rate budget window */
+#define SM_SCMI_SCHED_WINDOW_USEC  1000ULL
+#endif
+
+/* Scheduler rank, lower is serviced first */
+#define SCHED_RANK_NO_CREDIT  0x1U
+#define SCHED_RANK_PRIO(x)    (((uint32_t) (x) & 0xFFU) << 1U)
+#define SCHED_RANK_THROTTLE   0x200U
+
 /* Local macros */
 
 /* SCMI header creation */
@@ -80,6 +91,14 @@ typedef struct
     uint32_t data[SM_SCMI_MAX_NOTIFY];
 } notify_queue_t;
 
+typedef struct
+{
+    uint64_t windowUsec;
+    uint32_t windowCnt;
+    uint32_t credit;
+    scmi_sched_stats_t stats;
+} sched_agent_t;
+
 /* Local variables */
 
 static const uint8_t s_protocolList[] =
@@ -106,6 +125,10 @@ static uint32_t s_token[SM_SCMI_NUM_CHN];
 static uint32_t s_channel2queue[SM_SCMI_NUM_CHN];
 static uint32_t s_agent2channel[SM_SCMI_NUM_AGNT][SCMI_NUM_Q];
 static notify_queue_t s_queue[SM_SCMI_NUM_AGNT][SCMI_NUM_Q];
+static volatile bool s_schedPend[SM_SCMI_NUM_CHN];
+static uint64_t s_schedPendUsec[SM_SCMI_NUM_CHN];
+static uint32_t s_schedLast;
+static sched_agent_t s_schedAgent[SM_SCMI_NUM_AGNT];
 #ifdef MONITOR
 static channel_err_t s_channelErr[SM_SCMI_NUM_CHN];
 #endif
@@ -115,7 +138,7 @@ static channel_err_t s_channelErr[SM_SCMI_NUM_CHN];
 static void *RPC_SCMI_HdrAddrGet(uint32_t scmiChannel);
 static bool RPC_SCMI_ChannelFree(uint32_t scmiChannel);
 static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel);
-static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel);
+static bool RPC_SCMI_A2pDispatch(uint32_t scmiChannel);
 static int32_t RPC_SCMI_A2pSubDispatch(scmi_caller_t *caller,
     uint32_t protocolId, uint32_t messageId);
 static void RPC_SCMI_P2aDispatch(uint32_t scmiChannel);
@@ -123,6 +146,7 @@ static int32_t RPC_SCMI_A2pRx(scmi_caller_t *caller, void* msgRx,
     uint32_t len);
 static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
     int32_t status);
+static uint32_t RPC_SCMI_SchedRank(uint32_t agentId, uint64_t usec);
 
 /*--------------------------------------------------------------------------*/
 /* Init SCMI instance                                                       */
@@ -150,9 +174,7 @@ int32_t RPC_SCMI_Init(uint8_t scmiInst)
         }
     }
 
-#ifdef DEBUG
-    printf("DEBUG: RPC_SCMI_Init() scmiInst=%u status=0x%X\n", scmiInst, status);
-#endif
+    BINLOG2(BINLOG_ID_RPC_INIT, "SCMI%u init, status=%d", scmiInst, status);
 
     return status;
 }
@@ -174,6 +196,11 @@ int32_t RPC_SCMI_AgentInit(uint32_t agentId)
     {
         uint32_t initCount = 0U;
 
+        /* Reset scheduler state */
+        s_schedAgent[agentId].windowUsec = 0ULL;
+        s_schedAgent[agentId].windowCnt = 0U;
+        s_schedAgent[agentId].credit = 0U;
+
         /* Init transport for each agent channel */
         for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
             scmiChannel++)
@@ -217,6 +244,9 @@ int32_t RPC_SCMI_AgentInit(uint32_t agentId)
                 /* Reset token */
                 s_token[scmiChannel] = 0U;
 
+                /* Clear scheduler state */
+                s_schedPend[scmiChannel] = false;
+
                 /* Reset transport */
                 switch (g_scmiChannelConfig[scmiChannel].xportType)
                 {
@@ -251,14 +281,145 @@ void RPC_SCMI_Dispatch(uint32_t scmiChannel)
         case SM_SCMI_CHN_P2A:
         case SM_SCMI_CHN_P2A_NOTIFY:
         case SM_SCMI_CHN_P2A_PRIORITY:
+#ifdef DEV_SM_MSG_PROF_CNT
+            /* Start profile for this message */
+            DEV_SM_SystemMsgProfStart(scmiChannel);
+#endif
             RPC_SCMI_P2aDispatch(scmiChannel);
+#ifdef DEV_SM_MSG_PROF_CNT
+            /* Complete profile for this message */
+            DEV_SM_SystemMsgProfEnd(scmiChannel);
+#endif
             break;
         default: /* SM_SCMI_CHN_A2P */
-            RPC_SCMI_A2pDispatch(scmiChannel);
+            /* Mark pending, keeping the time of the first doorbell */
+            if (!s_schedPend[scmiChannel])
+            {
+                s_schedPendUsec[scmiChannel] = DEV_SM_Usec64Get();
+                s_schedPend[scmiChannel] = true;
+            }
+
+            /* Defer service to the scheduler */
+            SWI_SchedTrigger();
             break;
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Service next pending request                                             */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_Schedule(void)
+{
+    uint64_t usec = DEV_SM_Usec64Get();
+    uint32_t best = SM_SCMI_NUM_CHN;
+    uint32_t bestRank = 0U;
+    bool pending = false;
+
+    /* Rank pending channels, round robin from the last serviced */
+    for (uint32_t idx = 1U; idx <= SM_SCMI_NUM_CHN; idx++)
+    {
+        uint32_t scmiChannel = (s_schedLast + idx) % SM_SCMI_NUM_CHN;
+
+        if (s_schedPend[scmiChannel])
+        {
+            uint32_t rank = RPC_SCMI_SchedRank(
+                g_scmiChannelConfig[scmiChannel].agentId, usec);
+
+            /* Ties go to the first in round robin order */
+            if ((best == SM_SCMI_NUM_CHN) || (rank < bestRank))
+            {
+                best = scmiChannel;
+                bestRank = rank;
+            }
+        }
+    }
+
+    /* Service selected channel */
+    if (best < SM_SCMI_NUM_CHN)
+    {
+        uint32_t agentId = g_scmiChannelConfig[best].agentId;
+        sched_agent_t *sched = &s_schedAgent[agentId];
+        uint32_t weight = MAX(g_scmiAgentConfig[agentId].schedWeight, 1U);
+        /*
+         * False Positive: the pending time is captured from the same
+         * monotonic counter before the current time.
+         */
+        // coverity[cert_int30_c_violation:FALSE]
+        uint64_t wait = usec - s_schedPendUsec[best];
+
+        /* Account starvation of other pending agents */
+        for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+            scmiChannel++)
+        {
+            if (s_schedPend[scmiChannel] && (scmiChannel != best))
+            {
+                s_schedAgent[g_scmiChannelConfig[scmiChannel].agentId]
+                    .stats.numSkip++;
+            }
+        }
+
+        /* Update statistics */
+        sched->stats.numMsg++;
+        if ((bestRank & SCHED_RANK_THROTTLE) != 0U)
+        {
+            sched->stats.numThrottle++;
+        }
+        sched->stats.maxWaitUsec = MAX(sched->stats.maxWaitUsec,
+            U64_U32(MIN(wait, U64(UINT32_MAX))));
+
+        /* Consume budget and weighted turn */
+        sched->windowCnt++;
+        if (sched->credit == 0U)
+        {
+            sched->credit = weight - 1U;
+        }
+        else
+        {
+            sched->credit--;
+        }
+
+        /* Clear pending before service so new doorbells are kept */
+        s_schedPend[best] = false;
+        s_schedLast = best;
+
+#ifdef DEV_SM_MSG_PROF_CNT
+        /* Start profile for this message */
+        DEV_SM_SystemMsgProfStart(best);
+#endif
+
+        /* Service request, complete transport unless response deferred */
+        if (!RPC_SCMI_A2pDispatch(best))
+        {
+            switch (g_scmiChannelConfig[best].xportType)
+            {
+                case SM_XPORT_SMT:
+                    RPC_SMT_Complete(g_scmiChannelConfig[best].xportChannel);
+                    break;
+                default:
+                    ; /* Intentional empty default */
+                    break;
+            }
+        }
+
+#ifdef DEV_SM_MSG_PROF_CNT
+        /* Complete profile for this message */
+        DEV_SM_SystemMsgProfEnd(best);
+#endif
+    }
+
+    /* Check for more pending */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        if (s_schedPend[scmiChannel])
+        {
+            pending = true;
+        }
+    }
+
+    return pending;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Send P2A message                                                         */
 /*--------------------------------------------------------------------------*/
@@ -375,6 +536,37 @@ void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send deferred A2P response                                               */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_A2pDeferredTx(uint32_t scmiChannel, uint32_t header,
+    int32_t status)
+{
+    scmi_caller_t caller = { 0 };
+
+    /* Rebuild caller for the response */
+    caller.scmiChannel = scmiChannel;
+    caller.header = header;
+    caller.msg = (scmi_msg_status_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
+
+    if (caller.msg != NULL)
+    {
+        /* Send status only response */
+        (void) RPC_SCMI_A2pTx(&caller, sizeof(scmi_msg_status_t), status);
+    }
+
+    /* Complete transport */
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            RPC_SMT_Complete(g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Bounded string copy                                                      */
 /*--------------------------------------------------------------------------*/
@@ -394,6 +586,45 @@ void RPC_SCMI_StrCpy(uint8_t *dst, const uint8_t *src, uint32_t maxLen)
     *pDst = 0U;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Mark resource dirty                                                      */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_DirtySet(uint32_t *dirty, uint32_t id)
+{
+    dirty[id / 32U] |= (1UL << (id % 32U));
+}
+
+/*--------------------------------------------------------------------------*/
+/* Take next dirty resource                                                 */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_DirtyNext(uint32_t *dirty, uint32_t numWords, uint32_t *id)
+{
+    bool found = false;
+
+    /* Find first non-empty word */
+    for (uint32_t word = 0U; (!found) && (word < numWords); word++)
+    {
+        if (dirty[word] != 0U)
+        {
+            uint32_t bit = 0U;
+
+            /* Find lowest set bit */
+            while ((dirty[word] & (1UL << bit)) == 0U)
+            {
+                bit++;
+            }
+
+            /* Clear and return */
+            dirty[word] &= ~(1UL << bit);
+            *id = (word * 32U) + bit;
+            found = true;
+        }
+    }
+
+    /* Return result */
+    return found;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get number of protocols                                                  */
 /*--------------------------------------------------------------------------*/
@@ -453,6 +684,18 @@ int32_t RPC_SCMI_Reset(uint8_t scmiInst)
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Drop requests pending from the instance */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        uint32_t agentId = g_scmiChannelConfig[scmiChannel].agentId;
+
+        if (g_scmiAgentConfig[agentId].scmiInst == scmiInst)
+        {
+            s_schedPend[scmiChannel] = false;
+        }
+    }
+
     /* Reset all agents of this instance */
     for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
     {
@@ -534,6 +777,9 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger)
             msgId.messageId = RPC_SCMI_NOTIFY_MISC_CONTROL_EVENT;
             status = RPC_SCMI_MiscDispatchNotification(msgId, trigger);
             break;
+        case LMM_TRIGGER_POWER:
+            status = RPC_SCMI_PowerComplete(trigger);
+            break;
         default:
             status = SM_ERR_INVALID_PARAMETERS;
             break;
@@ -576,6 +822,27 @@ void RPC_SCMI_ErrorDump(uint8_t scmiInst)
 #endif
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get agent scheduling statistics                                          */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_SchedStatsGet(uint32_t agentId, scmi_sched_stats_t *stats)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check agent */
+    if (agentId < SM_SCMI_NUM_AGNT)
+    {
+        *stats = s_schedAgent[agentId].stats;
+    }
+    else
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 
 /*--------------------------------------------------------------------------*/
@@ -656,9 +923,9 @@ static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Dispatch SCMI A2P request                                                */
+/* Dispatch SCMI A2P request, returns true if the response is deferred      */
 /*--------------------------------------------------------------------------*/
-static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
+static bool RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
 {
     scmi_caller_t caller = { 0 };
 
@@ -787,14 +1054,20 @@ static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
             }
         }
 
-        /* Send response */
-        if (caller.lenMsg > 0U)
+        /* Send response unless the handler deferred it */
+        if ((status != SM_ERR_SUCCESS) || !caller.deferred)
         {
-            (void) RPC_SCMI_A2pTx(&caller, caller.lenMsg, status);
+            caller.deferred = false;
+            if (caller.lenMsg > 0U)
+            {
+                (void) RPC_SCMI_A2pTx(&caller, caller.lenMsg, status);
+            }
         }
 
         s_copyInUse = false;
     }
+
+    return caller.deferred;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -1040,3 +1313,35 @@ static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
     return rtn;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Rank agent for scheduling                                                */
+/*--------------------------------------------------------------------------*/
+static uint32_t RPC_SCMI_SchedRank(uint32_t agentId, uint64_t usec)
+{
+    sched_agent_t *sched = &s_schedAgent[agentId];
+    uint32_t budget = g_scmiAgentConfig[agentId].schedBudget;
+    uint32_t rank = SCHED_RANK_PRIO(g_scmiAgentConfig[agentId].schedPrio);
+
+    /* Start a new rate window? */
+    // coverity[cert_int30_c_violation:FALSE]
+    if ((usec - sched->windowUsec) >= SM_SCMI_SCHED_WINDOW_USEC)
+    {
+        sched->windowUsec = usec;
+        sched->windowCnt = 0U;
+    }
+
+    /* Over budget ranks below all agents within budget */
+    if ((budget != 0U) && (sched->windowCnt >= budget))
+    {
+        rank |= SCHED_RANK_THROTTLE;
+    }
+
+    /* Out of weighted turns ranks below peers of the same priority */
+    if (sched->credit == 0U)
+    {
+        rank |= SCHED_RANK_NO_CREDIT;
+    }
+
+    return rank;
+}
+
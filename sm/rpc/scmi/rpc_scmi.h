@@ -112,6 +112,15 @@
 
 /* Types */
 
+/*! SCMI agent scheduling statistics */
+typedef struct
+{
+    uint32_t numMsg;       /*!< Messages serviced */
+    uint32_t numSkip;      /*!< Times passed over while pending */
+    uint32_t numThrottle;  /*!< Messages serviced while over budget */
+    uint32_t maxWaitUsec;  /*!< Max wait from doorbell to service */
+} scmi_sched_stats_t;
+
 /*! SCMI full message structure */
 typedef struct
 {
@@ -155,6 +164,7 @@ typedef struct
     uint32_t safeType;       /*!< Safety classification */
     uint32_t seenvId;        /*!< S-EENV ID */
     bool extension;          /*!< Vendor extension protocol */
+    bool deferred;           /*!< Response sent on completion */
 } scmi_caller_t;
 
 /* Functions */
@@ -201,6 +211,19 @@ int32_t RPC_SCMI_AgentInit(uint32_t agentId);
  */
 void RPC_SCMI_Dispatch(uint32_t scmiChannel);
 
+/*!
+ * Service next pending SCMI request.
+ *
+ * A2P doorbells are only marked pending by RPC_SCMI_Dispatch(). This
+ * function services one pending request. Agents within their rate
+ * budget are selected first, then by agent priority, and agents of the
+ * same priority share by weighted round robin. Called from the scheduler
+ * software interrupt, which runs below the MU interrupts.
+ *
+ * @return Returns true if more requests are pending.
+ */
+bool RPC_SCMI_Schedule(void);
+
 /*!
  * Send P2A message.
  *
@@ -264,6 +287,19 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger);
  */
 void RPC_SCMI_ErrorDump(uint8_t scmiInst);
 
+/*!
+ * Get SCMI agent scheduling statistics.
+ *
+ * @param[in]     agentId   SCMI agent
+ * @param[out]    stats     Return pointer to statistics
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_OUT_OF_RANGE: if \a agentId is not valid.
+ */
+int32_t RPC_SCMI_SchedStatsGet(uint32_t agentId, scmi_sched_stats_t *stats);
+
 /** @} */
 
 #endif /* RPC_SCMI_H */
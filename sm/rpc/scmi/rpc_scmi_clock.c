@@ -540,6 +540,7 @@ int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
 
 static uint8_t s_clockAgent[SM_NUM_CLOCK];
 static uint32_t s_clockState[SM_NUM_CLOCK];
+static uint32_t s_clockDirty[SM_SCMI_NUM_AGNT][SCMI_DIRTY_WORDS(SM_NUM_CLOCK)];
 
 /* Local functions */
 
@@ -1043,6 +1044,7 @@ static int32_t ClockRateSet(const scmi_caller_t *caller,
 
         /* Mark owning agent */
         s_clockAgent[in->clockId] = ((uint8_t) caller->agentId) + 1U;
+        RPC_SCMI_DirtySet(s_clockDirty[caller->agentId], in->clockId);
 
         /* Set rate */
         status = LMM_ClockRateSet(caller->lmId, in->clockId, lmRate,
@@ -1504,6 +1506,7 @@ static int32_t ClockParentSet(const scmi_caller_t *caller,
     {
         /* Mark owning agent */
         s_clockAgent[in->clockId] = U8((caller->agentId) + 1U);
+        RPC_SCMI_DirtySet(s_clockDirty[caller->agentId], in->clockId);
 
         /* Set parent */
         status = LMM_ClockParentSet(caller->lmId, in->clockId,
@@ -1704,9 +1707,11 @@ static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t clockId;
 
-    /* Loop over all clocks */
-    for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+    /* Loop over clocks changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_clockDirty[agentId],
+        SCMI_DIRTY_WORDS(SM_NUM_CLOCK), &clockId))
     {
         /* Disable clock */
         if ((s_clockState[clockId] & (1UL << agentId)) != 0U)
@@ -1751,6 +1756,7 @@ static int32_t ClockConfigUpdate(uint32_t lmId, uint32_t agentId,
     {
         /* Mark as enabled */
         s_clockState[clockId] |= (1UL << agentId);
+        RPC_SCMI_DirtySet(s_clockDirty[agentId], clockId);
     }
     else
     {
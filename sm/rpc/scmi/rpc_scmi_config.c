@@ -63,3 +63,35 @@ const scmi_config_t g_scmiConfig[SM_NUM_SCMI] =
     SM_SCMI_CONFIG_DATA
 };
 
+#if SM_SCMI_NUM_PIN_GRP > 0
+// coverity[misra_c_2012_rule_9_2_violation]
+const scmi_pin_grp_config_t g_scmiPinGrpConfig[SM_SCMI_NUM_PIN_GRP] =
+{
+    SM_SCMI_PIN_GRP_CONFIG_DATA
+};
+
+const uint16_t g_scmiPinGrpPins[SM_SCMI_NUM_PIN_GRP_PINS] =
+{
+    SM_SCMI_PIN_GRP_PINS_DATA
+};
+
+// coverity[misra_c_2012_rule_9_2_violation]
+const scmi_pin_grp_idx_t g_scmiPinGrpIdx[SM_NUM_PIN] =
+{
+    SM_SCMI_PIN_GRP_IDX_DATA
+};
+
+const uint16_t g_scmiPinGrpRefs[SM_SCMI_NUM_PIN_GRP_REFS] =
+{
+    SM_SCMI_PIN_GRP_REFS_DATA
+};
+#endif
+
+#if SM_SCMI_NUM_PIN_FUNC > 0
+// coverity[misra_c_2012_rule_9_2_violation]
+const scmi_pin_func_config_t g_scmiPinFuncConfig[SM_SCMI_NUM_PIN_FUNC] =
+{
+    SM_SCMI_PIN_FUNC_CONFIG_DATA
+};
+#endif
+
@@ -52,6 +52,7 @@
 
 #include "sm.h"
 #include "config_lmm.h"
+#include "config_scmi.h"
 #include "dev_sm_api.h"
 
 /* Defines */
@@ -89,6 +90,16 @@
 #define SM_SCMI_PERM_ALL        255U  /*!< Full access */
 /** @} */
 
+#ifndef SM_SCMI_NUM_PIN_GRP
+/*! Number of pin groups, none if not configured */
+#define SM_SCMI_NUM_PIN_GRP   0U
+#endif
+
+#ifndef SM_SCMI_NUM_PIN_FUNC
+/*! Number of pin functions, none if not configured */
+#define SM_SCMI_NUM_PIN_FUNC  0U
+#endif
+
 /* Types */
 
 /*!
@@ -117,6 +128,9 @@ typedef struct
     uint8_t secure;                      /*!< Security state */
     uint8_t seenvId;                     /*!< S-EENV ID */
     uint8_t scmiInst;                    /*!< SCMI instance */
+    uint8_t schedPrio;                   /*!< Scheduling priority, 0=highest */
+    uint8_t schedWeight;                 /*!< Scheduling weight, 0=1 */
+    uint16_t schedBudget;                /*!< Messages per window, 0=no limit */
     uint8_t basePerms[SM_NUM_BASE];      /*!< Base protocol permissions */
     uint8_t pdPerms[SM_NUM_POWER];       /*!< Power protocol permissions */
     uint8_t sysPerms;                    /*!< System protocol permission */
@@ -133,6 +147,9 @@ typedef struct
     uint8_t perlpiPerms[SM_NUM_PERLPI];  /*!< CPU protocol peripheral permissions */
     uint8_t pinPerms[SM_NUM_PIN];        /*!< Pin control protocol permissions */
     uint8_t daisyPerms[SM_NUM_DAISY];    /*!< Pin control protocol daisy permissions */
+#if SM_SCMI_NUM_PIN_GRP > 0
+    uint8_t pinGrpPerms[SM_SCMI_NUM_PIN_GRP]; /*!< Pin control protocol group permissions */
+#endif
     uint8_t ctrlPerms[SM_NUM_CTRL];      /*!< Control protocol permissions */
     uint8_t faultPerms[SM_NUM_FAULT];    /*!< FuSa protocol fault permissions */
     uint8_t fusaPerms;                   /*!< FuSa protocol permission */
@@ -150,6 +167,41 @@ typedef struct
     uint8_t firstAgent;  /*!< First agent in agent array */
 } scmi_config_t;
 
+/*!
+ * SCMI pin group config structure
+ *
+ * See @ref CONFIG_STRUCT for more info.
+ */
+typedef struct
+{
+    string name;        /*!< Group name */
+    uint16_t firstPin;  /*!< First pin in group pin array */
+    uint16_t numPins;   /*!< Number of pins */
+} scmi_pin_grp_config_t;
+
+/*!
+ * SCMI pin to group index structure
+ *
+ * See @ref CONFIG_STRUCT for more info.
+ */
+typedef struct
+{
+    uint16_t firstGrp;  /*!< First entry in group reference array */
+    uint16_t numGrp;    /*!< Number of groups containing the pin */
+} scmi_pin_grp_idx_t;
+
+/*!
+ * SCMI pin function config structure
+ *
+ * See @ref CONFIG_STRUCT for more info.
+ */
+typedef struct
+{
+    string name;        /*!< Function name */
+    uint16_t grp;       /*!< Group supporting the function */
+    uint32_t mux;       /*!< Mux value applied to all pins in the group */
+} scmi_pin_func_config_t;
+
 /* Global constant data */
 
 /*! SCMI channel config */
@@ -161,6 +213,25 @@ extern const scmi_agnt_config_t g_scmiAgentConfig[];
 /*! SCMI instance config */
 extern const scmi_config_t g_scmiConfig[];
 
+#if SM_SCMI_NUM_PIN_GRP > 0
+/*! SCMI pin group config */
+extern const scmi_pin_grp_config_t g_scmiPinGrpConfig[];
+
+/*! SCMI pin group pin array */
+extern const uint16_t g_scmiPinGrpPins[];
+
+/*! SCMI pin to group index */
+extern const scmi_pin_grp_idx_t g_scmiPinGrpIdx[];
+
+/*! SCMI group reference array, groups containing each pin */
+extern const uint16_t g_scmiPinGrpRefs[];
+#endif
+
+#if SM_SCMI_NUM_PIN_FUNC > 0
+/*! SCMI pin function config */
+extern const scmi_pin_func_config_t g_scmiPinFuncConfig[];
+#endif
+
 #endif /* RPC_SCMI_CONFIG_H */
 
 /** @} */
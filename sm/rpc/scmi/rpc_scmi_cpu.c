@@ -480,6 +480,7 @@ int32_t RPC_SCMI_CpuDispatchReset(uint32_t lmId, uint32_t agentId,
 /*==========================================================================*/
 
 static uint8_t s_cpuAgent[SM_NUM_CPU];
+static uint32_t s_cpuDirty[SM_SCMI_NUM_AGNT][SCMI_DIRTY_WORDS(SM_NUM_CPU)];
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -859,6 +860,7 @@ static int32_t CpuResetVectorSet(const scmi_caller_t *caller,
 
         /* Mark owning agent */
         s_cpuAgent[in->cpuId] = U8((caller->agentId) + 1U);
+        RPC_SCMI_DirtySet(s_cpuDirty[caller->agentId], in->cpuId);
 
         /* Update vector */
         status = LMM_CpuResetVectorSet(caller->lmId, in->cpuId,
@@ -1400,9 +1402,11 @@ static int32_t CpuResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t cpuId;
 
-    /* Loop over all CPUs */
-    for (uint32_t cpuId = 0U; cpuId < SM_NUM_CPU; cpuId++)
+    /* Loop over CPUs changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_cpuDirty[agentId],
+        SCMI_DIRTY_WORDS(SM_NUM_CPU), &cpuId))
     {
         /* Reset vector */
         if (s_cpuAgent[cpuId] == (U32_U8(agentId) + 1U))
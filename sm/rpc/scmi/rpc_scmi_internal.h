@@ -85,6 +85,9 @@
 /*! Macro to determine max elements in the payload */
 #define SCMI_ARRAY(X, Y)    ((SCMI_PAYLOAD_LEN - (X)) / sizeof(Y))
 
+/*! Macro to determine words in a dirty bitmap of N resources */
+#define SCMI_DIRTY_WORDS(N)  (((N) + 31U) / 32U)
+
 /* Types */
 
 /*! SCMI message structure (header only) */
@@ -131,6 +134,21 @@ bool RPC_SCMI_P2aTxQFull(uint32_t agentId, uint32_t len, uint32_t queue);
 void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
     uint32_t len, uint32_t queue);
 
+/*!
+ * Send deferred response (A2P).
+ *
+ * @param[in]     scmiChannel  Channel the request was received on
+ * @param[in]     header       Header of the request
+ * @param[in]     status       Status to return
+ *
+ * This function sends a status only response for a request whose handler
+ * set \a caller->deferred and completes the transport. The channel stays
+ * busy until this is called so the agent cannot send another request on
+ * it in the meantime.
+ */
+void RPC_SCMI_A2pDeferredTx(uint32_t scmiChannel, uint32_t header,
+    int32_t status);
+
 /*!
  * Bounded string copy.
  *
@@ -143,6 +161,30 @@ void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
  */
 void RPC_SCMI_StrCpy(uint8_t *dst, const uint8_t *src, uint32_t maxLen);
 
+/*!
+ * Mark a resource dirty.
+ *
+ * @param[in,out] dirty   Dirty bitmap of an agent
+ * @param[in]     id      Resource ID
+ *
+ * Protocols record the resources an agent changed in a per-agent bitmap
+ * so an agent reset only has to revert those resources.
+ */
+void RPC_SCMI_DirtySet(uint32_t *dirty, uint32_t id);
+
+/*!
+ * Take the next dirty resource.
+ *
+ * @param[in,out] dirty     Dirty bitmap of an agent
+ * @param[in]     numWords  Number of words in the bitmap
+ * @param[out]    id        Return the lowest dirty resource ID
+ *
+ * The returned resource is cleared in the bitmap.
+ *
+ * @return Returns true if a dirty resource was found.
+ */
+bool RPC_SCMI_DirtyNext(uint32_t *dirty, uint32_t numWords, uint32_t *id);
+
 /*!
  * Get number of protocols.
  *
@@ -41,6 +41,7 @@
 
 #include "rpc_scmi_internal.h"
 #include "lmm.h"
+#include "binlog.h"
 
 /* Local defines */
 
@@ -122,6 +123,9 @@
 #define MISC_SHUTDOWN_FLAG_ERR_ID(x)   (((x) & 0x7FFFU) << 8U)
 #define MISC_SHUTDOWN_FLAG_REASON(x)   (((x) & 0xFFU) << 0U)
 
+/* SCMI syslog flags */
+#define MISC_SYSLOG_FLAG_BINLOG(x)  (((x) & 0x80000000U) >> 31U)
+
 /* SCMI misc num log flags */
 #define MISC_NUM_LOG_FLAGS_REMAING_LOGS(x)  (((x) & 0xFFFU) << 20U)
 #define MISC_NUM_LOG_FLAGS_NUM_LOGS(x)      (((x) & 0xFFFU) << 0U)
@@ -704,6 +708,7 @@ int32_t RPC_SCMI_MiscDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint32_t s_ctrlNotify[SM_NUM_CTRL][SM_SCMI_NUM_AGNT];
+static uint32_t s_ctrlDirty[SM_SCMI_NUM_AGNT][SCMI_DIRTY_WORDS(SM_NUM_CTRL)];
 
 /* Local functions */
 
@@ -1626,7 +1631,7 @@ static int32_t MiscCfgInfo(const scmi_caller_t *caller,
 /* Parameters:                                                              */
 /* - caller: Caller info                                                    */
 /* - in->flags: Device specific flags that might impact the data returned   */
-/*   or clearing of the data                                                */
+/*   or clearing of the data. Bit[31] selects the binary log                */
 /* - in->logIndex: Index to the first log word. Will be the first element   */
 /*   in the return array                                                    */
 /* - out->numLogFlags: Descriptor for the log data returned by this call.   */
@@ -1665,9 +1670,20 @@ static int32_t MiscSyslog(const scmi_caller_t *caller,
     /* Get data */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Call device */
-        status = SM_SYSLOGGET(in->flags, (const dev_sm_syslog_t**) &syslog,
-            &words);
+        if (MISC_SYSLOG_FLAG_BINLOG(in->flags) != 0U)
+        {
+            const binlog_t *binlog;
+
+            /* Get binary log */
+            BINLOG_Get(&binlog, &words);
+            syslog = (const uint32_t *) binlog;
+        }
+        else
+        {
+            /* Call device */
+            status = SM_SYSLOGGET(in->flags,
+                (const dev_sm_syslog_t**) &syslog, &words);
+        }
 
         /* Convert to words */
         words /= 4U;
@@ -2165,9 +2181,11 @@ static int32_t MiscResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t ctrlId;
 
-    /* Loop over all controls */
-    for (uint32_t ctrlId = 0U; ctrlId < SM_NUM_CTRL; ctrlId++)
+    /* Loop over controls changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_ctrlDirty[agentId],
+        SCMI_DIRTY_WORDS(SM_NUM_CTRL), &ctrlId))
     {
         (void) MiscControlUpdate(lmId, agentId, ctrlId, 0U);
     }
@@ -2205,6 +2223,10 @@ static int32_t MiscControlUpdate(uint32_t lmId, uint32_t agentId,
 
         /* Record agent flags for this control */
         s_ctrlNotify[ctrlId][agentId] = flags;
+        if (flags != 0U)
+        {
+            RPC_SCMI_DirtySet(s_ctrlDirty[agentId], ctrlId);
+        }
 
         /* Calculate new aggregate state for the flags */
         for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
@@ -52,17 +52,19 @@
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
 #define COMMAND_PINCTRL_ATTRIBUTES           0x3U
+#define COMMAND_PINCTRL_LIST_ASSOCIATIONS    0x4U
 #define COMMAND_PINCTRL_SETTINGS_GET         0x5U
 #define COMMAND_PINCTRL_SETTINGS_CONFIGURE   0x6U
 #define COMMAND_PINCTRL_REQUEST              0x7U
 #define COMMAND_PINCTRL_RELEASE              0x8U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x101EFULL
+#define COMMAND_SUPPORTED_MASK               0x101FFULL
 
 /* SCMI max pin control argument lengths */
 #define PINCTRL_MAX_NAME       16U
 #define PINCTRL_MAX_CONFIGS    SCMI_ARRAY(12U, pin_config_t)
 #define PINCTRL_MAX_CONFIGS_T  SCMI_ARRAY(8U, pin_config_t)
+#define PINCTRL_MAX_ARRAY      SCMI_ARRAY(12U, uint16_t)
 
 /* SCMI pin control selectors */
 #define PINCTRL_SEL_PIN    0U
@@ -96,6 +98,10 @@
 /* SCMI pin control flags */
 #define PINCTRL_FLAGS_SELECTOR(x)  (((x) & 0x3U) >> 0U)
 
+/* SCMI pin control list flags */
+#define PINCTRL_NUM_FLAGS_REMAINING(x)  (((x) & 0xFFFFU) << 16U)
+#define PINCTRL_NUM_FLAGS_NUM(x)        (((x) & 0xFFFU) << 0U)
+
 /* SCMI pin attributes */
 #define PINCTRL_ATTR_EXT_NAME(x)  (((x) & 0x1U) << 31U)
 #define PINCTRL_ATTR_GPIO(x)      (((x) & 0x1U) << 17U)
@@ -196,6 +202,32 @@ typedef struct
     uint8_t name[PINCTRL_MAX_NAME];
 } msg_tpinctrl3_t;
 
+/* Request type for PinctrlListAssociations() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the group or function */
+    uint32_t identifier;
+    /* Selector */
+    uint32_t flags;
+    /* Index of the first association to return */
+    uint32_t index;
+} msg_rpinctrl4_t;
+
+/* Response type for PinctrlListAssociations() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Number of associations */
+    uint32_t flags;
+    /* Array of pin or group identifiers */
+    uint16_t array[PINCTRL_MAX_ARRAY];
+} msg_tpinctrl4_t;
+
 /* Request type for PinctrlSettingsGet() */
 typedef struct
 {
@@ -278,6 +310,8 @@ static int32_t PinctrlProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rpinctrl2_t *in, msg_tpinctrl2_t *out);
 static int32_t PinctrlAttributes(const scmi_caller_t *caller,
     const msg_rpinctrl3_t *in, msg_tpinctrl3_t *out);
+static int32_t PinctrlListAssociations(const scmi_caller_t *caller,
+    const msg_rpinctrl4_t *in, msg_tpinctrl4_t *out, uint32_t *len);
 static int32_t PinctrlSettingsGet(const scmi_caller_t *caller,
     const msg_rpinctrl5_t *in, msg_tpinctrl5_t *out, uint32_t *len);
 static int32_t PinctrlSettingsConfigure(const scmi_caller_t *caller,
@@ -290,6 +324,18 @@ static int32_t PinctrlNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rpinctrl16_t *in, const scmi_msg_status_t *out);
 static int32_t PinctrlResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
+#if SM_SCMI_NUM_PIN_GRP > 0
+static int32_t PinctrlGrpConfigure(const scmi_caller_t *caller,
+    const msg_rpinctrl6_t *in, uint32_t numConfigs);
+static void PinctrlGrpFuncClear(uint32_t pinId);
+#endif
+
+/* Local variables */
+
+#if SM_SCMI_NUM_PIN_GRP > 0
+/* Function selected for each group (function + 1, 0 = none) */
+static uint16_t s_pinGrpFunc[SM_SCMI_NUM_PIN_GRP];
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI command                                                    */
@@ -329,6 +375,11 @@ int32_t RPC_SCMI_PinctrlDispatchCommand(scmi_caller_t *caller,
             status = PinctrlAttributes(caller, (const msg_rpinctrl3_t*) in,
                 (msg_tpinctrl3_t*) out);
             break;
+        case COMMAND_PINCTRL_LIST_ASSOCIATIONS:
+            lenOut = sizeof(msg_tpinctrl4_t);
+            status = PinctrlListAssociations(caller,
+                (const msg_rpinctrl4_t*) in, (msg_tpinctrl4_t*) out, &lenOut);
+            break;
         case COMMAND_PINCTRL_SETTINGS_GET:
             lenOut = sizeof(msg_tpinctrl5_t);
             status = PinctrlSettingsGet(caller, (const msg_rpinctrl5_t*) in,
@@ -459,13 +510,14 @@ static int32_t PinctrlProtocolAttributes(const scmi_caller_t *caller,
     /* Return data */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Return number of pins, no groups */
+        /* Return number of pins and groups */
         out->attributesLow
-            = PINCTRL_PROTO_ATTR_LOW_NUM_GROUPS(0UL)
+            = PINCTRL_PROTO_ATTR_LOW_NUM_GROUPS((uint32_t) SM_SCMI_NUM_PIN_GRP)
             | PINCTRL_PROTO_ATTR_LOW_NUM_PINS((uint32_t) SM_NUM_PIN);
 
-        /* No functions */
-        out->attributesHigh = PINCTRL_PROTO_ATTR_HIGH_NUM_FUNCTIONS(0U);
+        /* Return number of functions */
+        out->attributesHigh = PINCTRL_PROTO_ATTR_HIGH_NUM_FUNCTIONS(
+            (uint32_t) SM_SCMI_NUM_PIN_FUNC);
     }
 
     /* Return status */
@@ -601,6 +653,7 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
     uint32_t sel = PINCTRL_FLAGS_SELECTOR(in->flags);
+    uint32_t num = 1U;
 
     /* Check request length */
     if (caller->lenCopy < sizeof(*in))
@@ -608,22 +661,54 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
         status = SM_ERR_PROTOCOL_ERROR;
     }
 
-    /* Check selector */
-    if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
-    {
-        status = SM_ERR_NOT_FOUND;
-    }
-
-    /* Check pin */
-    if ((status == SM_ERR_SUCCESS) && (in->identifier >= SM_NUM_PIN))
-    {
-        status = SM_ERR_NOT_FOUND;
-    }
-
-    /* Get the pin name */
+    /* Get the name and number of associations */
     if (status == SM_ERR_SUCCESS)
     {
-        status = SM_PINNAMEGET(in->identifier, (string*) &nameAddr, NULL);
+        switch (sel)
+        {
+            case PINCTRL_SEL_PIN:
+                if (in->identifier >= SM_NUM_PIN)
+                {
+                    status = SM_ERR_NOT_FOUND;
+                }
+                else
+                {
+                    status = SM_PINNAMEGET(in->identifier,
+                        (string*) &nameAddr, NULL);
+                }
+                break;
+#if SM_SCMI_NUM_PIN_GRP > 0
+            case PINCTRL_SEL_GROUP:
+                if (in->identifier >= SM_SCMI_NUM_PIN_GRP)
+                {
+                    status = SM_ERR_NOT_FOUND;
+                }
+                else
+                {
+                    nameAddr = (const uint8_t*)
+                        g_scmiPinGrpConfig[in->identifier].name;
+                    num = g_scmiPinGrpConfig[in->identifier].numPins;
+                }
+                break;
+#endif
+#if SM_SCMI_NUM_PIN_FUNC > 0
+            case PINCTRL_SEL_FUNC:
+                if (in->identifier >= SM_SCMI_NUM_PIN_FUNC)
+                {
+                    status = SM_ERR_NOT_FOUND;
+                }
+                else
+                {
+                    /* Functions are supported by exactly one group */
+                    nameAddr = (const uint8_t*)
+                        g_scmiPinFuncConfig[in->identifier].name;
+                }
+                break;
+#endif
+            default:
+                status = SM_ERR_NOT_FOUND;
+                break;
+        }
     }
 
     /* Return results */
@@ -634,7 +719,7 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
             = PINCTRL_ATTR_EXT_NAME(0UL)
             | PINCTRL_ATTR_GPIO(0UL)
             | PINCTRL_ATTR_PIN_ONLY(0UL)
-            | PINCTRL_ATTR_NUM(1UL);
+            | PINCTRL_ATTR_NUM(num);
 
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, PINCTRL_MAX_NAME);
@@ -644,6 +729,142 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* List pin or group associations                                           */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->identifier: Identifier for the group or function                   */
+/* - in->flags: Selector:                                                   */
+/*   Bits[31:2] Reserved, must be zero.                                     */
+/*   Bits[1:0] Selector: Whether the identifier field selects a group or a  */
+/*   function.                                                              */
+/*   1 - Group                                                              */
+/*   2 - Function                                                           */
+/*   All other values are reserved for future use                           */
+/* - in->index: Index of the first pin (group) or group (function) to be    */
+/*   returned                                                               */
+/* - out->flags: Number of associations:                                    */
+/*   Bits[31:16] Number of remaining identifiers.                           */
+/*   Bits[15:12] Reserved, must be zero.                                    */
+/*   Bits[11:0] Number of identifiers that are returned by this call        */
+/* - out->array: Array of pin identifiers (group) or group identifiers      */
+/*   (function)                                                             */
+/* - len: Pointer to length (can modify)                                    */
+/*                                                                          */
+/* Process the PINCTRL_LIST_ASSOCIATIONS message. Platform handler for      */
+/* SCMI_PinctrlListAssociations(). See section 4.11.2.6 in the SCMI spec.   */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - PINCTRL_FLAGS_SELECTOR() - Selector                                    */
+/* - PINCTRL_NUM_FLAGS_REMAINING() - Number of remaining identifiers        */
+/* - PINCTRL_NUM_FLAGS_NUM() - Number of identifiers returned               */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the identifiers were successfully returned.         */
+/* - SM_ERR_NOT_FOUND: if the identifier field does not point to a valid    */
+/*   group or function.                                                     */
+/* - SM_ERR_INVALID_PARAMETERS: if the selector or index is invalid.        */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t PinctrlListAssociations(const scmi_caller_t *caller,
+    const msg_rpinctrl4_t *in, msg_tpinctrl4_t *out, uint32_t *len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t sel = PINCTRL_FLAGS_SELECTOR(in->flags);
+    uint32_t total = 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Get number of associations */
+    if (status == SM_ERR_SUCCESS)
+    {
+        switch (sel)
+        {
+            case PINCTRL_SEL_PIN:
+                status = SM_ERR_INVALID_PARAMETERS;
+                break;
+#if SM_SCMI_NUM_PIN_GRP > 0
+            case PINCTRL_SEL_GROUP:
+                if (in->identifier >= SM_SCMI_NUM_PIN_GRP)
+                {
+                    status = SM_ERR_NOT_FOUND;
+                }
+                else
+                {
+                    total = g_scmiPinGrpConfig[in->identifier].numPins;
+                }
+                break;
+#endif
+#if SM_SCMI_NUM_PIN_FUNC > 0
+            case PINCTRL_SEL_FUNC:
+                if (in->identifier >= SM_SCMI_NUM_PIN_FUNC)
+                {
+                    status = SM_ERR_NOT_FOUND;
+                }
+                else
+                {
+                    total = 1U;
+                }
+                break;
+#endif
+            default:
+                status = SM_ERR_NOT_FOUND;
+                break;
+        }
+    }
+
+    /* Check index */
+    if ((status == SM_ERR_SUCCESS) && (in->index >= total))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Return associations */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t num = 0U;
+
+        while (((in->index + num) < total) && (num < PINCTRL_MAX_ARRAY))
+        {
+#if SM_SCMI_NUM_PIN_GRP > 0
+            if (sel == PINCTRL_SEL_GROUP)
+            {
+                const scmi_pin_grp_config_t *grp
+                    = &g_scmiPinGrpConfig[in->identifier];
+
+                out->array[num] = g_scmiPinGrpPins[grp->firstPin
+                    + in->index + num];
+            }
+#endif
+#if SM_SCMI_NUM_PIN_FUNC > 0
+            if (sel == PINCTRL_SEL_FUNC)
+            {
+                out->array[num] = g_scmiPinFuncConfig[in->identifier].grp;
+            }
+#endif
+            num++;
+        }
+
+        /* Return counts */
+        out->flags = PINCTRL_NUM_FLAGS_REMAINING(total - (in->index + num))
+            | PINCTRL_NUM_FLAGS_NUM(num);
+
+        /*
+         * False Positive: num is limited to PINCTRL_MAX_ARRAY.
+         */
+        // coverity[cert_int30_c_violation:FALSE]
+        *len = (3U * sizeof(uint32_t)) + (num * sizeof(uint16_t));
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get pin configuration                                                    */
 /*                                                                          */
@@ -725,6 +946,8 @@ static int32_t PinctrlSettingsGet(const scmi_caller_t *caller,
     uint32_t cfg = PINCTRL_GET_ATTR_CONFIG(in->attributes);
     uint32_t sel = PINCTRL_GET_ATTR_SELECTOR(in->attributes);
     uint32_t skipConfigs = PINCTRL_GET_ATTR_SKIP_CONFIGS(in->attributes);
+    uint32_t pinId = in->identifier;
+    uint32_t funcSel = 0U;
     uint32_t maxConfigs = 3U;
     uint32_t configList[3] =
     {
@@ -744,16 +967,31 @@ static int32_t PinctrlSettingsGet(const scmi_caller_t *caller,
     {
         status = SM_ERR_INVALID_PARAMETERS;
     }
-    if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
-    {
-        status = SM_ERR_NOT_SUPPORTED;
-    }
 
     /* Check ID */
-    if ((status == SM_ERR_SUCCESS) && (in->identifier >= SM_NUM_PIN))
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_PIN)
+        && (in->identifier >= SM_NUM_PIN))
     {
         status = SM_ERR_NOT_FOUND;
     }
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_GROUP))
+    {
+#if SM_SCMI_NUM_PIN_GRP > 0
+        if (in->identifier >= SM_SCMI_NUM_PIN_GRP)
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+        else
+        {
+            /* Group settings are read from the first pin */
+            pinId = g_scmiPinGrpPins[
+                g_scmiPinGrpConfig[in->identifier].firstPin];
+            funcSel = s_pinGrpFunc[in->identifier];
+        }
+#else
+        status = SM_ERR_NOT_FOUND;
+#endif
+    }
 
     /* Get only one */
     if (cfg == PINCTRL_CONFIG_FLAG_TYPE)
@@ -807,7 +1045,7 @@ static int32_t PinctrlSettingsGet(const scmi_caller_t *caller,
             if (status == SM_ERR_SUCCESS)
             {
                 /* Get pin config */
-                SM_PINCONFIGGET(type, in->identifier, &value);
+                SM_PINCONFIGGET(type, pinId, &value);
 
                 /* Copy out data */
                 out->configs[index].type = configList[index + skipConfigs];
@@ -834,7 +1072,14 @@ static int32_t PinctrlSettingsGet(const scmi_caller_t *caller,
         }
 
         /* Update function */
-        out->functionSelected = PINCTRL_FUNC_NONE;
+        if (funcSel == 0U)
+        {
+            out->functionSelected = PINCTRL_FUNC_NONE;
+        }
+        else
+        {
+            out->functionSelected = funcSel - 1U;
+        }
     }
 
     /* Return status */
@@ -924,12 +1169,17 @@ static int32_t PinctrlSettingsConfigure(const scmi_caller_t *caller,
     {
         status = SM_ERR_INVALID_PARAMETERS;
     }
-    if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
+
+    /* Configure group */
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_GROUP))
     {
-        status = SM_ERR_NOT_SUPPORTED;
+#if SM_SCMI_NUM_PIN_GRP > 0
+        status = PinctrlGrpConfigure(caller, in, numConfigs);
+#else
+        status = SM_ERR_NOT_FOUND;
+#endif
     }
-
-    if (status == SM_ERR_SUCCESS)
+    else if (status == SM_ERR_SUCCESS)
     {
         uint32_t daisyId = 0U;
 
@@ -992,9 +1242,21 @@ static int32_t PinctrlSettingsConfigure(const scmi_caller_t *caller,
             if (status == SM_ERR_SUCCESS)
             {
                 SM_PINCONFIGSET(type, id, value);
+
+#if SM_SCMI_NUM_PIN_GRP > 0
+                /* Pin mux no longer matches any group function */
+                if (type == DEV_SM_PIN_TYPE_MUX)
+                {
+                    PinctrlGrpFuncClear(id);
+                }
+#endif
             }
         }
     }
+    else
+    {
+        ; /* Intentional empty else */
+    }
 
     /* Return status */
     return status;
@@ -1044,23 +1306,49 @@ static int32_t PinctrlRequest(const scmi_caller_t *caller,
     }
 
     /* Check selector */
-    if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
+    if ((status == SM_ERR_SUCCESS) && (sel > PINCTRL_SEL_GROUP))
     {
         status = SM_ERR_INVALID_PARAMETERS;
     }
 
     /* Check pin */
-    if ((status == SM_ERR_SUCCESS) && (in->identifier >= SM_NUM_PIN))
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_PIN))
     {
-        status = SM_ERR_NOT_FOUND;
+        if (in->identifier >= SM_NUM_PIN)
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+        else if (g_scmiAgentConfig[caller->agentId].pinPerms[in->identifier]
+            < SM_SCMI_PERM_EXCLUSIVE)
+        {
+            status = SM_ERR_DENIED;
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
     }
 
-    /* Check permissions */
-    if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].pinPerms[in->identifier]
-        < SM_SCMI_PERM_EXCLUSIVE))
+    /* Check group */
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_GROUP))
     {
-        status = SM_ERR_DENIED;
+#if SM_SCMI_NUM_PIN_GRP > 0
+        if (in->identifier >= SM_SCMI_NUM_PIN_GRP)
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+        else if (g_scmiAgentConfig[caller->agentId].pinGrpPerms[
+            in->identifier] < SM_SCMI_PERM_EXCLUSIVE)
+        {
+            status = SM_ERR_DENIED;
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+#else
+        status = SM_ERR_NOT_FOUND;
+#endif
     }
 
     /* Return status */
@@ -1104,23 +1392,49 @@ static int32_t PinctrlRelease(const scmi_caller_t *caller,
     }
 
     /* Check selector */
-    if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
+    if ((status == SM_ERR_SUCCESS) && (sel > PINCTRL_SEL_GROUP))
     {
         status = SM_ERR_INVALID_PARAMETERS;
     }
 
     /* Check pin */
-    if ((status == SM_ERR_SUCCESS) && (in->identifier >= SM_NUM_PIN))
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_PIN))
     {
-        status = SM_ERR_NOT_FOUND;
+        if (in->identifier >= SM_NUM_PIN)
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+        else if (g_scmiAgentConfig[caller->agentId].pinPerms[in->identifier]
+            < SM_SCMI_PERM_EXCLUSIVE)
+        {
+            status = SM_ERR_DENIED;
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
     }
 
-    /* Check permissions */
-    if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].pinPerms[in->identifier]
-        < SM_SCMI_PERM_EXCLUSIVE))
+    /* Check group */
+    if ((status == SM_ERR_SUCCESS) && (sel == PINCTRL_SEL_GROUP))
     {
-        status = SM_ERR_DENIED;
+#if SM_SCMI_NUM_PIN_GRP > 0
+        if (in->identifier >= SM_SCMI_NUM_PIN_GRP)
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+        else if (g_scmiAgentConfig[caller->agentId].pinGrpPerms[
+            in->identifier] < SM_SCMI_PERM_EXCLUSIVE)
+        {
+            status = SM_ERR_DENIED;
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+#else
+        status = SM_ERR_NOT_FOUND;
+#endif
     }
 
     /* Return status */
@@ -1189,7 +1503,227 @@ static int32_t PinctrlResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
+#if SM_SCMI_NUM_PIN_GRP > 0
+    /* Forget functions selected on groups the agent controls */
+    for (uint32_t grpId = 0U; grpId < SM_SCMI_NUM_PIN_GRP; grpId++)
+    {
+        if (g_scmiAgentConfig[agentId].pinGrpPerms[grpId]
+            >= SM_SCMI_PERM_EXCLUSIVE)
+        {
+            s_pinGrpFunc[grpId] = 0U;
+        }
+    }
+#endif
+
+    /* Return status */
+    return status;
+}
+
+#if SM_SCMI_NUM_PIN_GRP > 0
+/*--------------------------------------------------------------------------*/
+/* Set pin group configuration                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in: Pointer to PINCTRL_SETTINGS_CONFIGURE request                      */
+/* - numConfigs: Number of configs in the request                           */
+/*                                                                          */
+/* Applies the selected function and all configs to every pin in the group. */
+/* Permissions are checked once for the group using the group permissions   */
+/* precomputed by the config tool. The function and all configs are checked */
+/* before any pin is changed.                                               */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_NOT_FOUND: if the identifier does not point to a valid group.   */
+/* - SM_ERR_INVALID_PARAMETERS: if the function is not associated with the  */
+/*   group.                                                                 */
+/* - SM_ERR_NOT_SUPPORTED: if a config type is not supported.               */
+/* - SM_ERR_DENIED: if the calling agent is not allowed to set the group.   */
+/*--------------------------------------------------------------------------*/
+static int32_t PinctrlGrpConfigure(const scmi_caller_t *caller,
+    const msg_rpinctrl6_t *in, uint32_t numConfigs)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    const scmi_pin_grp_config_t *grp = NULL;
+    const uint16_t *pins = NULL;
+    uint32_t grpId = in->identifier;
+    bool funcValid = (PINCTRL_SET_ATTR_FUNCTION(in->attributes) != 0U);
+    uint32_t funcSel = 0U;
+
+    /* Check group */
+    if (grpId >= SM_SCMI_NUM_PIN_GRP)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    else
+    {
+        grp = &g_scmiPinGrpConfig[grpId];
+        pins = &g_scmiPinGrpPins[grp->firstPin];
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (g_scmiAgentConfig[caller->agentId].pinGrpPerms[grpId]
+        < SM_SCMI_PERM_EXCLUSIVE))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check function */
+    if ((status == SM_ERR_SUCCESS) && funcValid
+        && (in->functionId != PINCTRL_FUNC_NONE))
+    {
+#if SM_SCMI_NUM_PIN_FUNC > 0
+        if ((in->functionId >= SM_SCMI_NUM_PIN_FUNC)
+            || (g_scmiPinFuncConfig[in->functionId].grp != grpId))
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+        else
+        {
+            funcSel = in->functionId + 1U;
+        }
+#else
+        status = SM_ERR_INVALID_PARAMETERS;
+#endif
+    }
+
+    /* Check configs */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t daisyId = 0U;
+
+        for (uint32_t cf = 0U; cf < numConfigs; cf++)
+        {
+            switch (in->configs[cf].type)
+            {
+                case PINCTRL_TYPE_DAISY_ID:
+                    daisyId = in->configs[cf].value;
+                    break;
+                case PINCTRL_TYPE_DAISY_CFG:
+                    /* Daisy is shared, so checked once */
+                    if (daisyId >= SM_NUM_DAISY)
+                    {
+                        status = SM_ERR_NOT_FOUND;
+                    }
+                    else if (g_scmiAgentConfig[caller->agentId].daisyPerms[
+                        daisyId] < SM_SCMI_PERM_EXCLUSIVE)
+                    {
+                        status = SM_ERR_DENIED;
+                    }
+                    else
+                    {
+                        ; /* Intentional empty else */
+                    }
+                    break;
+                case PINCTRL_TYPE_MUX:
+                    /* Raw mux replaces any function */
+                    funcValid = true;
+                    funcSel = 0U;
+                    break;
+                case PINCTRL_TYPE_CONFIG:
+                case PINCTRL_TYPE_EXT:
+                    break;
+                default:
+                    status = SM_ERR_NOT_SUPPORTED;
+                    break;
+            }
+
+            /* Stop on error */
+            if (status != SM_ERR_SUCCESS)
+            {
+                break;
+            }
+        }
+    }
+
+#if SM_SCMI_NUM_PIN_FUNC > 0
+    /* Select function */
+    if ((status == SM_ERR_SUCCESS) && (funcSel != 0U))
+    {
+        uint32_t mux = g_scmiPinFuncConfig[funcSel - 1U].mux;
+
+        /* Update mux of all pins */
+        for (uint32_t idx = 0U; idx < grp->numPins; idx++)
+        {
+            SM_PINCONFIGSET(DEV_SM_PIN_TYPE_MUX, pins[idx], mux);
+            PinctrlGrpFuncClear(pins[idx]);
+        }
+    }
+#endif
+
+    /* Apply configs */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t daisyId = 0U;
+
+        for (uint32_t cf = 0U; cf < numConfigs; cf++)
+        {
+            uint32_t type = in->configs[cf].type;
+            uint32_t value = in->configs[cf].value;
+
+            /* Determine parameters */
+            switch (type)
+            {
+                case PINCTRL_TYPE_DAISY_ID:
+                    daisyId = value;
+                    break;
+                case PINCTRL_TYPE_DAISY_CFG:
+                    SM_PINCONFIGSET(DEV_SM_PIN_TYPE_DAISY, daisyId, value);
+                    break;
+                default:
+                    if (type == PINCTRL_TYPE_MUX)
+                    {
+                        type = DEV_SM_PIN_TYPE_MUX;
+                    }
+                    else if (type == PINCTRL_TYPE_CONFIG)
+                    {
+                        type = DEV_SM_PIN_TYPE_CONFIG;
+                    }
+                    else
+                    {
+                        type = DEV_SM_PIN_TYPE_EXT;
+                    }
+
+                    /* Update all pins */
+                    for (uint32_t idx = 0U; idx < grp->numPins; idx++)
+                    {
+                        SM_PINCONFIGSET(type, pins[idx], value);
+                        if (type == DEV_SM_PIN_TYPE_MUX)
+                        {
+                            PinctrlGrpFuncClear(pins[idx]);
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+
+    /* Record function */
+    if ((status == SM_ERR_SUCCESS) && funcValid)
+    {
+        s_pinGrpFunc[grpId] = (uint16_t) funcSel;
+    }
+
     /* Return status */
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Clear the function of all groups containing a pin                        */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - pinId: Pin whose mux changed                                           */
+/*--------------------------------------------------------------------------*/
+static void PinctrlGrpFuncClear(uint32_t pinId)
+{
+    const scmi_pin_grp_idx_t *idx = &g_scmiPinGrpIdx[pinId];
+
+    /* Loop over groups containing the pin */
+    for (uint32_t ref = 0U; ref < idx->numGrp; ref++)
+    {
+        s_pinGrpFunc[g_scmiPinGrpRefs[idx->firstGrp + ref]] = 0U;
+    }
+}
+#endif
+
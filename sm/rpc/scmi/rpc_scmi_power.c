@@ -203,7 +203,7 @@ static int32_t PowerProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rpower2_t *in, msg_tpower2_t *out);
 static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
     const msg_rpower3_t *in, msg_tpower3_t *out);
-static int32_t PowerStateSet(const scmi_caller_t *caller,
+static int32_t PowerStateSet(scmi_caller_t *caller,
     const msg_rpower4_t *in, const scmi_msg_status_t *out);
 static int32_t PowerStateGet(const scmi_caller_t *caller,
     const msg_rpower5_t *in, msg_tpower5_t *out);
@@ -295,14 +295,26 @@ int32_t RPC_SCMI_PowerDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
 
+/* Local types */
+
+/* Deferred POWER_STATE_SET response */
+typedef struct
+{
+    uint32_t header;    /* Header of the request */
+    uint32_t domainId;  /* Domain in transition */
+    bool pending;       /* Response pending */
+} power_defer_t;
+
 /* Local variables */
 
 static uint8_t s_powerState[SM_NUM_POWER][SM_SCMI_NUM_AGNT];
+static uint32_t s_powerDirty[SM_SCMI_NUM_AGNT][SCMI_DIRTY_WORDS(SM_NUM_POWER)];
+static power_defer_t s_powerDefer[SM_SCMI_NUM_CHN];
 
 /* Local functions */
 
 static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
-    uint32_t domainId, uint32_t powerState);
+    uint32_t domainId, uint32_t powerState, bool *pending);
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -566,6 +578,10 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
 /*  Access macros:                                                          */
 /* - POWER_FLAGS_ASYNC() - Async flag                                       */
 /*                                                                          */
+/* A synchronous request that starts a hardware sequence is answered with a */
+/* delayed response when the transition completes (see                     */
+/* RPC_SCMI_PowerComplete()). The SM services other agents meanwhile.       */
+/*                                                                          */
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: for a power domain that can only be set                */
 /*   synchronously, this status is returned after the power domain has      */
@@ -583,11 +599,12 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
 /*   exclusive to another agent.                                            */
 /* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
-static int32_t PowerStateSet(const scmi_caller_t *caller,
+static int32_t PowerStateSet(scmi_caller_t *caller,
     const msg_rpower4_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
     bool async = POWER_FLAGS_ASYNC(in->flags) != 0U;
+    bool pending = false;
     uint32_t agentId = caller->agentId;
     uint8_t state = DEV_SM_POWER_STATE_OFF;
 
@@ -637,7 +654,18 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
 
         /* Update tracking */
         status = PowerStateUpdate(caller->lmId, agentId, in->domainId,
-            state);
+            state, &pending);
+    }
+
+    /* Defer response until the transition completes */
+    if ((status == SM_ERR_SUCCESS) && pending)
+    {
+        power_defer_t *defer = &s_powerDefer[caller->scmiChannel];
+
+        defer->header = caller->header;
+        defer->domainId = in->domainId;
+        defer->pending = true;
+        caller->deferred = true;
     }
 
     /* Return status */
@@ -756,6 +784,38 @@ static int32_t PowerNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Complete deferred responses                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - trigger->parm[0]: Power domain that completed                          */
+/* - trigger->parm[1]: Status of the transition                             */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PowerComplete(const lmm_rpc_trigger_t *trigger)
+{
+    uint32_t domainId = trigger->parm[0];
+    int32_t status = (int32_t) trigger->parm[1];
+
+    /* Loop over channels */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        power_defer_t *defer = &s_powerDefer[scmiChannel];
+        uint32_t agentId = g_scmiChannelConfig[scmiChannel].agentId;
+
+        /* Waiting on this domain in this instance? */
+        if (defer->pending && (defer->domainId == domainId)
+            && (g_scmiAgentConfig[agentId].scmiInst == trigger->rpcInst))
+        {
+            defer->pending = false;
+            RPC_SCMI_A2pDeferredTx(scmiChannel, defer->header, status);
+        }
+    }
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -768,15 +828,32 @@ static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t domainId;
 
-    /* Loop over all power domains */
-    for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
+    /* Abort deferred responses to the agent */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        power_defer_t *defer = &s_powerDefer[scmiChannel];
+
+        if (defer->pending
+            && (g_scmiChannelConfig[scmiChannel].agentId == agentId))
+        {
+            defer->pending = false;
+            RPC_SCMI_A2pDeferredTx(scmiChannel, defer->header,
+                SM_ERR_ABORT_ERROR);
+        }
+    }
+
+    /* Loop over power domains changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_powerDirty[agentId],
+        SCMI_DIRTY_WORDS(SM_NUM_POWER), &domainId))
     {
         /* Turn off power */
         if (s_powerState[domainId][agentId] != DEV_SM_POWER_STATE_OFF)
         {
             (void) PowerStateUpdate(lmId, agentId, domainId,
-                DEV_SM_POWER_STATE_OFF);
+                DEV_SM_POWER_STATE_OFF, NULL);
         }
     }
 
@@ -792,9 +869,10 @@ static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
 /* - agentId: Message to update                                             */
 /* - domainId: Voltage domain                                               */
 /* - powerState: New power state                                            */
+/* - pending: Return if transition in flight, NULL to wait for completion   */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
-    uint32_t domainId, uint32_t powerState)
+    uint32_t domainId, uint32_t powerState, bool *pending)
 {
     int32_t status = SM_ERR_SUCCESS;
 
@@ -813,6 +891,10 @@ static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
 
         /* Record agent power state for this domain */
         s_powerState[domainId][agentId] = (uint8_t) powerState;
+        if (powerState != DEV_SM_POWER_STATE_OFF)
+        {
+            RPC_SCMI_DirtySet(s_powerDirty[agentId], domainId);
+        }
 
         /* Calculate new aggregate state for the domain */
         for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
@@ -825,7 +907,15 @@ static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
         }
 
         /* Inform LMM of power state, LMM will check if changed */
-        status = LMM_PowerStateSet(lmId, domainId, maxPowerState);
+        if (pending == NULL)
+        {
+            status = LMM_PowerStateSet(lmId, domainId, maxPowerState);
+        }
+        else
+        {
+            status = LMM_PowerStateSetAsync(lmId, domainId, maxPowerState,
+                pending);
+        }
     }
 
     /* Return status */
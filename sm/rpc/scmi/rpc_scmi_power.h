@@ -78,6 +78,20 @@
 int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId);
 
+/*!
+ * Complete deferred SCMI power protocol responses.
+ *
+ * @param[in]     trigger     Data associated with the completion
+ *
+ * This function sends the delayed responses for POWER_STATE_SET requests
+ * on agents of the instance that were waiting on the split-phase power
+ * transition of domain \a trigger->parm[0]. The status of the transition
+ * is in \a trigger->parm[1].
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ */
+int32_t RPC_SCMI_PowerComplete(const lmm_rpc_trigger_t *trigger);
+
 /*!
  * Dispatch SCMI power protocol reset.
  *
@@ -497,6 +497,8 @@ int32_t RPC_SCMI_SensorDispatchReset(uint32_t lmId, uint32_t agentId,
 
 static uint32_t s_sensorState[SM_NUM_SENSOR];
 static uint32_t s_sensorNotify[SM_SCMI_NUM_AGNT];
+static uint32_t s_sensorDirty[SM_SCMI_NUM_AGNT]
+    [SCMI_DIRTY_WORDS(SM_NUM_SENSOR)];
 
 /* Local functions */
 
@@ -1414,9 +1416,11 @@ static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t sensorId;
 
-    /* Loop over all sensors */
-    for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+    /* Loop over sensors changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_sensorDirty[agentId],
+        SCMI_DIRTY_WORDS(SM_NUM_SENSOR), &sensorId))
     {
         /* Disable sensor */
         if ((s_sensorState[sensorId] & (1UL << agentId)) != 0U)
@@ -1456,6 +1460,7 @@ static int32_t SensorConfigUpdate(uint32_t lmId, uint32_t agentId,
     {
         /* Mark as enabled */
         s_sensorState[sensorId] |= (1UL << agentId);
+        RPC_SCMI_DirtySet(s_sensorDirty[agentId], sensorId);
     }
     else
     {
@@ -389,6 +389,7 @@ int32_t RPC_SCMI_VoltageDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint8_t s_voltState[SM_NUM_VOLT][SM_SCMI_NUM_AGNT];
+static uint32_t s_voltDirty[SM_SCMI_NUM_AGNT][SCMI_DIRTY_WORDS(SM_NUM_VOLT)];
 
 /* Local functions */
 
@@ -1052,9 +1053,11 @@ static int32_t VoltageResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t domainId;
 
-    /* Loop over all voltage domains */
-    for (uint32_t domainId = 0U; domainId < SM_NUM_VOLT; domainId++)
+    /* Loop over voltage domains changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_voltDirty[agentId],
+        SCMI_DIRTY_WORDS(SM_NUM_VOLT), &domainId))
     {
         /* Turn off voltage */
         if (s_voltState[domainId][agentId] != VOLTAGE_DOMAIN_MODES_OFF)
@@ -1089,6 +1092,10 @@ static int32_t VoltageConfigUpdate(uint32_t lmId, uint32_t agentId,
 
     /* Record agent voltage mode for this domain */
     s_voltState[domainId][agentId] = mode;
+    if (mode != VOLTAGE_DOMAIN_MODES_OFF)
+    {
+        RPC_SCMI_DirtySet(s_voltDirty[agentId], domainId);
+    }
 
     /* Calculate new aggregate state for the domain */
     for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
@@ -207,6 +207,14 @@ void RPC_SMT_Dispatch(uint32_t smtChannel)
             break;
     }
 
+    /* Completion is left to the RPC, which may defer the response */
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete SMT dispatch                                                    */
+/*--------------------------------------------------------------------------*/
+void RPC_SMT_Complete(uint32_t smtChannel)
+{
     /* Not completed? */
     if (s_smtInProgress[smtChannel])
     {
@@ -479,13 +487,11 @@ int32_t RPC_SMT_Rx(uint32_t smtChannel, void* msgRx, uint32_t *len,
             /* Record the length */
             *len = buf->length;
 
-            /* Copy payload */
-            (void) memcpy(msgRx, (const void*) &buf->header, *len);
-
-            /* Check the CRC */
+            /* Copy payload and check the CRC */
             switch (impStatus)
             {
                 case SM_SMT_CRC_XOR:
+                    (void) memcpy(msgRx, (const void*) &buf->header, *len);
                     if (buf->impCrc != CRC_Xor((const uint32_t*) msgRx,
                         *len / 4U))
                     {
@@ -493,21 +499,21 @@ int32_t RPC_SMT_Rx(uint32_t smtChannel, void* msgRx, uint32_t *len,
                     }
                     break;
                 case SM_SMT_CRC_CRC32:
-                    if (buf->impCrc != CRC_Crc32((const uint8_t*) msgRx,
-                        *len))
+                    if (buf->impCrc != CRC_Crc32Copy((uint8_t*) msgRx,
+                        (const uint8_t*) &buf->header, *len))
                     {
                         status = SM_ERR_CRC_ERROR;
                     }
                     break;
                 case SM_SMT_CRC_J1850:
-                    if (buf->impCrc != CRC_J1850((const uint8_t*) msgRx,
-                        *len))
+                    if (buf->impCrc != CRC_J1850Copy((uint8_t*) msgRx,
+                        (const uint8_t*) &buf->header, *len))
                     {
                         status = SM_ERR_CRC_ERROR;
                     }
                     break;
                 default:
-                    ; /* Intentional empty while */
+                    (void) memcpy(msgRx, (const void*) &buf->header, *len);
                     break;
             }
         }
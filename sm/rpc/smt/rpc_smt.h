@@ -113,10 +113,22 @@ bool RPC_SMT_ChannelFree(uint32_t smtChannel);
  * This function dispatches an SMT doorbell interrupt. The \a smtChannel
  * parameter is used to index into the local const SMT config structure
  * to find the linked RPC type and RPC channel. The RPC disptch function
- * is then called.
+ * is then called. Completion is left to the RPC via RPC_SMT_Complete()
+ * so the response can be deferred.
  */
 void RPC_SMT_Dispatch(uint32_t smtChannel);
 
+/*!
+ * Complete SMT dispatch.
+ *
+ * @param[in]     smtChannel  SMT channel
+ *
+ * This function forces completion of a message the RPC left in
+ * progress on \a smtChannel, marking the channel in error. Called by
+ * the RPC once a message is serviced or a deferred response is sent.
+ */
+void RPC_SMT_Complete(uint32_t smtChannel);
+
 /*!
  * Get SMT doorbell state and clear.
  *
@@ -79,6 +79,7 @@ void TEST_DevSmFuse(void)
     NECHECK(DEV_SM_FuseInfoGet(DEV_SM_NUM_OTP, NULL), SM_ERR_NOT_FOUND);
 
     SM_TestModeSet(SM_TEST_MODE_EXEC_LVL1);
+    DEV_SM_FuseInit();
 #ifdef INC_LIBC
     uint32_t fuseVal = DEV_SM_FuseGet(DEV_SM_FUSE_ECID0);
     SM_TestModeSet(SM_TEST_MODE_OFF);
@@ -88,6 +89,9 @@ void TEST_DevSmFuse(void)
     SM_TestModeSet(SM_TEST_MODE_OFF);
 #endif
 
+    /* Restore fuse snapshot */
+    DEV_SM_FuseInit();
+
     (void) DEV_SM_FusePdDisabled(DEV_SM_PD_A55C0);
     (void) DEV_SM_FuseCpuDisabled(DEV_SM_FUSE_A55_CORE0_DISABLE);
 #endif
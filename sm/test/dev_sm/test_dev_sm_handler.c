@@ -273,6 +273,9 @@ void TEST_DevSmHandler(void)
     (void) DEV_SM_GetTimerMsec();
 #endif
 
+    /* Reevaluate tick deadlines */
+    DEV_SM_TickUpdate();
+
     uint32_t basePrio = 0U;
     (void) DEV_SM_IrqPrioBaseGet(MU6_B_IRQ_HANDLER, &basePrio);
 
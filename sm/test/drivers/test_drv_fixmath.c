@@ -0,0 +1,182 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* Unit test for the fixed-point division helpers                           */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "test.h"
+#include "fsl_fixmath.h"
+
+/* Local defines */
+
+/* Exhaustive range for the constant divisors */
+#define TEST_FIXMATH_RANGE  0x1000000ULL
+
+/* Random dividends per divisor */
+#define TEST_FIXMATH_RAND   64U
+
+/* Local types */
+
+/* Local variables */
+
+static uint64_t s_fixmathSeed = 0x243F6A8885A308D3ULL;
+
+/* Local functions */
+
+static uint64_t TEST_FixmathRand(void);
+static bool TEST_FixmathCheck(uint64_t n, uint64_t d);
+
+/*--------------------------------------------------------------------------*/
+/* Test fixed-point division helpers                                        */
+/*--------------------------------------------------------------------------*/
+void TEST_DrvFixmath(void)
+{
+    static const uint64_t s_edge[] =
+    {
+        0ULL, 1ULL, 23ULL, 24ULL, 25ULL, 0xFFFFULL, 0x10000ULL,
+        0xFFFFFFFFULL, 0x100000000ULL, 0x100000001ULL,
+        0xFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFEULL,
+        0xFFFFFFFFFFFFFFFFULL
+    };
+    uint32_t numEdge = (uint32_t) (sizeof(s_edge) / sizeof(s_edge[0]));
+    bool ok;
+
+    printf("**** Fixed-Point Math Tests ***\n\n");
+
+    /* Exhaustive low range and edges for tick conversion */
+    printf("FIXMATH_Div24()\n");
+    ok = true;
+    for (uint64_t n = 0ULL; n < TEST_FIXMATH_RANGE; n++)
+    {
+        ok = ok && (FIXMATH_Div24(n) == (n / 24ULL));
+    }
+    for (uint32_t idx = 0U; idx < numEdge; idx++)
+    {
+        ok = ok && (FIXMATH_Div24(s_edge[idx]) == (s_edge[idx] / 24ULL));
+    }
+    for (uint32_t idx = 0U; idx < TEST_FIXMATH_RANGE; idx++)
+    {
+        uint64_t n = TEST_FixmathRand();
+
+        ok = ok && (FIXMATH_Div24(n) == (n / 24ULL));
+    }
+    BCHECK(ok);
+
+    /* Every 16-bit divisor against edges and random dividends */
+    printf("FIXMATH_DivU64U16()\n");
+    ok = true;
+    for (uint32_t d = 1U; d <= 0xFFFFU; d++)
+    {
+        for (uint32_t idx = 0U; idx < numEdge; idx++)
+        {
+            ok = ok && TEST_FixmathCheck(s_edge[idx], d);
+            ok = ok && TEST_FixmathCheck(s_edge[idx] + d, d);
+            ok = ok && TEST_FixmathCheck(s_edge[idx] - d, d);
+        }
+        for (uint32_t idx = 0U; idx < TEST_FIXMATH_RAND; idx++)
+        {
+            uint64_t n = TEST_FixmathRand();
+
+            ok = ok && TEST_FixmathCheck(n, d);
+            ok = ok && TEST_FixmathCheck(n >> (idx & 63U), d);
+        }
+    }
+    BCHECK(ok);
+
+    /* Clock rates up to the max VCO against root dividers */
+    printf("FIXMATH_DivU64U16(rate)\n");
+    ok = true;
+    for (uint64_t rate = 0ULL; rate <= 5000000000ULL; rate += 9973ULL)
+    {
+        for (uint32_t d = 1U; d <= 256U; d += 17U)
+        {
+            ok = ok && (FIXMATH_DivU64U16(rate, d) == (rate / d));
+        }
+    }
+    BCHECK(ok);
+
+    /* General divisor */
+    printf("FIXMATH_DivU64()\n");
+    ok = true;
+    for (uint32_t idx = 0U; idx < TEST_FIXMATH_RANGE; idx++)
+    {
+        uint64_t n = TEST_FixmathRand() >> (idx & 63U);
+        uint64_t d = TEST_FixmathRand() >> ((idx >> 6U) & 63U);
+
+        if (d != 0ULL)
+        {
+            ok = ok && (FIXMATH_DivU64(n, d) == (n / d));
+        }
+    }
+    for (uint32_t i = 0U; i < numEdge; i++)
+    {
+        for (uint32_t j = 0U; j < numEdge; j++)
+        {
+            if (s_edge[j] != 0ULL)
+            {
+                ok = ok && (FIXMATH_DivU64(s_edge[i], s_edge[j])
+                    == (s_edge[i] / s_edge[j]));
+            }
+        }
+    }
+    BCHECK(ok);
+
+    printf("\n");
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Pseudo-random 64-bit value (xorshift)                                    */
+/*--------------------------------------------------------------------------*/
+static uint64_t TEST_FixmathRand(void)
+{
+    s_fixmathSeed ^= s_fixmathSeed << 13U;
+    s_fixmathSeed ^= s_fixmathSeed >> 7U;
+    s_fixmathSeed ^= s_fixmathSeed << 17U;
+
+    return s_fixmathSeed;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Compare 16-bit divisor helper to integer division                        */
+/*--------------------------------------------------------------------------*/
+static bool TEST_FixmathCheck(uint64_t n, uint64_t d)
+{
+    return (FIXMATH_DivU64U16(n, U64_U32(d)) == (n / d))
+        && (FIXMATH_DivU64(n, d) == (n / d));
+}
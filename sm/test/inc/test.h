@@ -328,6 +328,9 @@ void TEST_MbMu(void);
 void TEST_MbLoopback(void);
 #endif
 void TEST_UtilitiesConfig(void);
+void TEST_UtilitiesBinlog(void);
+void TEST_UtilitiesTimer(void);
+void TEST_DrvFixmath(void);
 
 #endif
 
@@ -75,6 +75,15 @@ void TEST_LmmPerf(void)
         /* Set the Level */
         printf("LMM_PerfLevelSet(%u, %u)\n", lmId, domainId);
         CHECK(LMM_PerfLevelSet(lmId, domainId, perfLevel, false));
+
+        /* Get the LM vote */
+        {
+            uint32_t vote = 0U;
+
+            printf("LMM_PerfLevelVoteGet(%u, %u)\n", lmId, domainId);
+            CHECK(LMM_PerfLevelVoteGet(lmId, domainId, &vote));
+            BCHECK(vote == perfLevel);
+        }
     }
 
     /* Test API bounds */
@@ -85,6 +94,12 @@ void TEST_LmmPerf(void)
     NECHECK(LMM_PerfLevelSet(SM_NUM_LM, 0U, perfLevel, false),
         SM_ERR_INVALID_PARAMETERS);
 
+    printf("LMM_PerfLevelVoteGet(%u, %u)\n", SM_NUM_LM, SM_NUM_PERF);
+    NECHECK(LMM_PerfLevelVoteGet(SM_NUM_LM, 0U, &perfLevel),
+        SM_ERR_INVALID_PARAMETERS);
+    NECHECK(LMM_PerfLevelVoteGet(lmId, SM_NUM_PERF, &perfLevel),
+        SM_ERR_INVALID_PARAMETERS);
+
     /* NOT FOUND -- domainId */
     printf("LMM_PerfLevelSet(%u, %u)\n", lmId, SM_NUM_PERF);
     NECHECK(LMM_PerfLevelSet(lmId, SM_NUM_PERF, perfLevel, false),
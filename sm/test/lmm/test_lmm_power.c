@@ -79,6 +79,18 @@ void TEST_LmmPower(void)
         {
             CHECK(LMM_PowerStateSet(lmId, domainId, powerState));
             LMM_PowerStateReset(lmId, domainId);
+
+            printf("LMM_PowerStateSetAsync(%u, %u, %u)\n", lmId, domainId,
+                powerState);
+            bool pending = false;
+            CHECK(LMM_PowerStateSetAsync(lmId, domainId, powerState,
+                &pending));
+            printf("  pending=%u\n", pending ? 1U : 0U);
+            while (DEV_SM_PowerPoll())
+            {
+                ; /* Intentional empty while */
+            }
+            LMM_PowerStateReset(lmId, domainId);
         }
         else
         {
@@ -86,6 +98,108 @@ void TEST_LmmPower(void)
         }
     }
 
+    /* Test batch power up */
+    {
+        uint32_t domainMask = 0U;
+
+        for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
+        {
+            if (!DEV_SM_FusePdDisabled(domainId))
+            {
+                domainMask |= 1UL << domainId;
+            }
+        }
+
+        printf("LMM_PowerUpBatch(%u, 0x%08X)\n", lmId, domainMask);
+        CHECK(LMM_PowerUpBatch(lmId, domainMask));
+
+        for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
+        {
+            if ((domainMask & (1UL << domainId)) != 0U)
+            {
+                CHECK(LMM_PowerStateGet(lmId, domainId, &powerState));
+                BCHECK(powerState == DEV_SM_POWER_STATE_ON);
+                CHECK(LMM_PowerStateSet(lmId, domainId,
+                    DEV_SM_POWER_STATE_OFF));
+            }
+        }
+    }
+
+#ifdef SIMU
+    /* Test split-phase power up and conflicting requests */
+    {
+        uint32_t domA = SM_NUM_POWER;
+        uint32_t domB = SM_NUM_POWER;
+        bool pending = false;
+
+        /* Find two domains that can be powered */
+        for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
+        {
+            if (!DEV_SM_FusePdDisabled(domainId))
+            {
+                if (domA == SM_NUM_POWER)
+                {
+                    domA = domainId;
+                }
+                else if (domB == SM_NUM_POWER)
+                {
+                    domB = domainId;
+                }
+                else
+                {
+                    ; /* Intentional empty else */
+                }
+            }
+        }
+        BCHECK(domB < SM_NUM_POWER);
+
+        /* Power up stays in flight until polled */
+        printf("LMM_PowerStateSetAsync(%u, %u, ON)\n", lmId, domA);
+        CHECK(LMM_PowerStateSetAsync(lmId, domA, DEV_SM_POWER_STATE_ON,
+            &pending));
+        BCHECK(pending);
+        CHECK(LMM_PowerStateGet(lmId, domA, &powerState));
+        BCHECK(powerState == DEV_SM_POWER_STATE_OFF);
+
+        /* Same request joins the transition in flight */
+        pending = false;
+        CHECK(LMM_PowerStateSetAsync(lmId, domA, DEV_SM_POWER_STATE_ON,
+            &pending));
+        BCHECK(pending);
+
+        /* Other domains transition independently */
+        printf("LMM_PowerStateSetAsync(%u, %u, ON)\n", lmId, domB);
+        pending = false;
+        CHECK(LMM_PowerStateSetAsync(lmId, domB, DEV_SM_POWER_STATE_ON,
+            &pending));
+        BCHECK(pending);
+        CHECK(LMM_PowerStateGet(lmId, domA, &powerState));
+        BCHECK(powerState == DEV_SM_POWER_STATE_OFF);
+
+        /* Conflicting request queues behind the first */
+        printf("LMM_PowerStateSetAsync(%u, %u, OFF)\n", lmId, domA);
+        pending = false;
+        CHECK(LMM_PowerStateSetAsync(lmId, domA, DEV_SM_POWER_STATE_OFF,
+            &pending));
+        BCHECK(pending);
+        CHECK(LMM_PowerStateGet(lmId, domA, &powerState));
+        BCHECK(powerState == DEV_SM_POWER_STATE_OFF);
+
+        /* Poll completes both, the queued request last */
+        BCHECK(!DEV_SM_PowerPoll());
+        CHECK(LMM_PowerStateGet(lmId, domA, &powerState));
+        BCHECK(powerState == DEV_SM_POWER_STATE_OFF);
+        CHECK(LMM_PowerStateGet(lmId, domB, &powerState));
+        BCHECK(powerState == DEV_SM_POWER_STATE_ON);
+
+        /* Power off is immediate */
+        pending = true;
+        CHECK(LMM_PowerStateSetAsync(lmId, domB, DEV_SM_POWER_STATE_OFF,
+            &pending));
+        BCHECK(!pending);
+    }
+#endif
+
     /* Test API correct calls per power state */
     for (powerState = 0U; powerState < SM_NUM_POWER_STATE;
         powerState++)
@@ -108,6 +222,18 @@ void TEST_LmmPower(void)
     NECHECK(LMM_PowerStateSet(lmId, SM_NUM_POWER, powerState),
         SM_ERR_NOT_FOUND);
 
+    {
+        bool pending = false;
+
+        printf("LMM_PowerStateSetAsync(%u, %lu)\n", lmId, SM_NUM_POWER);
+        NECHECK(LMM_PowerStateSetAsync(lmId, SM_NUM_POWER, powerState,
+            &pending), SM_ERR_NOT_FOUND);
+        BCHECK(!pending);
+    }
+
+    printf("LMM_PowerUpBatch(%u, 0x%08lX)\n", lmId, 1UL << SM_NUM_POWER);
+    NECHECK(LMM_PowerUpBatch(lmId, 1UL << SM_NUM_POWER), SM_ERR_NOT_FOUND);
+
     printf("\n");
 }
 
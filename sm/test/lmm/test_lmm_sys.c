@@ -44,6 +44,7 @@
 #include "lmm.h"
 #include "dev_sm_api.h"
 #include "sm.h"
+#include "timer.h"
 
 /* Local defines */
 
@@ -202,6 +203,106 @@ void TEST_LmmSys(void)
         NECHECK(LM_SystemLmReason(0U, SM_NUM_LM, NULL, NULL),
             SM_ERR_NOT_FOUND);
     }
+
+    /* Graceful shutdown deadline */
+    {
+        uint32_t lmId = 3U, state = 0U, remaining = 0U, overruns = 0U;
+        uint32_t lastOverruns;
+        int32_t errStatus = 0;
+        lmm_rst_rec_t bootRec = { 0 }, shutdownRec = { 0 };
+
+        printf("LMM_SystemLmDeadlineGet(%u)\n", lmId);
+        NECHECK(LMM_SystemLmDeadlineGet(SM_NUM_LM, &remaining, &overruns),
+            SM_ERR_NOT_FOUND);
+        CHECK(LMM_SystemLmBoot(0U, 0U, lmId, &g_swReason));
+        CHECK(LMM_SystemLmDeadlineGet(lmId, &remaining, &lastOverruns));
+        BCHECK(remaining == 0U);
+
+        /* Graceful request arms the deadline */
+        CHECK(LMM_SystemLmShutdown(0U, 0U, lmId, true, &g_swReason));
+        CHECK(LMM_SystemLmDeadlineGet(lmId, &remaining, &overruns));
+        BCHECK((remaining != 0U)
+            && (remaining <= g_lmmConfig[lmId].deadline));
+
+        /* Expire and check forced */
+        (void) TIMER_Expire(DEV_SM_Usec64Get()
+            + (g_lmmConfig[lmId].deadline * 1000ULL));
+        (void) TIMER_WorkRun();
+        CHECK(LM_SystemLmStatus(0U, lmId, &state, &errStatus));
+        BCHECK(state == LMM_STATE_LM_OFF);
+        CHECK(LMM_SystemLmDeadlineGet(lmId, &remaining, &overruns));
+        BCHECK((remaining == 0U) && (overruns == (lastOverruns + 1U)));
+        CHECK(LM_SystemLmReason(0U, lmId, &bootRec, &shutdownRec));
+        BCHECK((shutdownRec.extLen == 1U)
+            && (shutdownRec.extInfo[0] == g_lmmConfig[lmId].deadline));
+
+        /* Graceful done in time cancels the deadline */
+        CHECK(LMM_SystemLmBoot(0U, 0U, lmId, &g_swReason));
+        CHECK(LMM_SystemLmReset(0U, 0U, lmId, true, true, &g_swReason));
+        CHECK(LMM_SystemLmReset(lmId, 0U, lmId, true, false, &g_swReason));
+        CHECK(LMM_SystemLmDeadlineGet(lmId, &remaining, &overruns));
+        BCHECK((remaining == 0U) && (overruns == (lastOverruns + 1U)));
+
+        /* Restore power state left by earlier tests */
+        CHECK(LMM_PowerStateSet(lmId, DEV_SM_PD_2, DEV_SM_POWER_STATE_OFF));
+    }
+
+    /* Start/stop program steps */
+    {
+        uint32_t lmId = 3U, usec = 0U, num = 0U;
+        const lmm_startstop_t *ss = NULL;
+
+        printf("LMM_SystemLmStepGet(%u)\n", lmId);
+        NECHECK(LMM_SystemLmStepGet(SM_NUM_LM, true, 0U, &ss, &usec),
+            SM_ERR_NOT_FOUND);
+
+        /* Steps are for this LM and mode, CPU in both programs */
+        for (uint32_t prog = 0U; prog < 2U; prog++)
+        {
+            bool cpu = false;
+
+            for (uint32_t step = 0U; LMM_SystemLmStepGet(lmId, prog == 0U,
+                step, &ss, &usec) == SM_ERR_SUCCESS; step++)
+            {
+                BCHECK((ss->lmId == lmId) && (ss->mSel == 0U));
+                cpu = cpu || (ss->ss == LMM_SS_CPU);
+                num++;
+            }
+            BCHECK(cpu);
+        }
+        BCHECK(num == 4U);
+        BCHECK(LM_CpuCheck(lmId, DEV_SM_CPU_2));
+        BCHECK(!LM_CpuCheck(lmId, DEV_SM_CPU_1));
+    }
+
+    /* Warm reset keeps power domains */
+    {
+        uint32_t lmId = 3U, state = 0U, level = 0U;
+        int32_t errStatus = 0;
+        uint8_t powerState = DEV_SM_POWER_STATE_OFF;
+
+        printf("LMM_SystemLmReset(%u) warm\n", lmId);
+        BCHECK(g_lmmConfig[lmId].warm == LMM_WARM_PD);
+        CHECK(LMM_SystemLmBoot(0U, 0U, lmId, &g_swReason));
+        CHECK(LMM_SystemLmReset(0U, 0U, lmId, true, false, &g_swReason));
+        CHECK(LM_SystemLmStatus(0U, lmId, &state, &errStatus));
+        BCHECK(state == LMM_STATE_LM_ON);
+        CHECK(LMM_PowerStateGet(lmId, DEV_SM_PD_2, &powerState));
+        BCHECK(powerState == DEV_SM_POWER_STATE_ON);
+
+        /* Cold reset runs the full program */
+        CHECK(LMM_SystemLmReset(0U, 0U, lmId, false, false, &g_swReason));
+        CHECK(LM_SystemLmStatus(0U, lmId, &state, &errStatus));
+        BCHECK(state == LMM_STATE_LM_ON);
+
+        /* Setting the current perf level again is a no-op */
+        CHECK(LMM_PerfLevelGet(lmId, 0U, &level));
+        CHECK(LMM_PerfLevelSet(lmId, 0U, level, false));
+        CHECK(LMM_PerfLevelSet(lmId, 0U, 0U, false));
+
+        /* Restore power state */
+        CHECK(LMM_PowerStateSet(lmId, DEV_SM_PD_2, DEV_SM_POWER_STATE_OFF));
+    }
 #endif
 
     printf("\n");
@@ -75,5 +75,15 @@ void TEST_LmmVoltage(void)
     /* Case 3: Invalid lmId && domainId */
     NECHECK(LMM_VoltageModeSet(SM_NUM_LM, SM_NUM_VOLT, 0U),
         SM_ERR_INVALID_PARAMETERS);
+
+    /* Vote get -- Invalid Params */
+    {
+        uint8_t voltMode = 0U;
+
+        NECHECK(LMM_VoltageModeVoteGet(SM_NUM_LM, 0U, &voltMode),
+            SM_ERR_INVALID_PARAMETERS);
+        NECHECK(LMM_VoltageModeVoteGet(0U, SM_NUM_VOLT, &voltMode),
+            SM_ERR_INVALID_PARAMETERS);
+    }
 }
 
@@ -82,6 +82,16 @@ void TEST_MbLoopback(void)
     /* Get doorbell state */
     (void) MB_LOOPBACK_DoorbellState(0U, 0U);
 
+    /* Nothing pending when not deferred */
+    BCHECK(MB_LOOPBACK_Service() == 0U);
+
+    /* Invalid deferred ring is not marked pending */
+    MB_LOOPBACK_DeferSet(true);
+    NECHECK(MB_LOOPBACK_DoorbellRing(0U, SM_NUM_MB_LB_DB),
+        SM_ERR_OUT_OF_RANGE);
+    BCHECK(MB_LOOPBACK_Service() == 0U);
+    MB_LOOPBACK_DeferSet(false);
+
     printf("\n");
 }
 
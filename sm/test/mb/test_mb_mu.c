@@ -43,6 +43,8 @@
 #include "test.h"
 #include "mb_mu.h"
 #include "config_mb_mu.h"
+#include "rpc_smt.h"
+#include "fsl_mu.h"
 
 /* Local defines */
 
@@ -74,6 +76,60 @@ void TEST_MbMu(void)
     NECHECK(MB_MU_IsAborted(0U, SM_NUM_MB_MU_DB),
         SM_ERR_OUT_OF_RANGE);
 
+    /* Stats */
+    {
+        mb_mu_stats_t stats;
+
+        CHECK(MB_MU_StatsGet(0U, &stats));
+        NECHECK(MB_MU_StatsGet(SM_NUM_MB_MU, &stats),
+            SM_ERR_OUT_OF_RANGE);
+    }
+
+    /* Doorbells pending at IRQ entry are drained by one IRQ */
+    {
+        static const mb_mu_config_t s_config[SM_NUM_MB_MU] =
+        {
+            SM_MB_MU_CONFIG_DATA
+        };
+        static MU_Type *const s_bases[] = MU_BASE_PTRS;
+        const mb_mu_config_t *cfg = &s_config[0];
+
+        /* Only ring doorbells with no request in flight */
+        if ((cfg->xportType[0] == SM_XPORT_SMT)
+            && (cfg->xportType[1] == SM_XPORT_SMT)
+            && RPC_SMT_ChannelFree(cfg->xportChannel[0])
+            && RPC_SMT_ChannelFree(cfg->xportChannel[1]))
+        {
+            MU_Type *peer = s_bases[((uint32_t) cfg->mu) ^ 1U];
+            mb_mu_stats_t before, after;
+            uint32_t priMask;
+            uint32_t count = 0U;
+
+            CHECK(MB_MU_StatsGet(0U, &before));
+
+            /* Ring two doorbells from the peer side with IRQs masked */
+            printf("MU_TriggerInterrupts(%u, GI0 | GI1)\n", cfg->mu ^ 1U);
+            priMask = DisableGlobalIRQ();
+            CHECK(MU_TriggerInterrupts(peer,
+                (uint32_t) kMU_GenInt0InterruptTrigger
+                | (uint32_t) kMU_GenInt1InterruptTrigger));
+            EnableGlobalIRQ(priMask);
+
+            /* Wait for the IRQ */
+            do
+            {
+                CHECK(MB_MU_StatsGet(0U, &after));
+                count++;
+            }
+            while ((after.numIrq == before.numIrq) && (count < 1000U));
+
+            /* Check both drained in one IRQ */
+            BCHECK(after.numIrq == (before.numIrq + 1U));
+            BCHECK(after.numDb == (before.numDb + 2U));
+            BCHECK(after.maxDb >= 2U);
+        }
+    }
+
     printf("\n");
 }
 
@@ -42,9 +42,13 @@
 
 #include "test_scmi.h"
 #include "scmi_internal.h"
+#include "rpc_scmi.h"
 
 /* Local defines */
 
+/* Scheduler window, matches SM_SCMI_SCHED_WINDOW_USEC */
+#define TEST_SCHED_WINDOW_USEC  1000ULL
+
 /* Local types */
 
 typedef struct
@@ -57,6 +61,12 @@ typedef struct
 
 /* Local functions */
 
+#ifdef SIMU
+static void TEST_ScmiSched(void);
+static void TEST_ScmiSchedPend(uint32_t agentId);
+static uint32_t TEST_ScmiSchedStep(void);
+#endif
+
 /*--------------------------------------------------------------------------*/
 /* Test SCMI protocol                                                       */
 /*--------------------------------------------------------------------------*/
@@ -226,6 +236,27 @@ void TEST_Scmi(void)
             SCMI_ERR_INVALID_PARAMETERS);
     }
 
+    {
+        scmi_sched_stats_t stats = { 0 };
+        uint32_t numMsg = 0U;
+
+        /* Scheduler statistics */
+        printf("RPC_SCMI_SchedStatsGet()\n");
+        for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+        {
+            CHECK(RPC_SCMI_SchedStatsGet(agentId, &stats));
+            numMsg += stats.numMsg;
+        }
+        BCHECK(numMsg != 0U);
+        NECHECK(RPC_SCMI_SchedStatsGet(SM_SCMI_NUM_AGNT, &stats),
+            SM_ERR_OUT_OF_RANGE);
+    }
+
+#ifdef SIMU
+    /* Scheduler service order */
+    TEST_ScmiSched();
+#endif
+
     {
         uint32_t sequences[36] = { 0U };
 
@@ -237,3 +268,113 @@ void TEST_Scmi(void)
     printf("\n");
 }
 
+#ifdef SIMU
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Test SCMI scheduler service order                                        */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiSched(void)
+{
+    scmi_sched_stats_t before = { 0 };
+    scmi_sched_stats_t after = { 0 };
+    uint64_t start;
+
+    printf("RPC_SCMI_Schedule()\n");
+
+    /* Uses simu.cfg: M7 prio=0, AP-S prio=1/weight=2, AP-NS
+       prio=1/budget=1, TEST-NS prio=2 */
+    for (uint32_t agentId = 0U; agentId < 4U; agentId++)
+    {
+        CHECK(RPC_SCMI_AgentInit(agentId));
+    }
+
+    /* Hold scheduler to control each service step */
+    SWI_SchedHold(true);
+
+    /* Priority: M7 first */
+    TEST_ScmiSchedPend(0U);
+    TEST_ScmiSchedPend(1U);
+    TEST_ScmiSchedPend(2U);
+    BCHECK(TEST_ScmiSchedStep() == 0U);
+
+    /* Weight: AP-S serviced twice before AP-NS */
+    BCHECK(TEST_ScmiSchedStep() == 1U);
+    TEST_ScmiSchedPend(1U);
+    BCHECK(TEST_ScmiSchedStep() == 1U);
+    TEST_ScmiSchedPend(1U);
+    start = DEV_SM_Usec64Get();
+    BCHECK(TEST_ScmiSchedStep() == 2U);
+    BCHECK(TEST_ScmiSchedStep() == 1U);
+
+    /* Budget: throttled AP-NS serviced after TEST-NS */
+    CHECK(RPC_SCMI_SchedStatsGet(2U, &before));
+    TEST_ScmiSchedPend(2U);
+    TEST_ScmiSchedPend(3U);
+    if (TEST_ScmiSchedStep() == 3U)
+    {
+        BCHECK(TEST_ScmiSchedStep() == 2U);
+        CHECK(RPC_SCMI_SchedStatsGet(2U, &after));
+        BCHECK(after.numThrottle == (before.numThrottle + 1U));
+    }
+    else
+    {
+        /* Only valid if the budget window expired */
+        BCHECK((DEV_SM_Usec64Get() - start) >= TEST_SCHED_WINDOW_USEC);
+        BCHECK(TEST_ScmiSchedStep() == 3U);
+    }
+
+    /* Nothing left pending */
+    BCHECK(!RPC_SCMI_Schedule());
+
+    SWI_SchedHold(false);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Mark the A2P channel of an agent as pending                              */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiSchedPend(uint32_t agentId)
+{
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        if ((g_scmiChannelConfig[scmiChannel].agentId == agentId)
+            && (g_scmiChannelConfig[scmiChannel].type == SM_SCMI_CHN_A2P))
+        {
+            RPC_SCMI_Dispatch(scmiChannel);
+            break;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Run one scheduler step and return the agent serviced                     */
+/*--------------------------------------------------------------------------*/
+static uint32_t TEST_ScmiSchedStep(void)
+{
+    uint32_t numMsg[SM_SCMI_NUM_AGNT];
+    uint32_t serviced = SM_SCMI_NUM_AGNT;
+    scmi_sched_stats_t stats = { 0 };
+
+    /* Snapshot message counts */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        CHECK(RPC_SCMI_SchedStatsGet(agentId, &stats));
+        numMsg[agentId] = stats.numMsg;
+    }
+
+    (void) RPC_SCMI_Schedule();
+
+    /* Find agent whose count moved */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        CHECK(RPC_SCMI_SchedStatsGet(agentId, &stats));
+        if (stats.numMsg != numMsg[agentId])
+        {
+            serviced = agentId;
+        }
+    }
+
+    return serviced;
+}
+#endif
@@ -41,6 +41,9 @@
 /* Includes */
 #include "test_scmi.h"
 #include "lmm.h"
+#if SM_SCMI_NUM_PIN_GRP > 0
+#include "rpc_scmi_pinctrl.h"
+#endif
 
 /* Local defines */
 
@@ -244,12 +247,13 @@ void TEST_ScmiPinctrl(void)
             attributes, NULL, &numConfigs, configs),
             SCMI_ERR_INVALID_PARAMETERS);
 
-        /* NOT SUPPORTED -- Group */
+        /* NOT FOUND -- Group */
         attributes = SCMI_PINCTRL_GET_ATTR_CONFIG(attr_cfg) |
             SCMI_PINCTRL_GET_ATTR_SELECTOR(1UL);
 
-        NECHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN, 0U,
-            attributes, NULL, &numConfigs, configs), SCMI_ERR_NOT_SUPPORTED);
+        NECHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+            SM_SCMI_NUM_PIN_GRP, attributes, NULL, &numConfigs, configs),
+            SCMI_ERR_NOT_FOUND);
 
         /* NOT SUPPORTED -- Unsupported Custom Config */
         attr_cfg = (uint32_t) SCMI_PINCTRL_CONFIG_FLAG_TYPE;
@@ -289,14 +293,17 @@ void TEST_ScmiPinctrl(void)
         NECHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN, 0U, 0U,
             attributes, configs), SCMI_ERR_INVALID_PARAMETERS);
 
-        /* NOT SUPPORTED -- Group */
+        /* NOT FOUND -- Group */
         attributes = SCMI_PINCTRL_SET_ATTR_NUM_CONFIGS(1U)
             | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
 
-        NECHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN, 0U, 0U,
-            attributes, configs), SCMI_ERR_NOT_SUPPORTED);
+        NECHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+            SM_SCMI_NUM_PIN_GRP, 0U, attributes, configs),
+            SCMI_ERR_NOT_FOUND);
 
         /* NOT SUPPORTED -- Unsupported Custom Config */
+        attributes = SCMI_PINCTRL_SET_ATTR_NUM_CONFIGS(1U)
+            | SCMI_PINCTRL_SET_ATTR_SELECTOR(0U);
         configs[0].type = 255U;
         configs[0].value = 0U;
 
@@ -324,6 +331,13 @@ void TEST_ScmiPinctrl(void)
             SM_ERR_NOT_FOUND);
 
         flags = 1U;
+        NECHECK(SCMI_PinctrlRequest(SM_TEST_DEFAULT_CHN,
+            SM_SCMI_NUM_PIN_GRP, flags), SM_ERR_NOT_FOUND);
+
+        NECHECK(SCMI_PinctrlRelease(SM_TEST_DEFAULT_CHN,
+            SM_SCMI_NUM_PIN_GRP, flags), SM_ERR_NOT_FOUND);
+
+        flags = 2U;
         NECHECK(SCMI_PinctrlRequest(SM_TEST_DEFAULT_CHN, SM_NUM_PIN, flags),
             SM_ERR_INVALID_PARAMETERS);
 
@@ -337,6 +351,249 @@ void TEST_ScmiPinctrl(void)
             SM_ERR_INVALID_PARAMETERS);
     }
 
+    /* List associations -- invalids */
+    {
+        uint32_t numFlags = 0U;
+        uint16_t array[SCMI_PINCTRL_MAX_ARRAY] = { 0 };
+
+        /* INVALID PARAMETERS -- Pin */
+        NECHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN, 0U,
+            SCMI_PINCTRL_FLAGS_SELECTOR(0U), 0U, &numFlags, array),
+            SCMI_ERR_INVALID_PARAMETERS);
+
+        /* NOT FOUND */
+        NECHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN,
+            groups, SCMI_PINCTRL_FLAGS_SELECTOR(1U), 0U, &numFlags, array),
+            SCMI_ERR_NOT_FOUND);
+        NECHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN,
+            functions, SCMI_PINCTRL_FLAGS_SELECTOR(2U), 0U, &numFlags,
+            array), SCMI_ERR_NOT_FOUND);
+        NECHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN, 0U,
+            SCMI_PINCTRL_FLAGS_SELECTOR(3U), 0U, &numFlags, array),
+            SCMI_ERR_NOT_FOUND);
+
+        /* Branch -- Invalid Channel */
+        NECHECK(SCMI_PinctrlListAssociations(SM_SCMI_NUM_CHN, 0U,
+            SCMI_PINCTRL_FLAGS_SELECTOR(1U), 0U, NULL, NULL),
+            SCMI_ERR_INVALID_PARAMETERS);
+    }
+
+#if SM_SCMI_NUM_PIN_GRP > 0
+    /* Groups and functions */
+    {
+        uint32_t agentId = g_scmiChannelConfig[SM_TEST_DEFAULT_CHN].agentId;
+
+        for (uint32_t grpId = 0U; grpId < SM_SCMI_NUM_PIN_GRP; grpId++)
+        {
+            const scmi_pin_grp_config_t *grp = &g_scmiPinGrpConfig[grpId];
+            uint32_t numFlags = 0U;
+            uint16_t array[SCMI_PINCTRL_MAX_ARRAY] = { 0 };
+            bool pass = (g_scmiAgentConfig[agentId].pinGrpPerms[grpId]
+                >= SM_SCMI_PERM_EXCLUSIVE);
+
+            /* List pins */
+            printf("SCMI_PinctrlListAssociations(%u, %u, 1)\n",
+                SM_TEST_DEFAULT_CHN, grpId);
+            CHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN, grpId,
+                SCMI_PINCTRL_FLAGS_SELECTOR(1U), 0U, &numFlags, array));
+            BCHECK(SCMI_PINCTRL_NUM_FLAGS_NUM(numFlags) == grp->numPins);
+            BCHECK(SCMI_PINCTRL_NUM_FLAGS_REMAINING(numFlags) == 0U);
+            for (uint32_t idx = 0U; idx < grp->numPins; idx++)
+            {
+                BCHECK(array[idx] == g_scmiPinGrpPins[grp->firstPin + idx]);
+            }
+
+            /* Check pin to group index */
+            for (uint32_t idx = 0U; idx < grp->numPins; idx++)
+            {
+                const scmi_pin_grp_idx_t *pinIdx =
+                    &g_scmiPinGrpIdx[g_scmiPinGrpPins[grp->firstPin + idx]];
+                bool found = false;
+
+                for (uint32_t ref = 0U; ref < pinIdx->numGrp; ref++)
+                {
+                    if (g_scmiPinGrpRefs[pinIdx->firstGrp + ref] == grpId)
+                    {
+                        found = true;
+                    }
+                }
+                BCHECK(found);
+            }
+
+            /* Index past end */
+            NECHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN,
+                grpId, SCMI_PINCTRL_FLAGS_SELECTOR(1U), grp->numPins,
+                &numFlags, array), SCMI_ERR_INVALID_PARAMETERS);
+
+            /* Branch -- Nullpointers */
+            CHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN, grpId,
+                SCMI_PINCTRL_FLAGS_SELECTOR(1U), 0U, NULL, NULL));
+
+            if (pass)
+            {
+                printf("SCMI_PinctrlRequest(%u, %u, 1)\n",
+                    SM_TEST_DEFAULT_CHN, grpId);
+                CHECK(SCMI_PinctrlRequest(SM_TEST_DEFAULT_CHN, grpId, 1U));
+                CHECK(SCMI_PinctrlRelease(SM_TEST_DEFAULT_CHN, grpId, 1U));
+            }
+            else
+            {
+                printf("SCMI_PinctrlRequest(%u, %u, 1)\n",
+                    SM_TEST_DEFAULT_CHN, grpId);
+                NECHECK(SCMI_PinctrlRequest(SM_TEST_DEFAULT_CHN, grpId, 1U),
+                    SCMI_ERR_DENIED);
+                NECHECK(SCMI_PinctrlRelease(SM_TEST_DEFAULT_CHN, grpId, 1U),
+                    SCMI_ERR_DENIED);
+            }
+        }
+
+        for (uint32_t funcId = 0U; funcId < SM_SCMI_NUM_PIN_FUNC; funcId++)
+        {
+            const scmi_pin_func_config_t *func = &g_scmiPinFuncConfig[funcId];
+            const scmi_pin_grp_config_t *grp = &g_scmiPinGrpConfig[func->grp];
+            uint32_t numFlags = 0U;
+            uint16_t array[SCMI_PINCTRL_MAX_ARRAY] = { 0 };
+            uint32_t attributes = SCMI_PINCTRL_SET_ATTR_FUNCTION(1U)
+                | SCMI_PINCTRL_SET_ATTR_NUM_CONFIGS(0U)
+                | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
+            bool pass = (g_scmiAgentConfig[agentId].pinGrpPerms[func->grp]
+                >= SM_SCMI_PERM_EXCLUSIVE);
+
+            /* List groups */
+            printf("SCMI_PinctrlListAssociations(%u, %u, 2)\n",
+                SM_TEST_DEFAULT_CHN, funcId);
+            CHECK(SCMI_PinctrlListAssociations(SM_TEST_DEFAULT_CHN, funcId,
+                SCMI_PINCTRL_FLAGS_SELECTOR(2U), 0U, &numFlags, array));
+            BCHECK(SCMI_PINCTRL_NUM_FLAGS_NUM(numFlags) == 1U);
+            BCHECK(array[0] == func->grp);
+
+            scmi_pin_config_t configs[SCMI_PINCTRL_MAX_CONFIGS] = { 0 };
+
+            if (pass)
+            {
+                uint32_t functionSelected = 0U;
+                uint32_t getAttr = SCMI_PINCTRL_GET_ATTR_CONFIG(
+                    (uint32_t) SCMI_PINCTRL_CONFIG_FLAG_NONE)
+                    | SCMI_PINCTRL_GET_ATTR_SELECTOR(1UL);
+                uint32_t muxAttr = SCMI_PINCTRL_GET_ATTR_CONFIG(
+                    (uint32_t) SCMI_PINCTRL_CONFIG_FLAG_TYPE)
+                    | SCMI_PINCTRL_GET_ATTR_CONFIG_TYPE(
+                    SCMI_PINCTRL_TYPE_MUX);
+
+                /* Select function for the whole group */
+                printf("SCMI_PinctrlSettingsConfigure(%u, %u, %u)\n",
+                    SM_TEST_DEFAULT_CHN, func->grp, funcId);
+                CHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    func->grp, funcId, attributes, configs));
+
+                /* Check function selected */
+                CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                    func->grp, getAttr, &functionSelected, NULL, NULL));
+                BCHECK(functionSelected == funcId);
+
+                /* Check mux of every pin */
+                for (uint32_t idx = 0U; idx < grp->numPins; idx++)
+                {
+                    CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                        g_scmiPinGrpPins[grp->firstPin + idx], muxAttr,
+                        NULL, NULL, configs));
+                    BCHECK(configs[0].value == func->mux);
+                }
+
+                /* Bulk config of the group */
+                configs[0].type = SCMI_PINCTRL_TYPE_CONFIG;
+                configs[0].value = 0x1U;
+                attributes = SCMI_PINCTRL_SET_ATTR_NUM_CONFIGS(1U)
+                    | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
+                CHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    func->grp, 0U, attributes, configs));
+
+                /* Function of another group */
+                if (SM_SCMI_NUM_PIN_GRP > 1U)
+                {
+                    uint32_t otherGrp = (func->grp + 1U)
+                        % SM_SCMI_NUM_PIN_GRP;
+                    int32_t err = SCMI_ERR_INVALID_PARAMETERS;
+
+                    if (g_scmiAgentConfig[agentId].pinGrpPerms[otherGrp]
+                        < SM_SCMI_PERM_EXCLUSIVE)
+                    {
+                        err = SCMI_ERR_DENIED;
+                    }
+
+                    attributes = SCMI_PINCTRL_SET_ATTR_FUNCTION(1U)
+                        | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
+                    NECHECK(SCMI_PinctrlSettingsConfigure(
+                        SM_TEST_DEFAULT_CHN, otherGrp, funcId, attributes,
+                        configs), err);
+                }
+
+                /* Bad config leaves the group unchanged */
+                configs[0].type = SCMI_PINCTRL_TYPE_CONFIG;
+                configs[0].value = 0x2U;
+                configs[1].type = SCMI_PINCTRL_TYPE_EXT + 1U;
+                configs[1].value = 0x0U;
+                attributes = SCMI_PINCTRL_SET_ATTR_FUNCTION(1U)
+                    | SCMI_PINCTRL_SET_ATTR_NUM_CONFIGS(2U)
+                    | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
+                NECHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    func->grp, SCMI_PINCTRL_FUNC_NONE, attributes, configs),
+                    SCMI_ERR_NOT_SUPPORTED);
+                CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                    func->grp, getAttr, &functionSelected, NULL, NULL));
+                BCHECK(functionSelected == funcId);
+                CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                    func->grp, SCMI_PINCTRL_GET_ATTR_CONFIG(
+                    (uint32_t) SCMI_PINCTRL_CONFIG_FLAG_TYPE)
+                    | SCMI_PINCTRL_GET_ATTR_CONFIG_TYPE(
+                    SCMI_PINCTRL_TYPE_CONFIG)
+                    | SCMI_PINCTRL_GET_ATTR_SELECTOR(1UL), NULL, NULL,
+                    configs));
+                BCHECK(configs[0].value == 0x1U);
+
+                /* Pin mux change drops the group function */
+                configs[0].type = SCMI_PINCTRL_TYPE_MUX;
+                configs[0].value = func->mux;
+                attributes = SCMI_PINCTRL_SET_ATTR_NUM_CONFIGS(1U);
+                CHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    g_scmiPinGrpPins[grp->firstPin], 0U, attributes,
+                    configs));
+                CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                    func->grp, getAttr, &functionSelected, NULL, NULL));
+                BCHECK(functionSelected == SCMI_PINCTRL_FUNC_NONE);
+
+                /* Agent reset drops the group function */
+                attributes = SCMI_PINCTRL_SET_ATTR_FUNCTION(1U)
+                    | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
+                CHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    func->grp, funcId, attributes, configs));
+                CHECK(RPC_SCMI_PinctrlDispatchReset(g_scmiConfig[
+                    g_scmiAgentConfig[agentId].scmiInst].lmId, agentId,
+                    false));
+                CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                    func->grp, getAttr, &functionSelected, NULL, NULL));
+                BCHECK(functionSelected == SCMI_PINCTRL_FUNC_NONE);
+
+                /* Clear function */
+                attributes = SCMI_PINCTRL_SET_ATTR_FUNCTION(1U)
+                    | SCMI_PINCTRL_SET_ATTR_SELECTOR(1U);
+                CHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    func->grp, SCMI_PINCTRL_FUNC_NONE, attributes, configs));
+                CHECK(SCMI_PinctrlSettingsGet(SM_TEST_DEFAULT_CHN,
+                    func->grp, getAttr, &functionSelected, NULL, NULL));
+                BCHECK(functionSelected == SCMI_PINCTRL_FUNC_NONE);
+            }
+            else
+            {
+                printf("SCMI_PinctrlSettingsConfigure(%u, %u, %u)\n",
+                    SM_TEST_DEFAULT_CHN, func->grp, funcId);
+                NECHECK(SCMI_PinctrlSettingsConfigure(SM_TEST_DEFAULT_CHN,
+                    func->grp, funcId, attributes, configs), SCMI_ERR_DENIED);
+            }
+        }
+    }
+#endif
+
     /* PinctrlNegotiateProtocolVersion */
     {
         printf("SCMI_PinctrlNegotiateProtocolVersion(%u)\n",
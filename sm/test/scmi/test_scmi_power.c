@@ -42,6 +42,11 @@
 
 #include "test_scmi.h"
 #include "lmm.h"
+#ifdef SIMU
+#include "scmi_internal.h"
+#include "smt.h"
+#include "rpc_scmi_power.h"
+#endif
 
 /* Local defines */
 
@@ -54,6 +59,14 @@
 static void TEST_ScmiPowerNone(uint32_t channel, uint32_t domainId);
 static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
     uint32_t domainId, uint32_t lmId);
+#ifdef SIMU
+static void TEST_ScmiPowerDefer(uint32_t channel, uint32_t domainId,
+    uint32_t agentId, uint32_t lmId);
+static void TEST_ScmiPowerDirty(uint32_t channel, uint32_t domainId,
+    uint32_t agentId, uint32_t lmId);
+static int32_t TEST_ScmiPowerSetTx(uint32_t channel, uint32_t domainId,
+    uint32_t powerState, uint32_t *header);
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Test SCMI power protocol                                                 */
@@ -63,6 +76,9 @@ void TEST_ScmiPower(void)
     int32_t status = 0;
     uint32_t numDomains = 0U;
     uint32_t agentId, channel, domainId, lmId = 0U;
+#ifdef SIMU
+    bool deferTested = false;
+#endif
 
     /* RPC_00070 RPC_00160 Power domain tests */
     printf("**** Power Domain Protocol Tests ***\n\n");
@@ -186,6 +202,16 @@ void TEST_ScmiPower(void)
         {
             TEST_ScmiPowerSet(perm >= SM_SCMI_PERM_SET, channel, domainId,
                 lmId);
+
+#ifdef SIMU
+            /* Test deferred responses once */
+            if (!deferTested && (perm >= SM_SCMI_PERM_SET))
+            {
+                TEST_ScmiPowerDefer(channel, domainId, agentId, lmId);
+                TEST_ScmiPowerDirty(channel, domainId, agentId, lmId);
+                deferTested = true;
+            }
+#endif
         }
         /* Get next test case */
         status = TEST_ConfigNextGet(TEST_PD, &agentId,
@@ -344,3 +370,136 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
     }
 }
 
+#ifdef SIMU
+/*--------------------------------------------------------------------------*/
+/* Test SCMI power deferred responses                                       */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiPowerDefer(uint32_t channel, uint32_t domainId,
+    uint32_t agentId, uint32_t lmId)
+{
+    uint32_t powerState = 0U;
+    uint32_t header = 0U;
+
+    printf("**** Power Deferred Response Tests ***\n\n");
+
+    /* Start from off */
+    CHECK(SCMI_PowerStateSet(channel, domainId, 0U,
+        SCMI_POWER_DOMAIN_STATE_OFF));
+
+    /* Power up response waits for the transition */
+    printf("POWER_STATE_SET(%u, %u, STATE_ON) deferred\n", channel,
+        domainId);
+    DEV_SM_PowerPollHold(true);
+    CHECK(TEST_ScmiPowerSetTx(channel, domainId,
+        SCMI_POWER_DOMAIN_STATE_ON, &header));
+    BCHECK(!SMT_ChannelFree(channel));
+
+    /* Completion routes LMM_TRIGGER_POWER to the deferred response */
+    DEV_SM_PowerPollHold(false);
+    BCHECK(!DEV_SM_PowerPoll());
+    BCHECK(SMT_ChannelFree(channel));
+    CHECK(SCMI_A2pRx(channel, sizeof(msg_status_t), header));
+    CHECK(SCMI_PowerStateGet(channel, domainId, &powerState));
+    BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_ON);
+
+    /* Agent reset aborts a deferred response */
+    CHECK(SCMI_PowerStateSet(channel, domainId, 0U,
+        SCMI_POWER_DOMAIN_STATE_OFF));
+    printf("RPC_SCMI_PowerDispatchReset(%u, %u) deferred\n", lmId,
+        agentId);
+    DEV_SM_PowerPollHold(true);
+    CHECK(TEST_ScmiPowerSetTx(channel, domainId,
+        SCMI_POWER_DOMAIN_STATE_ON, &header));
+    BCHECK(!SMT_ChannelFree(channel));
+    CHECK(RPC_SCMI_PowerDispatchReset(lmId, agentId, false));
+    BCHECK(SMT_ChannelFree(channel));
+    NECHECK(SCMI_A2pRx(channel, sizeof(msg_status_t), header),
+        SCMI_ERR_ABORT_ERROR);
+    DEV_SM_PowerPollHold(false);
+    BCHECK(!DEV_SM_PowerPoll());
+
+    /* Reset powered off the domain */
+    CHECK(SCMI_PowerStateGet(channel, domainId, &powerState));
+    BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_OFF);
+
+    printf("\n");
+}
+
+/*--------------------------------------------------------------------------*/
+/* Test agent reset only reverts domains touched by the agent               */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiPowerDirty(uint32_t channel, uint32_t domainId,
+    uint32_t agentId, uint32_t lmId)
+{
+    uint8_t powerState = 0U;
+
+    printf("**** Power Agent Reset Tests ***\n\n");
+
+    /* Start with nothing touched by the agent */
+    CHECK(SCMI_PowerStateSet(channel, domainId, 0U,
+        SCMI_POWER_DOMAIN_STATE_OFF));
+    CHECK(RPC_SCMI_PowerDispatchReset(lmId, agentId, false));
+
+    /* Domain turned on outside the agent is left alone */
+    printf("RPC_SCMI_PowerDispatchReset(%u, %u) untouched\n", lmId,
+        agentId);
+    CHECK(LMM_PowerStateSet(lmId, domainId, DEV_SM_POWER_STATE_ON));
+    CHECK(RPC_SCMI_PowerDispatchReset(lmId, agentId, false));
+    CHECK(LMM_PowerStateGet(lmId, domainId, &powerState));
+    BCHECK(powerState == DEV_SM_POWER_STATE_ON);
+    CHECK(LMM_PowerStateSet(lmId, domainId, DEV_SM_POWER_STATE_OFF));
+
+    /* Domain turned on by the agent is reverted */
+    printf("RPC_SCMI_PowerDispatchReset(%u, %u) touched\n", lmId,
+        agentId);
+    CHECK(SCMI_PowerStateSet(channel, domainId, 0U,
+        SCMI_POWER_DOMAIN_STATE_ON));
+    CHECK(LMM_PowerStateGet(lmId, domainId, &powerState));
+    BCHECK(powerState == DEV_SM_POWER_STATE_ON);
+    CHECK(RPC_SCMI_PowerDispatchReset(lmId, agentId, false));
+    CHECK(LMM_PowerStateGet(lmId, domainId, &powerState));
+    BCHECK(powerState == DEV_SM_POWER_STATE_OFF);
+
+    printf("\n");
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send POWER_STATE_SET without waiting for the response                    */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiPowerSetTx(uint32_t channel, uint32_t domainId,
+    uint32_t powerState, uint32_t *header)
+{
+    int32_t status;
+    void *msg;
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t flags;
+            uint32_t domainId;
+            uint32_t powerState;
+        } msg_tpowerd4_t;
+        msg_tpowerd4_t *msgTx = (msg_tpowerd4_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->flags = 0U;
+        msgTx->domainId = domainId;
+        msgTx->powerState = powerState;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, SCMI_PROTOCOL_POWER,
+            SCMI_MSG_POWER_STATE_SET, sizeof(msg_tpowerd4_t), header);
+    }
+
+    /* Return status */
+    return status;
+}
+#endif
+
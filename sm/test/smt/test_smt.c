@@ -42,15 +42,22 @@
 
 #include "test.h"
 #include "rpc_smt.h"
+#include "crc.h"
 
 /* Local defines */
 
+#define TEST_CRC_BUF_LEN    132U
+
 /* Local types */
 
 /* Local variables */
 
 /* Local functions */
 
+static void TEST_SmtCrc(void);
+static uint32_t TEST_Crc32Ref(const uint8_t *addr, uint32_t size);
+static uint8_t TEST_J1850Ref(const uint8_t *addr, uint32_t size);
+
 /*--------------------------------------------------------------------------*/
 /* Test SMT driver                                                          */
 /*--------------------------------------------------------------------------*/
@@ -84,6 +91,98 @@ void TEST_Smt(void)
     (void) RPC_SMT_DoorbellState(0U);
     (void) RPC_SMT_DoorbellState(SM_NUM_SMT_CHN);
 
+    /* CRC engines */
+    TEST_SmtCrc();
+
     printf("\n");
 }
 
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Test CRC engines used by SMT                                             */
+/*--------------------------------------------------------------------------*/
+static void TEST_SmtCrc(void)
+{
+    static uint32_t src[TEST_CRC_BUF_LEN / 4U];
+    static uint32_t dst[TEST_CRC_BUF_LEN / 4U];
+    const uint8_t *s8 = (const uint8_t*) src;
+    uint8_t *d8 = (uint8_t*) dst;
+    const uint8_t check[] = "123456789";
+
+    printf("CRC tests\n");
+
+    /* Known answers */
+    BCHECK(CRC_Crc32(check, 9U) == 0xCBF43926U);
+    BCHECK(CRC_J1850(check, 9U) == 0xB4U);
+    BCHECK(CRC_Crc32(check, 0U) == 0U);
+    BCHECK(CRC_J1850(check, 0U) == 0xFFU);
+
+    /* Fill buffer */
+    for (uint32_t i = 0U; i < TEST_CRC_BUF_LEN; i++)
+    {
+        ((uint8_t*) src)[i] = (uint8_t) ((i * 37U) + 11U);
+    }
+
+    /* Compare against reference at all alignments and lengths */
+    for (uint32_t off = 0U; off < 4U; off++)
+    {
+        for (uint32_t len = 0U; len <= (TEST_CRC_BUF_LEN - 4U); len++)
+        {
+            uint32_t crc32 = TEST_Crc32Ref(&s8[off], len);
+            uint8_t j1850 = TEST_J1850Ref(&s8[off], len);
+
+            BCHECK(CRC_Crc32(&s8[off], len) == crc32);
+            BCHECK(CRC_J1850(&s8[off], len) == j1850);
+
+            /* Fused copy */
+            (void) memset(dst, 0, sizeof(dst));
+            BCHECK(CRC_Crc32Copy(&d8[off], &s8[off], len) == crc32);
+            BCHECK(memcmp(&d8[off], &s8[off], len) == 0);
+            (void) memset(dst, 0, sizeof(dst));
+            BCHECK(CRC_J1850Copy(&d8[off], &s8[off], len) == j1850);
+            BCHECK(memcmp(&d8[off], &s8[off], len) == 0);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Bitwise reference CRC32                                                  */
+/*--------------------------------------------------------------------------*/
+static uint32_t TEST_Crc32Ref(const uint8_t *addr, uint32_t size)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        crc ^= addr[i];
+        for (uint32_t b = 0U; b < 8U; b++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ 0xEDB88320U)
+                : (crc >> 1U);
+        }
+    }
+
+    return ~crc;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Bitwise reference J1850                                                  */
+/*--------------------------------------------------------------------------*/
+static uint8_t TEST_J1850Ref(const uint8_t *addr, uint32_t size)
+{
+    uint32_t crc = 0xFFU;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        crc ^= addr[i];
+        for (uint32_t b = 0U; b < 8U; b++)
+        {
+            crc = ((crc & 0x80U) != 0U) ? (((crc << 1U) ^ 0x1DU) & 0xFFU)
+                : ((crc << 1U) & 0xFFU);
+        }
+    }
+
+    return (uint8_t) crc;
+}
+
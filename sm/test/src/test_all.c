@@ -138,8 +138,13 @@ void TEST_All(void)
     TEST_MbLoopback();
 #endif
 
-#ifdef SIMU
+    /* Run driver tests */
+    TEST_DrvFixmath();
+
     /* Run Utility tests */
+    TEST_UtilitiesBinlog();
+#ifdef SIMU
+    TEST_UtilitiesTimer();
     TEST_UtilitiesConfig();
 #endif
 
@@ -0,0 +1,572 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/* Multi-threaded SCMI stress test for the simulation build.                */
+/*                                                                          */
+/* Build with: make config=simu t=stress                                    */
+/*                                                                          */
+/* The calling thread runs the SM and services loopback doorbells. One host */
+/* thread per test agent issues a random mix of SCMI requests on its own    */
+/* channel. Each response is checked against a reference model captured by */
+/* issuing every request once, single-threaded, before the stress phase.    */
+/*==========================================================================*/
+
+/* Include Config */
+
+/* Includes */
+
+#include "test_scmi.h"
+#include "mb_loopback.h"
+#include "rpc_scmi.h"
+#ifdef SIMU
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+/* Local defines */
+
+/* Requests per agent thread */
+#ifndef STRESS_NUM_REQ
+#define STRESS_NUM_REQ   20000U
+#endif
+
+/* Random seed */
+#ifndef STRESS_SEED
+#define STRESS_SEED      0x5EEDU
+#endif
+
+/* Max agent threads and requests in an agent mix */
+#define STRESS_MAX_AGENT  SM_NUM_TEST_CHN
+#define STRESS_MAX_REQ    64U
+
+/* Latency histogram buckets (log2 of nsec) */
+#define STRESS_NUM_BKT    32U
+
+/* Request types */
+#define STRESS_REQ_BASE_VER  0U
+#define STRESS_REQ_CLK_RATE  1U
+#define STRESS_REQ_PD_GET    2U
+#define STRESS_REQ_PD_SET    3U
+#define STRESS_REQ_PERF_GET  4U
+#define STRESS_REQ_VOLT_GET  5U
+#define STRESS_REQ_SNS_GET   6U
+
+/* Local types */
+
+#ifdef SIMU
+/* Request and modelled response */
+typedef struct
+{
+    uint8_t type;
+    uint32_t rsrc;
+    int32_t status;
+    uint32_t value;
+    bool checkVal;
+} stress_req_t;
+
+/* Agent thread state */
+typedef struct
+{
+    uint32_t agentId;
+    uint32_t channel;
+    uint32_t numReq;
+    stress_req_t req[STRESS_MAX_REQ];
+    uint32_t seed;
+    uint32_t numDone;
+    uint32_t numErr;
+    uint64_t nsec;
+    uint64_t latMin;
+    uint64_t latMax;
+    uint64_t latSum;
+    uint32_t latBkt[STRESS_NUM_BKT];
+} stress_agent_t;
+#endif
+
+/* Local variables */
+
+#ifdef SIMU
+static stress_agent_t s_agent[STRESS_MAX_AGENT];
+static uint32_t s_numAgent = 0U;
+static uint32_t s_running = 0U;
+#endif
+
+/* Local functions */
+
+#ifdef SIMU
+static void TEST_StressBuild(stress_agent_t *agent);
+static void TEST_StressAdd(stress_agent_t *agent, uint8_t type,
+    uint32_t rsrc, bool checkVal);
+static bool TEST_StressOwned(uint8_t testId, uint32_t channel,
+    uint32_t rsrc);
+static int32_t TEST_StressIssue(uint32_t channel, const stress_req_t *req,
+    uint32_t *value);
+static void *TEST_StressAgent(void *arg);
+static void TEST_StressReport(uint64_t nsec);
+static uint64_t TEST_StressNsec(void);
+static uint32_t TEST_StressRand(uint32_t *seed);
+#endif
+
+/*--------------------------------------------------------------------------*/
+/* Stress test                                                              */
+/*--------------------------------------------------------------------------*/
+void TEST_Stress(void)
+{
+    printf("**** SCMI Stress Tests ***\n\n");
+
+#ifdef SIMU
+    static const test_chn_config_t s_testChn[SM_NUM_TEST_CHN] =
+    {
+        SM_TEST_CHN_CONFIG_DATA
+    };
+    pthread_t thread[STRESS_MAX_AGENT];
+    uint64_t start;
+    uint64_t nsec;
+
+    /* One agent thread per test agent, on its first test channel */
+    for (uint32_t chn = 0U; chn < SM_NUM_TEST_CHN; chn++)
+    {
+        bool found = false;
+
+        for (uint32_t idx = 0U; idx < s_numAgent; idx++)
+        {
+            if (s_agent[idx].agentId == s_testChn[chn].agentId)
+            {
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            stress_agent_t *agent = &s_agent[s_numAgent];
+
+            agent->agentId = s_testChn[chn].agentId;
+            agent->channel = chn;
+            agent->seed = STRESS_SEED + (chn * 7919U);
+            agent->latMin = UINT64_MAX;
+            TEST_StressBuild(agent);
+            s_numAgent++;
+        }
+    }
+
+    /* Capture reference responses single-threaded */
+    for (uint32_t idx = 0U; idx < s_numAgent; idx++)
+    {
+        stress_agent_t *agent = &s_agent[idx];
+
+        for (uint32_t r = 0U; r < agent->numReq; r++)
+        {
+            stress_req_t *req = &agent->req[r];
+
+            req->status = TEST_StressIssue(agent->channel, req,
+                &req->value);
+        }
+
+        printf("Agent %u: channel %u, %u request types\n", agent->agentId,
+            agent->channel, agent->numReq);
+    }
+
+    /* Start agents with doorbells deferred to this thread */
+    MB_LOOPBACK_DeferSet(true);
+    s_running = s_numAgent;
+    start = TEST_StressNsec();
+    for (uint32_t idx = 0U; idx < s_numAgent; idx++)
+    {
+        BCHECK(pthread_create(&thread[idx], NULL, TEST_StressAgent,
+            &s_agent[idx]) == 0);
+    }
+
+    /* Run SM: service all rung doorbells, then let the scheduler rank */
+    while (__atomic_load_n(&s_running, __ATOMIC_SEQ_CST) > 0U)
+    {
+        uint32_t num;
+
+        SWI_SchedHold(true);
+        num = MB_LOOPBACK_Service();
+        SWI_SchedHold(false);
+
+        if (num == 0U)
+        {
+            (void) sched_yield();
+        }
+    }
+    nsec = TEST_StressNsec() - start;
+
+    /* Join agents */
+    for (uint32_t idx = 0U; idx < s_numAgent; idx++)
+    {
+        BCHECK(pthread_join(thread[idx], NULL) == 0);
+    }
+    MB_LOOPBACK_DeferSet(false);
+
+    /* Report */
+    TEST_StressReport(nsec);
+
+    /* Check against model */
+    for (uint32_t idx = 0U; idx < s_numAgent; idx++)
+    {
+        BCHECK(s_agent[idx].numErr == 0U);
+        BCHECK(s_agent[idx].numDone == STRESS_NUM_REQ);
+    }
+#else
+    printf("Skipped.\n");
+#endif
+
+    printf("\n");
+}
+
+#ifdef SIMU
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Build the request mix for an agent                                       */
+/*--------------------------------------------------------------------------*/
+static void TEST_StressBuild(stress_agent_t *agent)
+{
+    static const uint8_t s_testIds[] =
+    {
+        TEST_CLK, TEST_PD, TEST_PERF, TEST_VOLT, TEST_SENSOR
+    };
+    static const uint8_t s_types[] =
+    {
+        STRESS_REQ_CLK_RATE, STRESS_REQ_PD_GET, STRESS_REQ_PERF_GET,
+        STRESS_REQ_VOLT_GET, STRESS_REQ_SNS_GET
+    };
+
+    /* Always valid */
+    TEST_StressAdd(agent, STRESS_REQ_BASE_VER, 0U, true);
+
+    /* Invalid resource */
+    TEST_StressAdd(agent, STRESS_REQ_CLK_RATE, 0xFFFFU, true);
+
+    /*
+     * Every resource any agent is configured to test. Accesses to
+     * resources owned by other agents exercise the permission checks.
+     */
+    for (uint32_t t = 0U; t < ARRAY_SIZE(s_testIds); t++)
+    {
+        uint32_t agentId, channel, rsrc, lmId;
+        int32_t status = TEST_ConfigFirstGet(s_testIds[t], &agentId,
+            &channel, &rsrc, &lmId);
+
+        while (status == SM_ERR_SUCCESS)
+        {
+            bool checkVal = true;
+
+            /* Values of shared PDs and sensors vary while running */
+            if ((s_types[t] == STRESS_REQ_PD_GET)
+                || (s_types[t] == STRESS_REQ_SNS_GET))
+            {
+                checkVal = false;
+            }
+            TEST_StressAdd(agent, s_types[t], rsrc, checkVal);
+
+            /* Owner toggles its power domains */
+            if ((s_testIds[t] == TEST_PD) && (channel == agent->channel))
+            {
+                TEST_StressAdd(agent, STRESS_REQ_PD_SET, rsrc, true);
+            }
+
+            status = TEST_ConfigNextGet(s_testIds[t], &agentId, &channel,
+                &rsrc, &lmId);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Add request to an agent mix                                              */
+/*--------------------------------------------------------------------------*/
+static void TEST_StressAdd(stress_agent_t *agent, uint8_t type,
+    uint32_t rsrc, bool checkVal)
+{
+    bool dup = false;
+
+    /* Skip duplicates */
+    for (uint32_t r = 0U; r < agent->numReq; r++)
+    {
+        if ((agent->req[r].type == type) && (agent->req[r].rsrc == rsrc))
+        {
+            dup = true;
+        }
+    }
+
+    /* Values of PDs toggled by an owner are not checked by others */
+    if ((type == STRESS_REQ_PD_GET) && checkVal)
+    {
+        checkVal = !TEST_StressOwned(TEST_PD, SM_NUM_TEST_CHN, rsrc);
+    }
+
+    if (!dup && (agent->numReq < STRESS_MAX_REQ))
+    {
+        stress_req_t *req = &agent->req[agent->numReq];
+
+        req->type = type;
+        req->rsrc = rsrc;
+        req->checkVal = checkVal;
+        agent->numReq++;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if a resource is tested from a channel (any if out of range)       */
+/*--------------------------------------------------------------------------*/
+static bool TEST_StressOwned(uint8_t testId, uint32_t channel,
+    uint32_t rsrc)
+{
+    bool owned = false;
+    uint32_t agentId, chn, r, lmId;
+    int32_t status = TEST_ConfigFirstGet(testId, &agentId, &chn, &r,
+        &lmId);
+
+    while (status == SM_ERR_SUCCESS)
+    {
+        if ((r == rsrc) && ((channel >= SM_NUM_TEST_CHN)
+            || (chn == channel)))
+        {
+            owned = true;
+        }
+        status = TEST_ConfigNextGet(testId, &agentId, &chn, &r, &lmId);
+    }
+
+    return owned;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Issue one request                                                        */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_StressIssue(uint32_t channel, const stress_req_t *req,
+    uint32_t *value)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    *value = 0U;
+
+    switch (req->type)
+    {
+        case STRESS_REQ_BASE_VER:
+            status = SCMI_BaseProtocolVersion(channel, value);
+            break;
+        case STRESS_REQ_CLK_RATE:
+            {
+                scmi_clock_rate_t rate = { 0 };
+
+                status = SCMI_ClockRateGet(channel, req->rsrc, &rate);
+                *value = rate.lower ^ rate.upper;
+            }
+            break;
+        case STRESS_REQ_PD_GET:
+            status = SCMI_PowerStateGet(channel, req->rsrc, value);
+            break;
+        case STRESS_REQ_PD_SET:
+            {
+                uint32_t state = SCMI_POWER_DOMAIN_STATE_OFF;
+
+                /* Toggle off and back on, checking each state */
+                status = SCMI_PowerStateSet(channel, req->rsrc, 0U, state);
+                if (status == SM_ERR_SUCCESS)
+                {
+                    status = SCMI_PowerStateGet(channel, req->rsrc, value);
+                }
+                if ((status == SM_ERR_SUCCESS) && (*value == state))
+                {
+                    state = SCMI_POWER_DOMAIN_STATE_ON;
+                    status = SCMI_PowerStateSet(channel, req->rsrc, 0U,
+                        state);
+                }
+                if (status == SM_ERR_SUCCESS)
+                {
+                    status = SCMI_PowerStateGet(channel, req->rsrc, value);
+                }
+            }
+            break;
+        case STRESS_REQ_PERF_GET:
+            status = SCMI_PerformanceLevelGet(channel, req->rsrc, value);
+            break;
+        case STRESS_REQ_VOLT_GET:
+            {
+                int32_t level = 0;
+
+                status = SCMI_VoltageLevelGet(channel, req->rsrc, &level);
+                *value = (uint32_t) level;
+            }
+            break;
+        default: /* STRESS_REQ_SNS_GET */
+            {
+                scmi_sensor_reading_t reading = { 0 };
+
+                status = SCMI_SensorReadingGet(channel, req->rsrc, 0U,
+                    &reading);
+            }
+            break;
+    }
+
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Agent thread                                                             */
+/*--------------------------------------------------------------------------*/
+static void *TEST_StressAgent(void *arg)
+{
+    stress_agent_t *agent = (stress_agent_t*) arg;
+    uint64_t begin = TEST_StressNsec();
+
+    for (uint32_t n = 0U; n < STRESS_NUM_REQ; n++)
+    {
+        const stress_req_t *req = &agent->req[TEST_StressRand(&agent->seed)
+            % agent->numReq];
+        uint32_t value;
+        int32_t status;
+        uint64_t start = TEST_StressNsec();
+        uint64_t lat;
+        uint32_t bkt = 0U;
+
+        /* Issue and time request */
+        status = TEST_StressIssue(agent->channel, req, &value);
+        lat = TEST_StressNsec() - start;
+
+        /* Check against the model */
+        if ((status != req->status) || (req->checkVal
+            && (status == SM_ERR_SUCCESS) && (value != req->value)))
+        {
+            agent->numErr++;
+        }
+
+        /* Record latency */
+        agent->numDone++;
+        agent->latSum += lat;
+        agent->latMin = MIN(agent->latMin, lat);
+        agent->latMax = MAX(agent->latMax, lat);
+        while (((lat >> bkt) > 1U) && (bkt < (STRESS_NUM_BKT - 1U)))
+        {
+            bkt++;
+        }
+        agent->latBkt[bkt]++;
+    }
+
+    /* Signal done */
+    agent->nsec = TEST_StressNsec() - begin;
+    (void) __atomic_fetch_sub(&s_running, 1U, __ATOMIC_SEQ_CST);
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Report throughput, latency and fairness                                  */
+/*--------------------------------------------------------------------------*/
+static void TEST_StressReport(uint64_t nsec)
+{
+    uint64_t total = 0U;
+    uint64_t sum = 0U;
+    uint64_t sumSq = 0U;
+    uint64_t usec = MAX(nsec / 1000U, 1U);
+
+    printf("\nAgent  Reqs     Err  Min(ns)  Avg(ns)  P50<=ns  P99<=ns"
+        "  Max(ns)  Rate(/s)  Sched msg/skip/maxwait(us)\n");
+
+    for (uint32_t idx = 0U; idx < s_numAgent; idx++)
+    {
+        const stress_agent_t *agent = &s_agent[idx];
+        scmi_sched_stats_t stats = { 0 };
+        uint32_t p50 = 0U;
+        uint32_t p99 = 0U;
+        uint32_t cnt = 0U;
+        uint64_t rate = (((uint64_t) agent->numDone) * 1000000000U)
+            / MAX(agent->nsec, 1U);
+
+        /* Percentiles as log2 histogram bucket upper bounds */
+        for (uint32_t bkt = 0U; bkt < STRESS_NUM_BKT; bkt++)
+        {
+            cnt += agent->latBkt[bkt];
+            if ((p50 == 0U) && ((cnt * 2U) >= agent->numDone))
+            {
+                p50 = 2UL << bkt;
+            }
+            if ((p99 == 0U) && ((cnt * 100U) >= (agent->numDone * 99U)))
+            {
+                p99 = 2UL << bkt;
+            }
+        }
+
+        (void) RPC_SCMI_SchedStatsGet(agent->agentId, &stats);
+
+        printf("%5u  %-7u  %3u  %7u  %7u  %7u  %7u  %7u  %8u  %u/%u/%u\n",
+            agent->agentId, agent->numDone, agent->numErr,
+            (uint32_t) agent->latMin, (uint32_t) (agent->latSum
+            / MAX(agent->numDone, 1U)), p50, p99, (uint32_t) agent->latMax,
+            (uint32_t) rate, stats.numMsg, stats.numSkip,
+            stats.maxWaitUsec);
+
+        total += agent->numDone;
+        sum += rate;
+        sumSq += rate * rate;
+    }
+
+    /* Jain's fairness index of per-agent throughput (x1000) */
+    printf("\nTotal: %u requests in %u us, %u req/s, fairness %u/1000\n",
+        (uint32_t) total, (uint32_t) usec,
+        (uint32_t) ((total * 1000000U) / usec),
+        (uint32_t) ((sum * sum * 1000U) / MAX(sumSq * s_numAgent, 1U)));
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get monotonic time in nsec                                               */
+/*--------------------------------------------------------------------------*/
+static uint64_t TEST_StressNsec(void)
+{
+    struct timespec ts;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t) ts.tv_sec) * 1000000000U) + ((uint64_t) ts.tv_nsec);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Per-thread pseudo random number (xorshift32)                             */
+/*--------------------------------------------------------------------------*/
+static uint32_t TEST_StressRand(uint32_t *seed)
+{
+    uint32_t x = *seed;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *seed = x;
+
+    return x;
+}
+#endif
+
@@ -0,0 +1,109 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* Unit test for the binary log                                             */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "test.h"
+#include "binlog.h"
+
+/* Local defines */
+
+/* Local types */
+
+/* Local variables */
+
+/* Local functions */
+
+/*--------------------------------------------------------------------------*/
+/* Test binary log                                                          */
+/*--------------------------------------------------------------------------*/
+void TEST_UtilitiesBinlog(void)
+{
+    const binlog_t *binlog;
+    uint32_t len;
+    uint32_t head;
+
+    printf("**** Binary Log Tests ***\n\n");
+
+    /* Get log */
+    BINLOG_Get(&binlog, &len);
+    BCHECK(len == sizeof(binlog_t));
+    BCHECK(binlog->magic == BINLOG_MAGIC);
+    BCHECK(binlog->numEntry == BINLOG_NUM_ENTRY);
+    BCHECK(binlog->bootCnt != 0U);
+
+    /* Write entry */
+    head = binlog->head;
+    BINLOG3(BINLOG_ID_LM_START, "test %u %u %u", 1U, 2U, 3U);
+    BCHECK(binlog->head == (head + 1U));
+    {
+        const binlog_entry_t *entry = &binlog->entry[head
+            & (BINLOG_NUM_ENTRY - 1U)];
+
+        BCHECK(BINLOG_HDR_ID(entry->hdr) == BINLOG_ID_LM_START);
+        BCHECK(BINLOG_HDR_ARGC(entry->hdr) == 3U);
+        BCHECK(entry->arg[0] == 1U);
+        BCHECK(entry->arg[1] == 2U);
+        BCHECK(entry->arg[2] == 3U);
+    }
+
+    /* Wrap the ring */
+    for (uint32_t idx = 0U; idx < (BINLOG_NUM_ENTRY + 1U); idx++)
+    {
+        BINLOG1(BINLOG_ID_CPU_START, "test %u", idx);
+    }
+    BCHECK(binlog->head == (head + BINLOG_NUM_ENTRY + 2U));
+    {
+        const binlog_entry_t *entry = &binlog->entry[(binlog->head - 1U)
+            & (BINLOG_NUM_ENTRY - 1U)];
+
+        BCHECK(BINLOG_HDR_ARGC(entry->hdr) == 1U);
+        BCHECK(entry->arg[0] == BINLOG_NUM_ENTRY);
+    }
+
+    /* Clear and reinit */
+    BINLOG_Clear();
+    BCHECK(binlog->head == 0U);
+    BINLOG_Init();
+    BCHECK(binlog->bootCnt == 1U);
+    BCHECK(binlog->head == 1U);
+    BCHECK(BINLOG_HDR_ID(binlog->entry[0].hdr) == BINLOG_ID_BOOT);
+
+    printf("\n");
+}
+
@@ -49,12 +49,31 @@
 /* Used to convert element indexes into hex values */
 #define OFFSET(X)   ((X)*(sizeof(uint32_t)))
 
+/* Stream test sizes */
+#define BENCH_ZERO   32U
+#define BENCH_FILL   64U
+#define BENCH_LIT    96U
+#define BENCH_WORDS  (BENCH_ZERO + BENCH_FILL + BENCH_LIT)
+
 /* Local types */
 
 /* Local variables */
 
+#ifdef SIMU
+// coverity[misra_c_2012_rule_1_2_violation]
+static uint32_t s_benchArr[BENCH_WORDS] __attribute__ ((aligned (65536)));
+static uint32_t s_benchData[BENCH_WORDS];
+static uint32_t s_benchW1[(BENCH_WORDS * 2U) + 1U];
+static uint32_t s_benchCo[BENCH_LIT + 6U];
+#endif
+
 /* Local functions */
 
+#ifdef SIMU
+static void TEST_ConfigStream(void);
+static void TEST_ConfigDelta(void);
+#endif
+
 /* Configuration Tests
     STAGE 1:
         - SM_CFG_W1
@@ -72,6 +91,9 @@
         - SM_CFG_FN (Zero : overwrite)
     STAGE 3:
         - SM_CFG_RP (INVALID_PARAMS)
+    STAGE 4:
+        - SM_CFG_W1/Z1 stream vs. SM_CFG_WN/FN/ZN stream (benchmark)
+        - Delta load
  */
 void TEST_UtilitiesConfig(void)
 {
@@ -205,6 +227,17 @@ void TEST_UtilitiesConfig(void)
             SM_ERR_NOT_FOUND);
         printf("   Successfully caught Err Not Found...\n");
     }
+
+    /* STAGE 4 : =================================================== */
+    {
+        printf("\n** Stage 4 ***\n\n");
+
+        /* Compare word and coalesced streams */
+        TEST_ConfigStream();
+
+        /* Delta load */
+        TEST_ConfigDelta();
+    }
 #else
     printf("Skipped.\n");
 #endif
@@ -212,3 +245,102 @@ void TEST_UtilitiesConfig(void)
     printf("\n");
 }
 
+#ifdef SIMU
+/*--------------------------------------------------------------------------*/
+/* Compare per-word vs. coalesced config streams                            */
+/*--------------------------------------------------------------------------*/
+static void TEST_ConfigStream(void)
+{
+    uint32_t n = 0U;
+
+    /* Data like a TRDC table: zero run, fill run, then literals */
+    for (uint32_t i = 0U; i < BENCH_WORDS; i++)
+    {
+        if (i < BENCH_ZERO)
+        {
+            s_benchData[i] = 0U;
+        }
+        else if (i < (BENCH_ZERO + BENCH_FILL))
+        {
+            s_benchData[i] = 0x33333333U;
+        }
+        else
+        {
+            s_benchData[i] = 0xB0000000U + i;
+        }
+    }
+
+    /* Build word stream as previously generated by the configtool */
+    for (uint32_t i = 0U; i < BENCH_WORDS; i++)
+    {
+        if (s_benchData[i] == 0U)
+        {
+            s_benchW1[n] = SM_CFG_Z1(OFFSET(i));
+            n++;
+        }
+        else
+        {
+            s_benchW1[n] = SM_CFG_W1(OFFSET(i));
+            s_benchW1[n + 1U] = s_benchData[i];
+            n += 2U;
+        }
+    }
+    s_benchW1[n] = SM_CFG_END;
+
+    /* Build coalesced stream */
+    n = 0U;
+    s_benchCo[n] = SM_CFG_ZN(OFFSET(0U), BENCH_ZERO);
+    n++;
+    s_benchCo[n] = SM_CFG_FN(OFFSET(BENCH_ZERO), BENCH_FILL);
+    s_benchCo[n + 1U] = 0x33333333U;
+    n += 2U;
+    s_benchCo[n] = SM_CFG_WN(OFFSET(BENCH_ZERO + BENCH_FILL), BENCH_LIT);
+    n++;
+    for (uint32_t i = BENCH_ZERO + BENCH_FILL; i < BENCH_WORDS; i++)
+    {
+        s_benchCo[n] = s_benchData[i];
+        n++;
+    }
+    s_benchCo[n] = SM_CFG_END;
+
+    /* Check both produce the same result */
+    (void) memset(s_benchArr, 0xFF, sizeof(s_benchArr));
+    CHECK(CONFIG_Load(s_benchArr, s_benchW1));
+    BCHECK(memcmp(s_benchArr, s_benchData, sizeof(s_benchArr)) == 0);
+    (void) memset(s_benchArr, 0xFF, sizeof(s_benchArr));
+    CHECK(CONFIG_Load(s_benchArr, s_benchCo));
+    BCHECK(memcmp(s_benchArr, s_benchData, sizeof(s_benchArr)) == 0);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Test delta load                                                          */
+/*--------------------------------------------------------------------------*/
+static void TEST_ConfigDelta(void)
+{
+    uint32_t numWrite = 0U;
+
+    /* Delta load from cleared only writes non-zero words */
+    (void) memset(s_benchArr, 0, sizeof(s_benchArr));
+    CHECK(CONFIG_LoadDelta(s_benchArr, s_benchCo, &numWrite));
+    BCHECK(numWrite == (BENCH_FILL + BENCH_LIT));
+    BCHECK(memcmp(s_benchArr, s_benchData, sizeof(s_benchArr)) == 0);
+
+    /* Retained content needs no writes */
+    CHECK(CONFIG_LoadDelta(s_benchArr, s_benchW1, &numWrite));
+    BCHECK(numWrite == 0U);
+
+    /* Partially changed content only rewrites changed words */
+    s_benchArr[1] = 0x5U;
+    s_benchArr[BENCH_WORDS - 1U] ^= 0x1U;
+    CHECK(CONFIG_LoadDelta(s_benchArr, s_benchCo, &numWrite));
+    BCHECK(numWrite == 2U);
+    BCHECK(memcmp(s_benchArr, s_benchData, sizeof(s_benchArr)) == 0);
+
+    /* Count is optional */
+    s_benchArr[2] = 0x5U;
+    CHECK(CONFIG_LoadDelta(s_benchArr, s_benchCo, NULL));
+    BCHECK(memcmp(s_benchArr, s_benchData, sizeof(s_benchArr)) == 0);
+
+    printf("   Delta load passed...\n");
+}
+#endif
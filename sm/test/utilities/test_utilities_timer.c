@@ -0,0 +1,180 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/* Unit test for the timer service                                          */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "test.h"
+#include "timer.h"
+
+/* Local defines */
+
+/* Max time to wait for a timer to fire */
+#define TEST_TIMER_WAIT_USEC  100000ULL
+
+/* Local types */
+
+/* Local variables */
+
+static uint32_t s_timerRun[2];
+static uint32_t s_timerOrder;
+#ifdef SIMU
+static timer_work_t s_timerRequeue[2];
+#endif
+
+/* Local functions */
+
+static void TEST_TimerCb(uint32_t cookie);
+#ifdef SIMU
+static void TEST_TimerRequeueCb(uint32_t cookie);
+#endif
+
+/*--------------------------------------------------------------------------*/
+/* Test timer service                                                       */
+/*--------------------------------------------------------------------------*/
+void TEST_UtilitiesTimer(void)
+{
+    timer_work_t work[2];
+    uint64_t start;
+
+    printf("**** Timer Service Tests ***\n\n");
+
+    TIMER_WorkInit(&work[0], TEST_TimerCb, 0U);
+    TIMER_WorkInit(&work[1], TEST_TimerCb, 1U);
+    s_timerRun[0] = 0U;
+    s_timerRun[1] = 0U;
+    s_timerOrder = 0U;
+
+#ifdef SIMU
+    /* Queue deferred work, runs from the scheduler */
+    printf("TIMER_WorkQueue()\n");
+    SWI_SchedHold(true);
+    TIMER_WorkQueue(&work[0]);
+    BCHECK(work[0].state == TIMER_STATE_QUEUED);
+    BCHECK(s_timerRun[0] == 0U);
+    SWI_SchedHold(false);
+    BCHECK(s_timerRun[0] == 1U);
+    BCHECK(work[0].state == TIMER_STATE_IDLE);
+#else
+    s_timerRun[0] = 1U;
+#endif
+
+    /* Arm out of order, earliest first in the list */
+    printf("TIMER_Start()\n");
+    TIMER_Start(&work[0], 20000U);
+    TIMER_Start(&work[1], 1000U);
+    BCHECK(TIMER_NextGet() == work[1].deadline);
+    BCHECK(work[0].deadline > work[1].deadline);
+    BCHECK(!TIMER_Expire(work[1].deadline - 1ULL));
+
+    /* Rearm moves the deadline */
+    TIMER_Start(&work[0], 2000U);
+    BCHECK(work[0].state == TIMER_STATE_ARMED);
+    BCHECK(TIMER_NextGet() == work[1].deadline);
+
+    /* Wait for both to fire in deadline order */
+    s_timerOrder = 0U;
+    start = DEV_SM_Usec64Get();
+    while ((s_timerRun[0] < 2U) || (s_timerRun[1] < 1U))
+    {
+        (void) TIMER_WorkRun();
+        if ((DEV_SM_Usec64Get() - start) > TEST_TIMER_WAIT_USEC)
+        {
+            break;
+        }
+    }
+    BCHECK(s_timerRun[0] == 2U);
+    BCHECK(s_timerRun[1] == 1U);
+    BCHECK(s_timerOrder == 0x10U);
+    BCHECK(TIMER_NextGet() == TIMER_NONE);
+
+    /* Cancel armed and queued items */
+    printf("TIMER_Cancel()\n");
+    TIMER_Start(&work[0], 1000U);
+    TIMER_Cancel(&work[0]);
+    BCHECK(work[0].state == TIMER_STATE_IDLE);
+    BCHECK(TIMER_NextGet() == TIMER_NONE);
+    TIMER_Start(&work[1], 0U);
+    BCHECK(TIMER_Expire(DEV_SM_Usec64Get()));
+    BCHECK(work[1].state == TIMER_STATE_QUEUED);
+    TIMER_Cancel(&work[1]);
+    BCHECK(!TIMER_WorkRun());
+    BCHECK(s_timerRun[1] == 1U);
+
+#ifdef SIMU
+    /* Work run is bounded if a callback cancels and requeues items */
+    printf("TIMER_WorkRun() requeue\n");
+    TIMER_WorkInit(&s_timerRequeue[0], TEST_TimerRequeueCb, 0U);
+    TIMER_WorkInit(&s_timerRequeue[1], TEST_TimerCb, 1U);
+    s_timerRun[0] = 0U;
+    s_timerRun[1] = 0U;
+    SWI_SchedHold(true);
+    TIMER_WorkQueue(&s_timerRequeue[0]);
+    TIMER_WorkQueue(&s_timerRequeue[1]);
+    BCHECK(TIMER_WorkRun());
+    BCHECK(s_timerRun[0] == 2U);
+    BCHECK(s_timerRun[1] == 0U);
+    TIMER_Cancel(&s_timerRequeue[0]);
+    SWI_SchedHold(false);
+#endif
+
+    printf("\n");
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Timer callback, records run order                                        */
+/*--------------------------------------------------------------------------*/
+static void TEST_TimerCb(uint32_t cookie)
+{
+    s_timerRun[cookie]++;
+    s_timerOrder = (s_timerOrder << 4U) | cookie;
+}
+
+#ifdef SIMU
+/*--------------------------------------------------------------------------*/
+/* Timer callback, cancels the other item and requeues itself               */
+/*--------------------------------------------------------------------------*/
+static void TEST_TimerRequeueCb(uint32_t cookie)
+{
+    s_timerRun[cookie]++;
+    TIMER_Cancel(&s_timerRequeue[1]);
+    TIMER_WorkQueue(&s_timerRequeue[0]);
+}
+#endif
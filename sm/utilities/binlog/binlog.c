@@ -0,0 +1,135 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* File containing the implementation of the binary log functions           */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "sm.h"
+#include "binlog.h"
+#include "dev_sm.h"
+
+/* Local defines */
+
+/* Retained across warm reset, not cleared by startup */
+#ifndef SIMU
+#define BINLOG_SECTION  __attribute__((section(".noinit")))
+#else
+#define BINLOG_SECTION
+#endif
+
+/* Local types */
+
+/* Local variables */
+
+// coverity[misra_c_2012_rule_1_2_violation]
+static binlog_t s_binlog BINLOG_SECTION;
+
+/* Local functions */
+
+/*--------------------------------------------------------------------------*/
+/* Init binary log                                                          */
+/*--------------------------------------------------------------------------*/
+void BINLOG_Init(void)
+{
+    /* Ring indexing requires a power of 2 */
+    COMPILE_ASSERT((BINLOG_NUM_ENTRY & (BINLOG_NUM_ENTRY - 1U)) == 0U);
+
+    /* Clear if not left valid by a previous boot */
+    if ((s_binlog.magic != BINLOG_MAGIC)
+        || (s_binlog.numEntry != BINLOG_NUM_ENTRY))
+    {
+        BINLOG_Clear();
+    }
+
+    /* Count boot */
+    s_binlog.bootCnt++;
+
+    /* Mark boot in the log */
+    BINLOG1(BINLOG_ID_BOOT, "boot %u", s_binlog.bootCnt);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Add entry to binary log                                                  */
+/*--------------------------------------------------------------------------*/
+void BINLOG_Write(uint32_t id, uint32_t argc, uint32_t a0, uint32_t a1,
+    uint32_t a2)
+{
+    uint64_t usec = DEV_SM_Usec64Get();
+    binlog_entry_t *entry;
+
+#ifndef SIMU
+    uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+    /* Claim next entry */
+    entry = &s_binlog.entry[s_binlog.head & (BINLOG_NUM_ENTRY - 1U)];
+    s_binlog.head++;
+
+    /* Fill entry */
+    entry->hdr = (id & 0xFFFFU) | ((argc & 0x3U) << 16U);
+    entry->usec = UINT64_L(usec);
+    entry->arg[0] = a0;
+    entry->arg[1] = a1;
+    entry->arg[2] = a2;
+
+#ifndef SIMU
+    EnableGlobalIRQ(priMask);
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get binary log                                                           */
+/*--------------------------------------------------------------------------*/
+void BINLOG_Get(const binlog_t **log, uint32_t *len)
+{
+    /* Return data */
+    *log = &s_binlog;
+    *len = sizeof(binlog_t);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Clear binary log                                                         */
+/*--------------------------------------------------------------------------*/
+void BINLOG_Clear(void)
+{
+    /* Reset header, entries past head are ignored */
+    s_binlog.magic = BINLOG_MAGIC;
+    s_binlog.numEntry = BINLOG_NUM_ENTRY;
+    s_binlog.head = 0U;
+    s_binlog.bootCnt = 0U;
+}
+
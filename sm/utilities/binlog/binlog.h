@@ -0,0 +1,205 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/*!
+ * @addtogroup UTIL
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing the binary log functions.
+ *
+ * The binary log records an ID, up to three 32-bit arguments, and a
+ * timestamp for each event. No formatting is done on the target. The
+ * format string passed to the BINLOGn() macros is discarded by the
+ * compiler and only used by the host-side decoder (binlog.pl) which
+ * extracts it from the source. The log is kept in a memory ring which
+ * is not initialized by startup and so survives a warm reset. It can be
+ * dumped with the monitor binlog command or retrieved via the SCMI
+ * MISC_SYSLOG message with the binary log flag set.
+ */
+/*==========================================================================*/
+
+#ifndef BINLOG_H
+#define BINLOG_H
+
+/* Includes */
+
+#include "sm.h"
+
+/* Defines */
+
+#ifndef BINLOG_NUM_ENTRY
+/*! Number of log entries (power of 2) */
+#define BINLOG_NUM_ENTRY    128U
+#endif
+
+/*! Max number of arguments per entry */
+#define BINLOG_MAX_ARG      3U
+
+/*! Log header magic */
+#define BINLOG_MAGIC        0x474F4C42U
+
+/*!
+ * @name Binary log entry header
+ */
+/** @{ */
+#define BINLOG_HDR_ID(x)     (((x) & 0xFFFFU) >> 0U)      /*!< Log ID */
+#define BINLOG_HDR_ARGC(x)   (((x) & 0x30000U) >> 16U)    /*!< Num args */
+/** @} */
+
+/*!
+ * @name Binary log IDs
+ *
+ * IDs are stored in the log and are used by the host decoder to find the
+ * format string. IDs must never be reused for a different format.
+ */
+/** @{ */
+#define BINLOG_ID_BOOT          0x0001U  /*!< SM boot */
+#define BINLOG_ID_SM_ERR        0x0002U  /*!< SM error */
+#define BINLOG_ID_SHUTDOWN_REC  0x0003U  /*!< Shutdown record */
+#define BINLOG_ID_RPC_INIT      0x0010U  /*!< RPC init */
+#define BINLOG_ID_LM_START      0x0020U  /*!< LM process start */
+#define BINLOG_ID_LM_POWER_ON   0x0021U  /*!< LM power on */
+#define BINLOG_ID_LM_BOOT       0x0022U  /*!< LM boot */
+#define BINLOG_ID_LM_SHUTDOWN   0x0023U  /*!< LM shutdown */
+#define BINLOG_ID_LM_RESET      0x0024U  /*!< LM reset */
+#define BINLOG_ID_LM_SUSPEND    0x0025U  /*!< LM suspend */
+#define BINLOG_ID_LM_WAKE       0x0026U  /*!< LM wake */
+#define BINLOG_ID_LM_DEADLINE   0x0027U  /*!< LM graceful deadline expired */
+#define BINLOG_ID_CPU_START     0x0030U  /*!< CPU start */
+#define BINLOG_ID_A55_RELOCK    0x0040U  /*!< A55 PLL relock failed */
+/** @} */
+
+/*!
+ * @name Binary log macros
+ *
+ * The format (\a f) is only used by the host decoder.
+ */
+/** @{ */
+#define BINLOG0(id, f) \
+    BINLOG_Write((id), 0U, 0U, 0U, 0U)
+#define BINLOG1(id, f, a0) \
+    BINLOG_Write((id), 1U, (uint32_t) (a0), 0U, 0U)
+#define BINLOG2(id, f, a0, a1) \
+    BINLOG_Write((id), 2U, (uint32_t) (a0), (uint32_t) (a1), 0U)
+#define BINLOG3(id, f, a0, a1, a2) \
+    BINLOG_Write((id), 3U, (uint32_t) (a0), (uint32_t) (a1), \
+    (uint32_t) (a2))
+/** @} */
+
+/* Types */
+
+/*!
+ * Binary log entry
+ */
+typedef struct
+{
+    /*! Header (ID and number of arguments) */
+    uint32_t hdr;
+    /*! Timestamp (lower 32-bits of usec counter) */
+    uint32_t usec;
+    /*! Arguments */
+    uint32_t arg[BINLOG_MAX_ARG];
+} binlog_entry_t;
+
+/*!
+ * Binary log
+ */
+typedef struct
+{
+    /*! Magic (::BINLOG_MAGIC) */
+    uint32_t magic;
+    /*! Number of entries in the ring */
+    uint32_t numEntry;
+    /*! Total number of entries written */
+    uint32_t head;
+    /*! Number of boots since the log was cleared */
+    uint32_t bootCnt;
+    /*! Entry ring */
+    binlog_entry_t entry[BINLOG_NUM_ENTRY];
+} binlog_t;
+
+/* Functions */
+
+/*!
+ * @name Binary log functions
+ * @{
+ */
+
+/*!
+ * Init the binary log.
+ *
+ * This function validates the log left by a previous boot and keeps it
+ * if valid, otherwise it is cleared. A ::BINLOG_ID_BOOT entry is then
+ * added.
+ */
+void BINLOG_Init(void);
+
+/*!
+ * Add an entry to the binary log.
+ *
+ * @param[in]     id        Log ID
+ * @param[in]     argc      Number of valid arguments
+ * @param[in]     a0        Argument 0
+ * @param[in]     a1        Argument 1
+ * @param[in]     a2        Argument 2
+ *
+ * Use the BINLOGn() macros rather than calling directly so the host
+ * decoder can find the format.
+ */
+void BINLOG_Write(uint32_t id, uint32_t argc, uint32_t a0, uint32_t a1,
+    uint32_t a2);
+
+/*!
+ * Get the binary log.
+ *
+ * @param[out]    log       Pointer to return the log pointer
+ * @param[out]    len       Pointer to return the log size in bytes
+ */
+void BINLOG_Get(const binlog_t **log, uint32_t *len);
+
+/*!
+ * Clear the binary log.
+ */
+void BINLOG_Clear(void);
+
+/** @} */
+
+#endif /* BINLOG_H */
+
+/** @} */
+
@@ -0,0 +1,239 @@
+#!/usr/bin/perl
+## ###################################################################
+##
+## Copyright 2025 NXP
+##
+## Redistribution and use in source and binary forms, with or without modification,
+## are permitted provided that the following conditions are met:
+##
+## o Redistributions of source code must retain the above copyright notice, this list
+##   of conditions and the following disclaimer.
+##
+## o Redistributions in binary form must reproduce the above copyright notice, this
+##   list of conditions and the following disclaimer in the documentation and/or
+##   other materials provided with the distribution.
+##
+## o Neither the name of the copyright holder nor the names of its
+##   contributors may be used to endorse or promote products derived from this
+##   software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+## ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+## WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+## DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+## ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+## (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+## LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+## ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+## SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+##
+##
+## ###################################################################
+
+use strict;
+use warnings;
+use Getopt::Std;
+use File::Basename;
+use File::Find;
+
+# Subroutines
+sub help_message;
+sub load_formats;
+sub load_words;
+sub format_entry;
+
+my %args;
+
+# Parse command line
+getopts('hr:i:', \%args);
+my $help = $args{h};
+my $rootDir = $args{r};
+my $inputFile = $args{i};
+
+# Default root is the SM tree containing this script
+if (not defined $rootDir)
+{
+    $rootDir = dirname(__FILE__) . '/../../..';
+}
+
+if ($help)
+{
+    &help_message();
+    exit;
+}
+
+# Build ID to format table from the source
+my %fmt = &load_formats($rootDir);
+
+# Load log words
+my @words = &load_words($inputFile);
+
+# Find header
+my $base = 0;
+while (($base < scalar(@words)) && ($words[$base] != 0x474F4C42))
+{
+    $base++;
+}
+if (($base + 4) > scalar(@words))
+{
+    die "error: binary log header not found\n";
+}
+my $numEntry = $words[$base + 1];
+my $head = $words[$base + 2];
+my $bootCnt = $words[$base + 3];
+$base += 4;
+
+print "Boot count: $bootCnt, total entries: $head\n";
+
+# Dump entries oldest to newest
+my $first = ($head > $numEntry) ? ($head - $numEntry) : 0;
+for (my $n = $first; $n < $head; $n++)
+{
+    my $idx = $base + (($n % $numEntry) * 5);
+
+    if (($idx + 5) > scalar(@words))
+    {
+        die "error: binary log truncated\n";
+    }
+
+    print &format_entry(@words[$idx .. ($idx + 4)]) . "\n";
+}
+
+exit;
+
+###############################################################################
+
+sub help_message
+{
+    my $cmd = fileparse($0);
+
+    print "Usage: $cmd [OPTIONS]...\n";
+    print "Decode an SM binary log.\n\n";
+    print "  -i  specify input file (default STDIN)\n";
+    print "  -r  specify SM source root (default from script location)\n";
+    print "  -h  display this help and exit\n\n";
+    print "The input is the output of the monitor binlog command or the\n";
+    print "words returned by MISC_SYSLOG with the binary log flag, as hex\n";
+    print "words. Formats are extracted from the BINLOGn() calls in the\n";
+    print "source. The decoded log is written to STDOUT.\n";
+}
+
+###############################################################################
+
+sub load_formats
+{
+    my ($root) = @_;
+    my (%ids, %table, @files);
+
+    # Find source files
+    find(sub
+        {
+            if ($File::Find::name =~ /\/(build|test)$/)
+            {
+                $File::Find::prune = 1;
+            }
+            elsif (/\.[ch]$/)
+            {
+                push(@files, $File::Find::name);
+            }
+        }, $root);
+
+    foreach my $file (@files)
+    {
+        open(my $fh, '<', $file) or die "error: can't open $file\n";
+        local $/;
+        my $src = <$fh>;
+        close($fh);
+
+        # Get ID values
+        while ($src =~ /#define\s+(BINLOG_ID_\w+)\s+(0x[0-9A-Fa-f]+)U?/g)
+        {
+            $ids{$1} = hex($2);
+        }
+
+        # Get formats
+        while ($src =~ /BINLOG[0-3]\s*\(\s*(BINLOG_ID_\w+)\s*,\s*"((?:[^"\\]|\\.)*)"/gs)
+        {
+            $table{$1} = $2;
+        }
+    }
+
+    # Map values to formats
+    my %byVal;
+    foreach my $name (keys %table)
+    {
+        if (defined $ids{$name})
+        {
+            $byVal{$ids{$name}} = $table{$name};
+        }
+    }
+
+    return %byVal;
+}
+
+###############################################################################
+
+sub load_words
+{
+    my ($file) = @_;
+    my ($fh, @w);
+
+    if (defined $file)
+    {
+        open($fh, '<', $file) or die "error: can't open $file\n";
+    }
+    else
+    {
+        $fh = \*STDIN;
+    }
+
+    # Extract all 32-bit hex words
+    while (my $line = <$fh>)
+    {
+        while ($line =~ /\b(?:0x)?([0-9A-Fa-f]{8})\b/g)
+        {
+            push(@w, hex($1));
+        }
+    }
+
+    return @w;
+}
+
+###############################################################################
+
+sub format_entry
+{
+    my ($hdr, $usec, @arg) = @_;
+    my $id = $hdr & 0xFFFF;
+    my $argc = ($hdr >> 16) & 0x3;
+    my $f = $fmt{$id};
+    my $text;
+
+    if (defined $f)
+    {
+        my @vals = @arg[0 .. ($argc - 1)];
+
+        # Convert signed arguments
+        my $n = 0;
+        while ($f =~ /%[-0-9.]*([a-zA-Z])/g)
+        {
+            if ((($1 eq 'd') || ($1 eq 'i')) && ($n < scalar(@vals))
+                && ($vals[$n] >= 0x80000000))
+            {
+                $vals[$n] -= 4294967296;
+            }
+            $n++;
+        }
+
+        $text = sprintf($f, @vals);
+    }
+    else
+    {
+        $text = sprintf("unknown id 0x%04X: 0x%08X 0x%08X 0x%08X", $id,
+            @arg);
+    }
+
+    return sprintf("%10u: %s", $usec, $text);
+}
+
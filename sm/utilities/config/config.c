@@ -43,6 +43,9 @@
 
 /* Local defines */
 
+#define CONFIG_MODE_LOAD   0U
+#define CONFIG_MODE_DELTA  1U
+
 /* Local types */
 
 /* Local variables */
@@ -51,8 +54,12 @@ static bool s_cond = true;
 
 /* Local functions */
 
-static int32_t DEV_SM_ExecOp(uint32_t *addr, const uint32_t *pc,
-    const uint32_t **rtn);
+static int32_t CONFIG_Walk(const uint32_t *base, const uint32_t *config,
+    uint32_t mode, uint32_t *numWrite);
+static int32_t CONFIG_Op(uint32_t *addr, uint32_t op, uint32_t oc,
+    const uint32_t **data, uint32_t mode, uint32_t *numWrite);
+static int32_t DEV_SM_ExecOp(uint32_t *addr, uint32_t op, uint32_t oc,
+    const uint32_t **data);
 
 /*--------------------------------------------------------------------------*/
 /* Set condition                                                            */
@@ -67,44 +74,79 @@ void CONFIG_Condition(bool cond)
 /* Load configuration                                                       */
 /*--------------------------------------------------------------------------*/
 int32_t CONFIG_Load(const uint32_t *base, const uint32_t *config)
+{
+    /* Write all words */
+    return CONFIG_Walk(base, config, CONFIG_MODE_LOAD, NULL);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Load only differing words of a configuration                             */
+/*--------------------------------------------------------------------------*/
+int32_t CONFIG_LoadDelta(const uint32_t *base, const uint32_t *config,
+    uint32_t *numWrite)
+{
+    /* Clear count */
+    if (numWrite != NULL)
+    {
+        *numWrite = 0U;
+    }
+
+    /* Compare and write differing words */
+    return CONFIG_Walk(base, config, CONFIG_MODE_DELTA, numWrite);
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Walk a configuration                                                     */
+/*--------------------------------------------------------------------------*/
+static int32_t CONFIG_Walk(const uint32_t *base, const uint32_t *config,
+    uint32_t mode, uint32_t *numWrite)
 {
     int32_t status = SM_ERR_SUCCESS;
     const uint32_t *pc = config;
     const uint32_t *repeat = NULL;
+    uint32_t repeatOc = SM_CFG_OC_END;
+    uintptr_t page;
+
+    /* Resolve the base page once for all relative commands */
+    page = ((uintptr_t) base) & ~((uintptr_t) 0xFFFFU);
 
     while ((status == SM_ERR_SUCCESS) && (*pc != SM_CFG_END))
     {
         uint32_t op;
         uint32_t oc;
-        uint32_t ot;
         uint32_t *addr;
 
         /* Read and parse op */
         op = *pc;
-        ot = (op & SM_CFG_OT_MASK) >> SM_CFG_OT_SHIFT;
-
-        if (ot == SM_CFG_OT_BASE)
+        if (((op & SM_CFG_OT_MASK) >> SM_CFG_OT_SHIFT) == SM_CFG_OT_BASE)
         {
             oc = (op & SM_CFG_OC_MASK) >> SM_CFG_OC_SHIFT;
-            addr = (uint32_t*) ((((uint32_t) base) & 0xFFFF0000U)
-                + (op & SM_CFG_OPA_MASK));
+            addr = (uint32_t*) (page + (op & SM_CFG_OPA_MASK));
         }
         else
         {
             oc = SM_CFG_OC_WRITE;
-            addr = (uint32_t*) (op & ~SM_CFG_OT_MASK);
+            addr = (uint32_t*) ((uintptr_t) (op & ~SM_CFG_OT_MASK));
         }
 
         if (oc != SM_CFG_OC_REPEAT)
         {
             repeat = pc;
-            status = DEV_SM_ExecOp(addr, pc, &pc);
+            repeatOc = oc;
+            pc++;
+            status = CONFIG_Op(addr, op, oc, &pc, mode, numWrite);
         }
         else
         {
             if (repeat != NULL)
             {
-                status = DEV_SM_ExecOp(addr, repeat, NULL);
+                const uint32_t *data = &repeat[1];
+
+                /* Replay the previous op at the new address */
+                status = CONFIG_Op(addr, *repeat, repeatOc, &data, mode,
+                    numWrite);
                 pc++;
             }
             else
@@ -117,37 +159,105 @@ int32_t CONFIG_Load(const uint32_t *base, const uint32_t *config)
     return status;
 }
 
-/*==========================================================================*/
+/*--------------------------------------------------------------------------*/
+/* Process an operation                                                     */
+/*--------------------------------------------------------------------------*/
+static int32_t CONFIG_Op(uint32_t *addr, uint32_t op, uint32_t oc,
+    const uint32_t **data, uint32_t mode, uint32_t *numWrite)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    if (mode == CONFIG_MODE_LOAD)
+    {
+        status = DEV_SM_ExecOp(addr, op, oc, data);
+    }
+    else
+    {
+        uint32_t *new_addr = addr;
+        const uint32_t *new_pc = *data;
+        const uint32_t *val = new_pc;
+        uint32_t inc = 1U;
+        uint32_t len = 1U;
+        static const uint32_t s_zero = 0U;
+
+        /* Get length */
+        if (((op & SM_CFG_OT_MASK) >> SM_CFG_OT_SHIFT) == SM_CFG_OT_BASE)
+        {
+            len = (op & SM_CFG_OPL_MASK) >> SM_CFG_OPL_SHIFT;
+        }
+
+        /* Get source of values and advance pc */
+        switch (oc)
+        {
+            case SM_CFG_OC_WRITE:
+                new_pc = &new_pc[len];
+                break;
+            case SM_CFG_OC_CWRITE:
+                new_pc = &new_pc[len];
+                if (!s_cond)
+                {
+                    len = 0U;
+                }
+                break;
+            case SM_CFG_OC_FILL:
+                new_pc++;
+                inc = 0U;
+                break;
+            case SM_CFG_OC_ZERO:
+                val = &s_zero;
+                inc = 0U;
+                break;
+            default:
+                status = SM_ERR_NOT_FOUND;
+                len = 0U;
+                break;
+        }
+
+        /* Loop over words, write only if different */
+        while (len > 0U)
+        {
+            if (*new_addr != *val)
+            {
+                *new_addr = *val;
+
+                /* Count writes */
+                if (numWrite != NULL)
+                {
+                    (*numWrite)++;
+                }
+            }
+
+            new_addr++;
+            val = &val[inc];
+            len--;
+        }
+
+        /* Return pc */
+        *data = new_pc;
+    }
+
+    return status;
+}
 
 /*--------------------------------------------------------------------------*/
 /* Execute an operation                                                     */
 /*--------------------------------------------------------------------------*/
-static int32_t DEV_SM_ExecOp(uint32_t *addr, const uint32_t *pc,
-    const uint32_t **rtn)
+static int32_t DEV_SM_ExecOp(uint32_t *addr, uint32_t op, uint32_t oc,
+    const uint32_t **data)
 {
     int32_t status = SM_ERR_SUCCESS;
     uint32_t *new_addr = addr;
-    const uint32_t *new_pc = pc;
-    uint32_t op;
-    uint32_t ot;
-    uint32_t oc;
+    const uint32_t *new_pc = *data;
     uint32_t len;
     uint32_t fill;
 
-    /* Read op and advance pc */
-    op = *new_pc;
-    new_pc++;
-
-    /* Parse op */
-    ot = (op & SM_CFG_OT_MASK) >> SM_CFG_OT_SHIFT;
-    if (ot == SM_CFG_OT_BASE)
+    /* Get length */
+    if (((op & SM_CFG_OT_MASK) >> SM_CFG_OT_SHIFT) == SM_CFG_OT_BASE)
     {
-        oc = (op & SM_CFG_OC_MASK) >> SM_CFG_OC_SHIFT;
         len = (op & SM_CFG_OPL_MASK) >> SM_CFG_OPL_SHIFT;
     }
     else
     {
-        oc = SM_CFG_OC_WRITE;
         len = 1U;
     }
 
@@ -163,15 +273,19 @@ static int32_t DEV_SM_ExecOp(uint32_t *addr, const uint32_t *pc,
             }
             break;
         case SM_CFG_OC_CWRITE:
-            while (len > 0U)
+            if (s_cond)
             {
-                if (s_cond)
+                while (len > 0U)
                 {
                     *new_addr = *new_pc;
+                    new_addr++;
+                    new_pc++;
+                    len--;
                 }
-                new_addr++;
-                new_pc++;
-                len--;
+            }
+            else
+            {
+                new_pc = &new_pc[len];
             }
             break;
         case SM_CFG_OC_FILL:
@@ -198,10 +312,7 @@ static int32_t DEV_SM_ExecOp(uint32_t *addr, const uint32_t *pc,
     }
 
     /* Return pc */
-    if (rtn != NULL)
-    {
-        *rtn = new_pc;
-    }
+    *data = new_pc;
 
     return status;
 }
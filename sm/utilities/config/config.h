@@ -171,6 +171,28 @@ void CONFIG_Condition(bool cond);
  */
 int32_t CONFIG_Load(const uint32_t *base, const uint32_t *config);
 
+/*!
+ * Load only the differing words of a configuration array.
+ *
+ * @param[in]     base      Base pointer
+ * @param[in]     config    Pointer to command array
+ * @param[out]    numWrite  Return number of words written, may be NULL
+ *
+ * This function processes the same commands as CONFIG_Load() but reads
+ * each target word first and only writes it if it differs from the
+ * configured value. Used to restore a configuration that may have been
+ * partially retained.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if array completely loaded without error.
+ * - ::SM_ERR_NOT_FOUND: if a command code is invalid.
+ * - ::SM_ERR_INVALID_PARAMETERS: if a command parameter is invalid.
+ */
+int32_t CONFIG_LoadDelta(const uint32_t *base, const uint32_t *config,
+    uint32_t *numWrite);
+
 /** @} */
 
 #endif /* CONFIG_H */
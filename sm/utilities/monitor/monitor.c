@@ -373,6 +373,9 @@ static int32_t MONITOR_CharGet(char *buf, uint32_t len, bool echo)
 
     if (uartConfig->base != NULL)
     {
+        /* Send pending output before blocking on input */
+        BOARD_DebugConsoleFlush();
+
         LPUART_ReadBlocking(uartConfig->base, (uint8_t*) buf, len);
 
         if ((*buf != ESC) && echo)
@@ -51,6 +51,14 @@
 #endif
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "binlog.h"
+#include "rpc_scmi.h"
+#include "rpc_scmi_config.h"
+#include "config_smt.h"
+#ifdef USES_MB_MU
+#include "mb_mu.h"
+#include "config_mb_mu.h"
+#endif
 #ifdef DEVICE_HAS_ELE
 #include "fsl_ele.h"
 #endif
@@ -109,6 +117,7 @@ static int32_t MONITOR_CmdLmReset(int32_t argc, const char * const argv[],
     uint32_t lm);
 static int32_t MONITOR_CmdLmReason(int32_t argc, const char * const argv[],
     uint32_t lm);
+static int32_t MONITOR_CmdLmSteps(uint32_t lm);
 static int32_t MONITOR_CmdPower(int32_t argc, const char * const argv[],
     int32_t rw);
 static int32_t MONITOR_CmdPerf(int32_t argc, const char * const argv[],
@@ -148,6 +157,8 @@ static int32_t MONITOR_CmdPmic(int32_t argc, const char * const argv[],
 static int32_t MONITOR_CmdIdle(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdAssert(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdSyslog(int32_t argc, const char * const argv[]);
+static int32_t MONITOR_CmdBinlog(int32_t argc, const char * const argv[]);
+static int32_t MONITOR_CmdSched(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdGroup(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdSsm(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdCustom(int32_t argc, const char * const argv[]);
@@ -235,7 +246,9 @@ int32_t MONITOR_Dispatch(char *line)
         "test",
         "delay",
         "ddr",
-        "gcov"
+        "gcov",
+        "binlog",
+        "sched"
     };
 
     /* Parse Line */
@@ -447,6 +460,12 @@ int32_t MONITOR_Dispatch(char *line)
                 GCOV_InfoDump();
                 break;
 #endif
+            case 63:  /* binlog */
+                status = MONITOR_CmdBinlog(argc - 1, &argv[1]);
+                break;
+            case 64:  /* sched */
+                status = MONITOR_CmdSched(argc - 1, &argv[1]);
+                break;
             default:
                 status = SM_ERR_NOT_FOUND;
                 break;
@@ -1360,7 +1379,8 @@ static int32_t MONITOR_CmdLm(int32_t argc, const char * const argv[])
         "wake",
         "suspend",
         "reason",
-        "power"
+        "power",
+        "steps"
     };
 
     /* Check argument */
@@ -1431,6 +1451,9 @@ static int32_t MONITOR_CmdLm(int32_t argc, const char * const argv[])
             case 8:  /* power */
                 status = LMM_SystemLmPowerOn(0U, 0U, lm);
                 break;
+            case 9:  /* steps */
+                status = MONITOR_CmdLmSteps(lm);
+                break;
             default:
                 status = SM_ERR_INVALID_PARAMETERS;
                 break;
@@ -1457,6 +1480,8 @@ static int32_t MONITOR_CmdLmInfo(int32_t argc, const char * const argv[])
         string name;
         uint32_t state;
         int32_t errStatus;
+        uint32_t remaining = 0U;
+        uint32_t overruns = 0U;
         int32_t wName = 0;
 
         status = LMM_LmNameGet(0U, lm, &name, &wName);
@@ -1464,6 +1489,10 @@ static int32_t MONITOR_CmdLmInfo(int32_t argc, const char * const argv[])
         {
             status = LM_SystemLmStatus(0U, lm, &state, &errStatus);
         }
+        if (status == SM_ERR_SUCCESS)
+        {
+            status = LMM_SystemLmDeadlineGet(lm, &remaining, &overruns);
+        }
 
         if (status == SM_ERR_SUCCESS)
         {
@@ -1482,6 +1511,16 @@ static int32_t MONITOR_CmdLmInfo(int32_t argc, const char * const argv[])
                 printf(", err = %d", errStatus);
             }
 
+            if (remaining != 0U)
+            {
+                printf(", deadline = %ums", remaining);
+            }
+
+            if (overruns != 0U)
+            {
+                printf(", overruns = %u", overruns);
+            }
+
             if (lm == s_lm)
             {
                 printf(" (default)");
@@ -1574,6 +1613,49 @@ static int32_t MONITOR_CmdLmReason(int32_t argc, const char * const argv[],
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* LM start/stop program steps command                                      */
+/*--------------------------------------------------------------------------*/
+static int32_t MONITOR_CmdLmSteps(uint32_t lm)
+{
+    static string const ssText[] =
+    {
+        "pd",
+        "perf",
+        "clk",
+        "cpu",
+        "volt",
+        "rst",
+        "ctrl"
+    };
+
+    /* Loop over start and stop programs */
+    for (uint32_t prog = 0U; prog < 2U; prog++)
+    {
+        bool start = (prog == 0U);
+        const lmm_startstop_t *ss;
+        uint32_t usec;
+        uint32_t step = 0U;
+
+        printf("%s:\n", start ? "Start" : "Stop");
+
+        /* Loop over steps */
+        while (LMM_SystemLmStepGet(lm, start, step, &ss, &usec)
+            == SM_ERR_SUCCESS)
+        {
+            if (ss->ss < ARRAY_SIZE(ssText))
+            {
+                printf("  %02u: %-4s %3u = %uus\n", step, ssText[ss->ss],
+                    ss->rsrc, usec);
+            }
+            step++;
+        }
+    }
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Power command                                                            */
 /*--------------------------------------------------------------------------*/
@@ -3436,8 +3518,7 @@ static int32_t MONITOR_CmdFuse(int32_t argc, const char * const argv[],
                                 if (errno == 0)
                                 {
                                     /* Write fuse */
-                                    ELE_FuseWrite(word, data, false);
-                                    status = g_eleStatus;
+                                    status = DEV_SM_FuseWrite(word, data);
                                 }
                                 else
                                 {
@@ -3662,6 +3743,101 @@ static int32_t MONITOR_CmdSyslog(int32_t argc, const char * const argv[])
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Binary log command                                                       */
+/*--------------------------------------------------------------------------*/
+static int32_t MONITOR_CmdBinlog(int32_t argc, const char * const argv[])
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    static string const cmds[] =
+    {
+        "clear"
+    };
+
+    /* Parse argument */
+    if (argc != 0)
+    {
+        int32_t sub = MONITOR_FindN(cmds, (int32_t) ARRAY_SIZE(cmds),
+            argv[0]);
+
+        switch (sub)
+        {
+            case 0:  /* clear */
+                BINLOG_Clear();
+                break;
+            default:
+                status = SM_ERR_INVALID_PARAMETERS;
+                break;
+        }
+    }
+    else
+    {
+        const binlog_t *binlog;
+        uint32_t len;
+
+        /* Get log */
+        BINLOG_Get(&binlog, &len);
+
+        /* Dump header */
+        printf("binlog: %08X %08X %08X %08X\n", binlog->magic,
+            binlog->numEntry, binlog->head, binlog->bootCnt);
+
+        /* Dump raw entries, decode with binlog.pl */
+        for (uint32_t idx = 0U; (idx < binlog->head)
+            && (idx < binlog->numEntry); idx++)
+        {
+            const binlog_entry_t *entry = &binlog->entry[idx];
+
+            printf("  %08X %08X %08X %08X %08X\n", entry->hdr,
+                entry->usec, entry->arg[0], entry->arg[1], entry->arg[2]);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* SCMI scheduler command                                                   */
+/*--------------------------------------------------------------------------*/
+static int32_t MONITOR_CmdSched(int32_t argc, const char * const argv[])
+{
+    /* Loop over agents */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        const scmi_agnt_config_t *cfg = &g_scmiAgentConfig[agentId];
+        scmi_sched_stats_t stats;
+
+        if (RPC_SCMI_SchedStatsGet(agentId, &stats) == SM_ERR_SUCCESS)
+        {
+            printf("%02u: %-15s prio=%u, weight=%u, budget=%u\n", agentId,
+                cfg->name, cfg->schedPrio, cfg->schedWeight,
+                cfg->schedBudget);
+            printf("    msg=%u, skip=%u, throttle=%u, max wait=%uus\n",
+                stats.numMsg, stats.numSkip, stats.numThrottle,
+                stats.maxWaitUsec);
+        }
+    }
+
+#ifdef USES_MB_MU
+    /* Loop over MU mailboxes */
+    for (uint8_t inst = 0U; inst < SM_NUM_MB_MU; inst++)
+    {
+        mb_mu_stats_t stats;
+
+        if (MB_MU_StatsGet(inst, &stats) == SM_ERR_SUCCESS)
+        {
+            printf("MB%u: irq=%u, db=%u, max db/irq=%u\n", inst,
+                stats.numIrq, stats.numDb, stats.maxDb);
+        }
+    }
+#endif
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Group command                                                            */
 /*--------------------------------------------------------------------------*/
@@ -0,0 +1,337 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/* File containing the implementation of the timer functions                */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "sm.h"
+#include "timer.h"
+#include "dev_sm.h"
+
+/* Local defines */
+
+/* Local types */
+
+/* Local variables */
+
+static timer_work_t *s_timerList = NULL;
+static timer_work_t *s_workHead = NULL;
+static timer_work_t *s_workTail = NULL;
+
+/* Local functions */
+
+static void TIMER_Remove(timer_work_t *work);
+static void TIMER_Append(timer_work_t *work);
+
+/*--------------------------------------------------------------------------*/
+/* Init timer item                                                          */
+/*--------------------------------------------------------------------------*/
+void TIMER_WorkInit(timer_work_t *work, timer_cb_t cb, uint32_t cookie)
+{
+    work->next = NULL;
+    work->cb = cb;
+    work->cookie = cookie;
+    work->state = TIMER_STATE_IDLE;
+    work->deadline = TIMER_NONE;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Arm one-shot timer                                                       */
+/*--------------------------------------------------------------------------*/
+void TIMER_Start(timer_work_t *work, uint32_t usec)
+{
+    uint64_t deadline = DEV_SM_Usec64Get() + U64(usec);
+    timer_work_t **pp = &s_timerList;
+
+#ifndef SIMU
+    uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+    /* Remove from any list */
+    TIMER_Remove(work);
+
+    /* Insert sorted, after items with the same deadline */
+    while ((*pp != NULL) && ((*pp)->deadline <= deadline))
+    {
+        pp = &(*pp)->next;
+    }
+    work->deadline = deadline;
+    work->next = *pp;
+    work->state = TIMER_STATE_ARMED;
+    *pp = work;
+
+#ifndef SIMU
+    EnableGlobalIRQ(priMask);
+
+    /* Reprogram the compare if now the earliest */
+    if (s_timerList == work)
+    {
+        DEV_SM_TickUpdate();
+    }
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Cancel timer item                                                        */
+/*--------------------------------------------------------------------------*/
+void TIMER_Cancel(timer_work_t *work)
+{
+#ifndef SIMU
+    uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+    TIMER_Remove(work);
+
+#ifndef SIMU
+    EnableGlobalIRQ(priMask);
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Queue deferred work                                                      */
+/*--------------------------------------------------------------------------*/
+void TIMER_WorkQueue(timer_work_t *work)
+{
+#ifndef SIMU
+    uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+    /* Queue if not already queued */
+    if (work->state != TIMER_STATE_QUEUED)
+    {
+        TIMER_Remove(work);
+        TIMER_Append(work);
+    }
+
+#ifndef SIMU
+    EnableGlobalIRQ(priMask);
+#endif
+
+    /* Run from the scheduler */
+    SWI_SchedTrigger();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Expire timers                                                            */
+/*--------------------------------------------------------------------------*/
+bool TIMER_Expire(uint64_t usec)
+{
+    bool queued;
+
+#ifndef SIMU
+    uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+    /* Move expired items to the work queue in deadline order */
+    while ((s_timerList != NULL) && (s_timerList->deadline <= usec))
+    {
+        timer_work_t *work = s_timerList;
+
+        s_timerList = work->next;
+        TIMER_Append(work);
+    }
+    queued = (s_workHead != NULL);
+
+#ifndef SIMU
+    EnableGlobalIRQ(priMask);
+#endif
+
+    /* Return if work queued */
+    return queued;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Run deferred work                                                        */
+/*--------------------------------------------------------------------------*/
+bool TIMER_WorkRun(void)
+{
+    uint32_t num = 0U;
+
+    /* Pick up any timer the tick has not yet seen */
+    (void) TIMER_Expire(DEV_SM_Usec64Get());
+
+    /* Count what is queued on entry */
+    {
+#ifndef SIMU
+        uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+        for (const timer_work_t *work = s_workHead; work != NULL;
+            work = work->next)
+        {
+            num++;
+        }
+
+#ifndef SIMU
+        EnableGlobalIRQ(priMask);
+#endif
+    }
+
+    /* Run at most that many items, callbacks may requeue or cancel */
+    while (num > 0U)
+    {
+        timer_work_t *work;
+
+#ifndef SIMU
+        uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+        /* Dequeue */
+        work = s_workHead;
+        if (work != NULL)
+        {
+            s_workHead = work->next;
+            if (s_workHead == NULL)
+            {
+                s_workTail = NULL;
+            }
+            work->next = NULL;
+            work->state = TIMER_STATE_IDLE;
+            num--;
+        }
+        else
+        {
+            num = 0U;
+        }
+
+#ifndef SIMU
+        EnableGlobalIRQ(priMask);
+#endif
+
+        /* Run, callback may rearm or queue the item */
+        if (work != NULL)
+        {
+            work->cb(work->cookie);
+        }
+    }
+
+    /* Return if more to run */
+    return (s_workHead != NULL);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get earliest timer deadline                                              */
+/*--------------------------------------------------------------------------*/
+uint64_t TIMER_NextGet(void)
+{
+    uint64_t deadline = TIMER_NONE;
+
+#ifndef SIMU
+    uint32_t priMask = DisableGlobalIRQ();
+#endif
+
+    if (s_timerList != NULL)
+    {
+        deadline = s_timerList->deadline;
+    }
+
+#ifndef SIMU
+    EnableGlobalIRQ(priMask);
+#endif
+
+    /* Return deadline */
+    return deadline;
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Remove item from timer list or work queue, IRQs must be disabled         */
+/*--------------------------------------------------------------------------*/
+static void TIMER_Remove(timer_work_t *work)
+{
+    timer_work_t **pp = NULL;
+    timer_work_t *prev = NULL;
+
+    if (work->state == TIMER_STATE_ARMED)
+    {
+        pp = &s_timerList;
+    }
+    else if (work->state == TIMER_STATE_QUEUED)
+    {
+        pp = &s_workHead;
+    }
+    else
+    {
+        ; /* Intentional empty else */
+    }
+
+    /* Unlink */
+    while ((pp != NULL) && (*pp != NULL))
+    {
+        if (*pp == work)
+        {
+            *pp = work->next;
+
+            /* Fix queue tail */
+            if (s_workTail == work)
+            {
+                s_workTail = prev;
+            }
+            pp = NULL;
+        }
+        else
+        {
+            prev = *pp;
+            pp = &(*pp)->next;
+        }
+    }
+
+    work->next = NULL;
+    work->state = TIMER_STATE_IDLE;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Append item to work queue, IRQs must be disabled                         */
+/*--------------------------------------------------------------------------*/
+static void TIMER_Append(timer_work_t *work)
+{
+    work->next = NULL;
+    work->state = TIMER_STATE_QUEUED;
+
+    if (s_workTail == NULL)
+    {
+        s_workHead = work;
+    }
+    else
+    {
+        s_workTail->next = work;
+    }
+    s_workTail = work;
+}
+
@@ -0,0 +1,182 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/*!
+ * @addtogroup UTIL
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing the one-shot timer and deferred work functions.
+ *
+ * A timer item is armed with a relative timeout in microseconds and kept
+ * in a list sorted by deadline. The device tick handler programs the
+ * system counter compare for the earliest deadline and moves expired
+ * items to the work queue. The work queue is run by the SCMI scheduler
+ * SWI between messages, so a callback runs in the same context as SCMI
+ * message handlers and may call any driver they can. Drivers use this to
+ * schedule a continuation instead of busy-waiting.
+ */
+/*==========================================================================*/
+
+#ifndef TIMER_H
+#define TIMER_H
+
+/* Includes */
+
+#include "sm.h"
+
+/* Defines */
+
+/*!
+ * @name Timer item states
+ */
+/** @{ */
+#define TIMER_STATE_IDLE    0U  /*!< Not armed or queued */
+#define TIMER_STATE_ARMED   1U  /*!< In the timer list */
+#define TIMER_STATE_QUEUED  2U  /*!< In the work queue */
+/** @} */
+
+/*! No deadline */
+#define TIMER_NONE          UINT64_MAX
+
+/* Types */
+
+/*!
+ * Timer callback
+ */
+typedef void (*timer_cb_t)(uint32_t cookie);
+
+/*!
+ * Timer and deferred work item
+ */
+typedef struct timer_work
+{
+    /*! Next item in list */
+    struct timer_work *next;
+    /*! Function to run */
+    timer_cb_t cb;
+    /*! Argument passed to the function */
+    uint32_t cookie;
+    /*! State (TIMER_STATE_*) */
+    uint32_t state;
+    /*! Expiry time in usec */
+    uint64_t deadline;
+} timer_work_t;
+
+/* Functions */
+
+/*!
+ * @name Timer functions
+ * @{
+ */
+
+/*!
+ * Init a timer item.
+ *
+ * @param[out]    work      Item to init
+ * @param[in]     cb        Function to run
+ * @param[in]     cookie    Argument passed to \a cb
+ */
+void TIMER_WorkInit(timer_work_t *work, timer_cb_t cb, uint32_t cookie);
+
+/*!
+ * Arm a one-shot timer.
+ *
+ * @param[in,out] work      Item to arm
+ * @param[in]     usec      Timeout in microseconds
+ *
+ * This function arms the item to be queued after \a usec. An item already
+ * armed or queued is moved to the new deadline.
+ */
+void TIMER_Start(timer_work_t *work, uint32_t usec);
+
+/*!
+ * Cancel a timer item.
+ *
+ * @param[in,out] work      Item to cancel
+ *
+ * Removes the item from the timer list or work queue.
+ */
+void TIMER_Cancel(timer_work_t *work);
+
+/*!
+ * Queue deferred work.
+ *
+ * @param[in,out] work      Item to queue
+ *
+ * Queues the item to run from the SCMI scheduler SWI. An item that is
+ * armed is removed from the timer list.
+ */
+void TIMER_WorkQueue(timer_work_t *work);
+
+/*!
+ * Expire timers.
+ *
+ * @param[in]     usec      Current time in usec
+ *
+ * Moves all items with a deadline at or before \a usec to the work queue.
+ * Called from the device tick handler.
+ *
+ * @return Returns true if work is queued.
+ */
+bool TIMER_Expire(uint64_t usec);
+
+/*!
+ * Run deferred work.
+ *
+ * Expires timers and runs at most as many items as are queued on
+ * entry, so callbacks that requeue or cancel items cannot keep it
+ * looping. Called by the SCMI scheduler SWI.
+ *
+ * @return Returns true if more work is queued.
+ */
+bool TIMER_WorkRun(void);
+
+/*!
+ * Get the earliest timer deadline.
+ *
+ * @return Returns the deadline in usec or ::TIMER_NONE.
+ */
+uint64_t TIMER_NextGet(void);
+
+/** @} */
+
+#endif /* TIMER_H */
+
+/** @} */
+
@@ -48,6 +48,9 @@ int _read(int file, char *buf, int len)
 
     if ((uartConfig->base != NULL) && (file == STDIN_FILENO))
     {
+        // Send pending output before blocking on input
+        BOARD_DebugConsoleFlush();
+
         (void) LPUART_ReadBlocking(uartConfig->base, (uint8_t*) buf, len);
 
         // Echo received characters
@@ -70,24 +73,26 @@ int _read(int file, char *buf, int len)
 
 int _write(int file, char *buf, int len)
 {
-    int ret_len = len;
-    uint8_t cr = '\r';
+    int start = 0;
+    const uint8_t cr = '\r';
 
     const board_uart_config_t *uartConfig = BOARD_GetDebugUart();
 
     if ((uartConfig->base != NULL) && (file == STDOUT_FILENO || file == STDERR_FILENO))
     {
-        while ((len--) != 0)
+        // Queue output, inserting a CR before each LF
+        for (int i = 0; i < len; i++)
         {
-            if (*buf == '\n')
+            if (buf[i] == '\n')
             {
-                LPUART_WriteBlocking(uartConfig->base, &cr, 1);
+                BOARD_DebugConsoleWrite((const uint8_t*) &buf[start], (uint32_t) (i - start));
+                BOARD_DebugConsoleWrite(&cr, 1U);
+                start = i;
             }
-
-            LPUART_WriteBlocking(uartConfig->base, (uint8_t*) buf, 1);
-            buf++;
         }
-        return ret_len;
+        BOARD_DebugConsoleWrite((const uint8_t*) &buf[start], (uint32_t) (len - start));
+
+        return len;
     }
     else
     {
@@ -99,6 +104,7 @@ int _write(int file, char *buf, int len)
 void _exit(int status)
 {
     (void) _write(STDOUT_FILENO, "exit", 4);
+    BOARD_DebugConsoleFlush();
     SystemExit();
     while (1)
     {